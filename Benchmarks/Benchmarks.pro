@@ -0,0 +1,30 @@
+include(../defaults.pri)
+
+QT += core gui
+
+TARGET = Benchmarks
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+LIBS += -L$$DESTDIR -lD-Viz
+
+HEADERS += \
+   scanBenchmark.h \
+   treeGenerator.h
+
+SOURCES += \
+   main.cpp \
+   scanBenchmark.cpp \
+   treeGenerator.cpp
+
+win32: LIBS += -lpsapi
+
+win32: CONFIG(release, debug|release) {
+    QMAKE_CXXFLAGS += /Zi
+    QMAKE_LFLAGS += /INCREMENTAL:NO /Debug
+}
@@ -0,0 +1,229 @@
+#include "scanBenchmark.h"
+#include "treeGenerator.h"
+
+#include <Model/Scanner/linuxFileSystemBackend.h>
+#include <Model/Scanner/windowsFileSystemBackend.h>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include <bootstrapper.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Backend = std::shared_ptr<const Scanner::FileSystemBackend>;
+    using BackendFactory = Backend (*)(bool shouldStatInInodeOrder);
+
+    /**
+     * @returns The engines that can be benchmarked on this machine, by name.
+     */
+    std::vector<std::pair<std::string, BackendFactory>> DetermineEngines()
+    {
+        std::vector<std::pair<std::string, BackendFactory>> engines;
+
+#if defined(Q_OS_WIN)
+        engines.emplace_back("directory-iterator", [](bool /*shouldStatInInodeOrder*/) -> Backend {
+            return std::make_shared<Scanner::WindowsFileSystemBackend>();
+        });
+#elif defined(Q_OS_LINUX)
+        engines.emplace_back("thread-pool", [](bool shouldStatInInodeOrder) -> Backend {
+            return std::make_shared<Scanner::LinuxFileSystemBackend>(
+                ScanningEngine::ThreadPool, shouldStatInInodeOrder);
+        });
+
+        // The backend quietly falls back onto the thread pool if the kernel lacks io_uring, in
+        // which case there's nothing new to measure.
+        const Scanner::LinuxFileSystemBackend probe{ ScanningEngine::IoUring };
+        if (probe.GetEngine() == ScanningEngine::IoUring) {
+            engines.emplace_back("io-uring", [](bool shouldStatInInodeOrder) -> Backend {
+                return std::make_shared<Scanner::LinuxFileSystemBackend>(
+                    ScanningEngine::IoUring, shouldStatInInodeOrder);
+            });
+        }
+#endif // Q_OS_LINUX
+
+        return engines;
+    }
+
+    /**
+     * @returns The orders in which to stat the files in each directory, where true stands for
+     * inode order. Only Linux supports anything other than the listing order.
+     */
+    std::vector<bool> DetermineStatOrders([[maybe_unused]] const QCommandLineParser& parser)
+    {
+        std::vector<bool> statOrders = { false };
+
+#if defined(Q_OS_LINUX)
+        if (!parser.isSet("skip-inode-order")) {
+            statOrders.emplace_back(true);
+        }
+#endif // Q_OS_LINUX
+
+        return statOrders;
+    }
+
+    /**
+     * @returns The media on which to lay out the trees, by name. On Linux, a tmpfs mount takes the
+     * storage device out of the equation, which isolates the cost of the scanner itself.
+     */
+    std::vector<std::pair<std::string, std::filesystem::path>>
+    DetermineMedia(const QCommandLineParser& parser)
+    {
+        std::vector<std::pair<std::string, std::filesystem::path>> media;
+
+        const auto tmpfsRoot = parser.value("tmpfs-root").toStdString();
+        if (!tmpfsRoot.empty()) {
+            media.emplace_back("tmpfs", tmpfsRoot);
+        }
+
+        const auto diskRoot = parser.value("disk-root").toStdString();
+        if (!diskRoot.empty()) {
+            media.emplace_back("disk", diskRoot);
+        }
+
+        return media;
+    }
+
+    /**
+     * @returns The shapes to benchmark, or every shape if none were asked for.
+     */
+    std::vector<Benchmarks::TreeShape> DetermineShapes(const QCommandLineParser& parser)
+    {
+        const auto names = parser.values("shape");
+        if (names.isEmpty()) {
+            return { Benchmarks::TreeShape::Wide, Benchmarks::TreeShape::Deep,
+                     Benchmarks::TreeShape::ManyTinyFiles, Benchmarks::TreeShape::FewHugeFiles };
+        }
+
+        std::vector<Benchmarks::TreeShape> shapes;
+        for (const auto& name : names) {
+            const auto shape = Benchmarks::ParseTreeShape(name.toStdString());
+            if (!shape) {
+                throw std::invalid_argument{ "Unknown tree shape: " + name.toStdString() };
+            }
+
+            shapes.emplace_back(*shape);
+        }
+
+        return shapes;
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    [[maybe_unused]] const auto locale = std::locale::global(std::locale{ "en_US.UTF-8" });
+
+    QCoreApplication application{ argc, argv };
+
+    Bootstrapper::RegisterMetaTypes();
+    Bootstrapper::InitializeLogs("-benchmarks");
+
+#if defined(Q_OS_LINUX)
+    const QString defaultTmpfsRoot = "/dev/shm";
+#else
+    const QString defaultTmpfsRoot;
+#endif // Q_OS_LINUX
+
+    const auto defaultDiskRoot =
+        QString::fromStdString(std::filesystem::temp_directory_path().string());
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Measures the throughput of the scanner against generated directory trees. Every tree is "
+        "scanned once up front to warm the caches, so the results reflect repeat scans, unless "
+        "the caches are dropped before every scan instead. On Linux, every engine is measured "
+        "both with and without stat-ing files in inode order, and the speedup is reported.");
+
+    parser.addHelpOption();
+    parser.addOptions({
+        { "output", "Write the JSON report to <file> instead of to stdout.", "file" },
+        { "tmpfs-root", "Generate tmpfs trees below <directory>; empty to skip.", "directory",
+          defaultTmpfsRoot },
+        { "disk-root", "Generate on-disk trees below <directory>; empty to skip.", "directory",
+          defaultDiskRoot },
+        { "shape", "Only benchmark the <shape> tree; may be repeated.", "shape" },
+        { "iterations", "Scan each tree <count> times per engine.", "count", "3" },
+        { "scale", "Multiply the number of entries in each tree by <factor>.", "factor", "1" },
+        { "drop-caches", "Drop the filesystem caches before every scan; requires root." },
+        { "skip-inode-order", "Don't measure stat-ing files in inode order." },
+    });
+
+    parser.process(application);
+
+    const auto iterations = parser.value("iterations").toUInt();
+    const auto scale = std::max(1u, parser.value("scale").toUInt());
+    const auto shouldDropCaches = parser.isSet("drop-caches");
+
+    std::vector<Benchmarks::Measurement> measurements;
+
+    try {
+        const auto engines = DetermineEngines();
+        const auto statOrders = DetermineStatOrders(parser);
+        const auto shapes = DetermineShapes(parser);
+
+        for (const auto& [medium, parent] : DetermineMedia(parser)) {
+            const auto processId = std::to_string(QCoreApplication::applicationPid());
+            const auto workspace = parent / ("d-viz-benchmark-" + processId);
+
+            for (const auto shape : shapes) {
+                std::cerr << "Generating " << Benchmarks::ToString(shape) << " tree on " << medium
+                          << "...\n";
+
+                const auto tree = Benchmarks::GenerateTree(workspace, shape, scale);
+
+                for (const auto& [engine, createBackend] : engines) {
+                    for (const auto isInodeOrdered : statOrders) {
+                        // The first scan only serves to populate the dentry and inode caches.
+                        if (!shouldDropCaches) {
+                            Benchmarks::MeasureScan(tree, createBackend(isInodeOrdered));
+                        }
+
+                        for (unsigned int iteration = 0; iteration < iterations; ++iteration) {
+                            if (shouldDropCaches && !Benchmarks::DropCaches()) {
+                                throw std::runtime_error{ "Could not drop the filesystem caches." };
+                            }
+
+                            auto measurement =
+                                Benchmarks::MeasureScan(tree, createBackend(isInodeOrdered));
+
+                            measurement.shape = shape;
+                            measurement.medium = medium;
+                            measurement.engine = engine;
+                            measurement.isInodeOrdered = isInodeOrdered;
+                            measurement.iteration = iteration;
+
+                            measurements.emplace_back(std::move(measurement));
+                        }
+                    }
+                }
+
+                std::filesystem::remove_all(tree.root);
+            }
+
+            std::filesystem::remove_all(workspace);
+        }
+    } catch (const std::exception& exception) {
+        std::cerr << exception.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    const auto outputPath = parser.value("output").toStdString();
+    if (outputPath.empty()) {
+        Benchmarks::WriteReport(measurements, std::cout);
+    } else {
+        std::ofstream stream{ outputPath };
+        Benchmarks::WriteReport(measurements, stream);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,264 @@
+#include "scanBenchmark.h"
+
+#include <Model/Scanner/fileSystemBackend.h>
+#include <Model/Scanner/scanningProgress.h>
+#include <Model/Scanner/scanningWorker.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+
+#include <QtGlobal>
+
+#if defined(Q_OS_WIN)
+#include <Windows.h>
+
+#include <Psapi.h>
+#elif defined(Q_OS_LINUX)
+#include <unistd.h>
+#endif // Q_OS_LINUX
+
+namespace
+{
+    /**
+     * @brief Resets the high-water mark of the process's resident set, so that the next reading
+     * reflects only what happens from here on out. Windows offers no way to do so, which means
+     * that the peak reported there covers the lifetime of the process.
+     */
+    void ResetPeakResidentBytes() noexcept
+    {
+#if defined(Q_OS_LINUX)
+        std::ofstream stream{ "/proc/self/clear_refs" };
+        stream << "5";
+#endif // Q_OS_LINUX
+    }
+
+    /**
+     * @returns The largest resident set that the process has had, or zero if that can't be read.
+     */
+    std::uintmax_t GetPeakResidentBytes() noexcept
+    {
+#if defined(Q_OS_WIN)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return 0;
+        }
+
+        return counters.PeakWorkingSetSize;
+#elif defined(Q_OS_LINUX)
+        std::ifstream stream{ "/proc/self/status" };
+
+        std::string line;
+        while (std::getline(stream, line)) {
+            if (line.rfind("VmHWM:", 0) != 0) {
+                continue;
+            }
+
+            std::istringstream fields{ line.substr(6) };
+            std::uintmax_t kibibytes = 0;
+            fields >> kibibytes;
+
+            return kibibytes * 1024;
+        }
+
+        return 0;
+#endif // Q_OS_LINUX
+    }
+
+    double ToSeconds(std::uintmax_t nanoseconds) noexcept
+    {
+        return static_cast<double>(nanoseconds) / 1'000'000'000.0;
+    }
+
+    /**
+     * @brief The average wall-clock time of a group of scans, with and without inode ordering.
+     */
+    struct InodeOrderComparison
+    {
+        double seconds[2] = { 0.0, 0.0 };
+        unsigned int runCount[2] = { 0, 0 };
+    };
+
+    using ComparisonKey = std::tuple<std::string, std::string, std::string>;
+
+    /**
+     * @returns The measurements, grouped by shape, medium, and engine.
+     */
+    std::map<ComparisonKey, InodeOrderComparison>
+    CompareInodeOrder(const std::vector<Benchmarks::Measurement>& measurements)
+    {
+        std::map<ComparisonKey, InodeOrderComparison> comparisons;
+
+        for (const auto& measurement : measurements) {
+            const ComparisonKey key{ std::string{ ToString(measurement.shape) }, measurement.medium,
+                                     measurement.engine };
+
+            auto& comparison = comparisons[key];
+            comparison.seconds[measurement.isInodeOrdered] += measurement.wallSeconds;
+            ++comparison.runCount[measurement.isInodeOrdered];
+        }
+
+        return comparisons;
+    }
+} // namespace
+
+namespace Benchmarks
+{
+    Measurement MeasureScan(
+        const GeneratedTree& tree, std::shared_ptr<const Scanner::FileSystemBackend> backend)
+    {
+        ScanningOptions options;
+        options.path = tree.root;
+        options.backend = std::move(backend);
+
+        ScanningProgress progress;
+        progress.Reset();
+
+        std::atomic<bool> cancellationToken{ false };
+        std::shared_ptr<Tree<VizBlock>> fileTree;
+
+        ResetPeakResidentBytes();
+
+        ScanningWorker worker{ options, progress, cancellationToken };
+
+        // Since the worker runs on the calling thread, the signal is delivered directly.
+        QObject::connect(
+            &worker, &ScanningWorker::Finished,
+            [&](const std::shared_ptr<Tree<VizBlock>>& result) { fileTree = result; });
+
+        const auto startTime = std::chrono::steady_clock::now();
+        worker.Start();
+        const auto stopTime = std::chrono::steady_clock::now();
+
+        Measurement measurement;
+        measurement.wallSeconds = std::chrono::duration<double>(stopTime - startTime).count();
+        measurement.peakResidentBytes = GetPeakResidentBytes();
+        measurement.entryCount = progress.filesScanned.Load() + progress.directoriesScanned.Load();
+        measurement.syscallCount = progress.syscallsIssued.Load();
+        measurement.enumerationSeconds = ToSeconds(progress.enumerationNanoseconds.Load());
+        measurement.propagationSeconds = ToSeconds(progress.propagationNanoseconds.Load());
+        measurement.pruningSeconds = ToSeconds(progress.pruningNanoseconds.Load());
+
+        // A fast scan is worthless if it's wrong.
+        if (!fileTree || progress.filesScanned.Load() != tree.fileCount ||
+            fileTree->GetRoot()->GetData().file.size != tree.totalBytes) {
+            throw std::runtime_error{ "Scan of \"" + tree.root.string() +
+                                      "\" does not match the generated tree." };
+        }
+
+        return measurement;
+    }
+
+    bool DropCaches() noexcept
+    {
+#if defined(Q_OS_LINUX)
+        // Only clean pages can be dropped.
+        ::sync();
+
+        std::ofstream stream{ "/proc/sys/vm/drop_caches" };
+        stream << "3";
+        stream.flush();
+
+        return static_cast<bool>(stream);
+#else
+        return false;
+#endif // Q_OS_LINUX
+    }
+
+    void WriteReport(const std::vector<Measurement>& measurements, std::ostream& stream)
+    {
+        rapidjson::OStreamWrapper streamWrapper{ stream };
+        rapidjson::PrettyWriter<decltype(streamWrapper)> writer{ streamWrapper };
+
+        const auto writeString = [&](const char* key, std::string_view value) {
+            writer.Key(key);
+            writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
+        };
+
+        const auto writeCount = [&](const char* key, std::uintmax_t value) {
+            writer.Key(key);
+            writer.Uint64(value);
+        };
+
+        const auto writeReal = [&](const char* key, double value) {
+            writer.Key(key);
+            writer.Double(value);
+        };
+
+        writer.StartObject();
+        writer.Key("runs");
+        writer.StartArray();
+
+        for (const auto& measurement : measurements) {
+            writer.StartObject();
+
+            writeString("shape", ToString(measurement.shape));
+            writeString("medium", measurement.medium);
+            writeString("engine", measurement.engine);
+            writer.Key("inodeOrder");
+            writer.Bool(measurement.isInodeOrdered);
+            writeCount("iteration", measurement.iteration);
+            writeCount("entries", measurement.entryCount);
+            writeReal("wallSeconds", measurement.wallSeconds);
+
+            const auto entriesPerSecond =
+                measurement.wallSeconds > 0.0
+                    ? static_cast<double>(measurement.entryCount) / measurement.wallSeconds
+                    : 0.0;
+
+            const auto syscallsPerEntry =
+                measurement.entryCount > 0
+                    ? static_cast<double>(measurement.syscallCount) / measurement.entryCount
+                    : 0.0;
+
+            writeReal("entriesPerSecond", entriesPerSecond);
+            writeReal("syscallsPerEntry", syscallsPerEntry);
+
+            writeCount("peakResidentBytes", measurement.peakResidentBytes);
+            writeReal("enumerationSeconds", measurement.enumerationSeconds);
+            writeReal("propagationSeconds", measurement.propagationSeconds);
+            writeReal("pruningSeconds", measurement.pruningSeconds);
+
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+
+        writer.Key("inodeOrderSpeedups");
+        writer.StartArray();
+
+        for (const auto& [key, comparison] : CompareInodeOrder(measurements)) {
+            if (comparison.runCount[false] == 0 || comparison.runCount[true] == 0) {
+                continue;
+            }
+
+            const auto listingOrderSeconds = comparison.seconds[false] / comparison.runCount[false];
+            const auto inodeOrderSeconds = comparison.seconds[true] / comparison.runCount[true];
+            const auto speedup =
+                inodeOrderSeconds > 0.0 ? listingOrderSeconds / inodeOrderSeconds : 0.0;
+
+            writer.StartObject();
+
+            writeString("shape", std::get<0>(key));
+            writeString("medium", std::get<1>(key));
+            writeString("engine", std::get<2>(key));
+            writeReal("listingOrderSeconds", listingOrderSeconds);
+            writeReal("inodeOrderSeconds", inodeOrderSeconds);
+            writeReal("speedup", speedup);
+
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.EndObject();
+
+        stream << '\n';
+    }
+} // namespace Benchmarks
@@ -0,0 +1,74 @@
+#ifndef SCANBENCHMARK_H
+#define SCANBENCHMARK_H
+
+#include "treeGenerator.h"
+
+#include <Model/Scanner/scanningOptions.h>
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Scanner
+{
+    class FileSystemBackend;
+}
+
+namespace Benchmarks
+{
+    /**
+     * @brief The outcome of a single end-to-end scan of a generated tree.
+     */
+    struct Measurement
+    {
+        TreeShape shape = TreeShape::Wide;
+        std::string medium;
+        std::string engine;
+        bool isInodeOrdered = false;
+        unsigned int iteration = 0;
+
+        std::uintmax_t entryCount = 0;
+        std::uintmax_t syscallCount = 0;
+        std::uintmax_t peakResidentBytes = 0;
+
+        double wallSeconds = 0.0;
+
+        // Summed across all scanning threads, and can therefore exceed the wall-clock time.
+        double enumerationSeconds = 0.0;
+        double propagationSeconds = 0.0;
+        double pruningSeconds = 0.0;
+    };
+
+    /**
+     * @brief Runs the `ScanningWorker` against a generated tree from start to finish, on the
+     * calling thread, and checks that it found everything that the generator put there.
+     *
+     * @param[in] tree            The tree to scan.
+     * @param[in] backend         The filesystem backend through which to scan.
+     *
+     * @returns The measurement, with only the fields that describe the scan itself filled in.
+     *
+     * @throws std::runtime_error if the scan did not match the generated tree.
+     */
+    Measurement MeasureScan(
+        const GeneratedTree& tree, std::shared_ptr<const Scanner::FileSystemBackend> backend);
+
+    /**
+     * @brief Evicts the page, dentry, and inode caches, so that the next scan has to go all the way
+     * to the storage device. Only possible on Linux, and only with root privileges.
+     *
+     * @returns True if the caches were dropped.
+     */
+    bool DropCaches() noexcept;
+
+    /**
+     * @brief Serializes the measurements as a JSON document, with a single entry per scan. For
+     * every engine that was measured both with and without stat-ing in inode order, the report
+     * also lists how much faster the inode-ordered scans were on average, per shape and medium.
+     */
+    void WriteReport(const std::vector<Measurement>& measurements, std::ostream& stream);
+} // namespace Benchmarks
+
+#endif // SCANBENCHMARK_H
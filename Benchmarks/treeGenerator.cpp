@@ -0,0 +1,184 @@
+#include "treeGenerator.h"
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace
+{
+    constexpr std::uint64_t Seed = 0x0D15'EA5E'D15E'A5E0;
+
+    constexpr std::array<const char*, 6> Extensions = { ".txt", ".cpp", ".png",
+                                                        ".mp4", ".bin", "" };
+
+    constexpr std::uintmax_t KiB = 1024;
+    constexpr std::uintmax_t MiB = 1024 * KiB;
+    constexpr std::uintmax_t GiB = 1024 * MiB;
+
+    /**
+     * @brief Populates a tree, while keeping track of what went into it.
+     */
+    class TreeBuilder
+    {
+      public:
+        explicit TreeBuilder(Benchmarks::GeneratedTree& tree) : m_tree{ tree }
+        {
+        }
+
+        std::filesystem::path
+        AddDirectory(const std::filesystem::path& parent, std::uintmax_t index)
+        {
+            auto path = parent / ("dir" + std::to_string(index));
+            std::filesystem::create_directory(path);
+
+            ++m_tree.directoryCount;
+            return path;
+        }
+
+        void AddFiles(
+            const std::filesystem::path& directory, std::uintmax_t count,
+            std::uintmax_t minimumSize, std::uintmax_t maximumSize)
+        {
+            for (std::uintmax_t index = 0; index < count; ++index) {
+                const auto random = Next();
+                const auto size = minimumSize + random % (maximumSize - minimumSize + 1);
+
+                const auto path = directory / ("file" + std::to_string(index) +
+                                               Extensions[(random >> 32) % Extensions.size()]);
+
+                std::ofstream stream{ path, std::ios::binary };
+                if (!stream) {
+                    throw std::filesystem::filesystem_error{
+                        "Could not create file", path,
+                        std::make_error_code(std::errc::io_error)
+                    };
+                }
+
+                stream.close();
+                std::filesystem::resize_file(path, size);
+
+                ++m_tree.fileCount;
+                m_tree.totalBytes += size;
+            }
+        }
+
+      private:
+        /**
+         * @returns The next value of a SplitMix64 sequence.
+         */
+        std::uint64_t Next() noexcept
+        {
+            auto value = (m_state += 0x9E3779B97F4A7C15);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+            return value ^ (value >> 31);
+        }
+
+        Benchmarks::GeneratedTree& m_tree;
+        std::uint64_t m_state = Seed;
+    };
+
+    void GenerateWideTree(TreeBuilder& builder, const std::filesystem::path& root, unsigned scale)
+    {
+        for (std::uintmax_t index = 0; index < 2'000u * scale; ++index) {
+            const auto directory = builder.AddDirectory(root, index);
+            builder.AddFiles(directory, 10, 1 * KiB, 64 * KiB);
+        }
+    }
+
+    void GenerateDeepTree(TreeBuilder& builder, const std::filesystem::path& root, unsigned scale)
+    {
+        // Deep enough to stress the propagation of sizes, but still comfortably within the limits
+        // on the length of a path.
+        constexpr std::uintmax_t depth = 256;
+
+        for (std::uintmax_t chain = 0; chain < 16u * scale; ++chain) {
+            auto directory = builder.AddDirectory(root, chain);
+
+            for (std::uintmax_t level = 0; level < depth; ++level) {
+                builder.AddFiles(directory, 2, 1, 16 * KiB);
+                directory = builder.AddDirectory(directory, level);
+            }
+        }
+    }
+
+    void GenerateManyTinyFiles(
+        TreeBuilder& builder, const std::filesystem::path& root, unsigned scale)
+    {
+        for (std::uintmax_t index = 0; index < 100u * scale; ++index) {
+            const auto directory = builder.AddDirectory(root, index);
+            builder.AddFiles(directory, 1'000, 1, 512);
+        }
+    }
+
+    void GenerateFewHugeFiles(
+        TreeBuilder& builder, const std::filesystem::path& root, unsigned scale)
+    {
+        for (std::uintmax_t index = 0; index < 4; ++index) {
+            const auto directory = builder.AddDirectory(root, index);
+            builder.AddFiles(directory, 2u * scale, 1 * GiB, 8 * GiB);
+        }
+    }
+} // namespace
+
+namespace Benchmarks
+{
+    std::string_view ToString(TreeShape shape) noexcept
+    {
+        switch (shape) {
+            case TreeShape::Wide:
+                return "wide";
+            case TreeShape::Deep:
+                return "deep";
+            case TreeShape::ManyTinyFiles:
+                return "many-tiny-files";
+            case TreeShape::FewHugeFiles:
+                return "few-huge-files";
+        }
+
+        return "unknown";
+    }
+
+    std::optional<TreeShape> ParseTreeShape(std::string_view name) noexcept
+    {
+        for (const auto shape : { TreeShape::Wide, TreeShape::Deep, TreeShape::ManyTinyFiles,
+                                  TreeShape::FewHugeFiles }) {
+            if (name == ToString(shape)) {
+                return shape;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    GeneratedTree
+    GenerateTree(const std::filesystem::path& parent, TreeShape shape, unsigned int scale)
+    {
+        GeneratedTree tree;
+        tree.root = parent / std::string{ ToString(shape) };
+
+        std::filesystem::remove_all(tree.root);
+        std::filesystem::create_directories(tree.root);
+
+        TreeBuilder builder{ tree };
+
+        switch (shape) {
+            case TreeShape::Wide:
+                GenerateWideTree(builder, tree.root, scale);
+                break;
+            case TreeShape::Deep:
+                GenerateDeepTree(builder, tree.root, scale);
+                break;
+            case TreeShape::ManyTinyFiles:
+                GenerateManyTinyFiles(builder, tree.root, scale);
+                break;
+            case TreeShape::FewHugeFiles:
+                GenerateFewHugeFiles(builder, tree.root, scale);
+                break;
+        }
+
+        return tree;
+    }
+} // namespace Benchmarks
@@ -0,0 +1,64 @@
+#ifndef TREEGENERATOR_H
+#define TREEGENERATOR_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace Benchmarks
+{
+    /**
+     * @brief The shapes of directory tree that the scanner is benchmarked against. Each one
+     * stresses a different part of the scan.
+     */
+    enum class TreeShape
+    {
+        Wide,          ///< A great many sibling directories, which stresses task distribution.
+        Deep,          ///< Long chains of nested directories, which stresses size propagation.
+        ManyTinyFiles, ///< Directories crammed with small files, which stresses file sizing.
+        FewHugeFiles   ///< A handful of very large files, which isolates the fixed overhead.
+    };
+
+    /**
+     * @returns The name by which the shape is referred to on the command line and in reports.
+     */
+    std::string_view ToString(TreeShape shape) noexcept;
+
+    /**
+     * @returns The shape with the given name, if there is one.
+     */
+    std::optional<TreeShape> ParseTreeShape(std::string_view name) noexcept;
+
+    /**
+     * @brief Describes a tree laid out on disk by `GenerateTree(...)`.
+     */
+    struct GeneratedTree
+    {
+        std::filesystem::path root;
+
+        std::uintmax_t fileCount = 0;
+        std::uintmax_t directoryCount = 0; ///< Excluding the root itself.
+        std::uintmax_t totalBytes = 0;
+    };
+
+    /**
+     * @brief Lays out a directory tree of the given shape below the given directory.
+     *
+     * Names and sizes are derived from a fixed seed, so every run produces the exact same tree.
+     * Files are sized by extending them rather than by writing to them, which means that even the
+     * largest of files take up next to no space on filesystems that support sparse files.
+     *
+     * @param[in] parent          The directory in which to create the tree.
+     * @param[in] shape           The shape of the tree.
+     * @param[in] scale           A multiplier on the number of entries in the tree.
+     *
+     * @returns A description of the generated tree.
+     *
+     * @throws std::filesystem::filesystem_error if the tree could not be created.
+     */
+    GeneratedTree
+    GenerateTree(const std::filesystem::path& parent, TreeShape shape, unsigned int scale);
+} // namespace Benchmarks
+
+#endif // TREEGENERATOR_H
@@ -0,0 +1,28 @@
+include(../defaults.pri)
+
+QT += core gui
+
+TARGET = D-Viz-CLI
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+LIBS += -L$$DESTDIR -lD-Viz
+
+HEADERS += \
+   headlessScanner.h \
+   reportWriter.h
+
+SOURCES += \
+   headlessScanner.cpp \
+   main.cpp \
+   reportWriter.cpp
+
+win32: CONFIG(release, debug|release) {
+    QMAKE_CXXFLAGS += /Zi
+    QMAKE_LFLAGS += /INCREMENTAL:NO /Debug
+}
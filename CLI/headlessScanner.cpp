@@ -0,0 +1,144 @@
+#include "headlessScanner.h"
+
+#include <Model/Scanner/checkpointJournal.h>
+#include <Model/Scanner/scanningProgress.h>
+#include <Model/Scanner/scanningWorker.h>
+#include <constants.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+    /**
+     * @returns The number of scanning threads that each of the concurrent scans may use, such
+     * that, between them, they use as many threads as a single scan would on its own.
+     */
+    unsigned int ShareOutThreads(unsigned int threadLimit, unsigned int jobCount) noexcept
+    {
+        if (threadLimit == 0) {
+            const auto hardwareThreads = std::thread::hardware_concurrency();
+            threadLimit = std::clamp(
+                4 * hardwareThreads, Constants::Concurrency::InitialThreadCount,
+                Constants::Concurrency::MaximumThreadCount);
+        }
+
+        return std::max(1u, threadLimit / jobCount);
+    }
+
+    Cli::ScanOutcome ScanRoot(
+        const std::filesystem::path& root, ScanningOptions options, std::size_t entryLimit,
+        std::atomic<bool>& cancellationToken)
+    {
+        Cli::ScanOutcome outcome;
+        outcome.root = root;
+
+        std::error_code errorCode;
+        if (!std::filesystem::is_directory(root, errorCode)) {
+            outcome.error = errorCode ? errorCode.message() : "Not a directory";
+            return outcome;
+        }
+
+        options.path = root;
+
+        if (!options.checkpointPath.empty()) {
+            options.checkpointPath =
+                Scanner::CheckpointJournal::DeterminePath(options.checkpointPath, root);
+        }
+
+        ScanningProgress progress;
+        progress.Reset();
+
+        std::shared_ptr<Tree<VizBlock>> fileTree;
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        {
+            ScanningWorker worker{ options, progress, cancellationToken };
+
+            // Since the worker runs on the calling thread, the signal is delivered directly.
+            QObject::connect(
+                &worker, &ScanningWorker::Finished,
+                [&](const std::shared_ptr<Tree<VizBlock>>& result) { fileTree = result; });
+
+            worker.Start();
+        }
+
+        if (!fileTree) {
+            outcome.error = "Scan did not complete";
+            return outcome;
+        }
+
+        outcome.report = Summary::Summarize(*fileTree, entryLimit);
+        outcome.elapsedTime = std::chrono::steady_clock::now() - startTime;
+        outcome.activeTime = progress.GetActiveTime();
+        outcome.throttledTime = std::chrono::nanoseconds{ progress.throttledNanoseconds.Load() };
+
+        return outcome;
+    }
+} // namespace
+
+namespace Cli
+{
+    std::vector<ScanOutcome> ScanRoots(
+        const std::vector<std::filesystem::path>& roots, const ScanningOptions& options,
+        unsigned int jobCount, std::size_t entryLimit, std::atomic<bool>& cancellationToken)
+    {
+        std::vector<ScanOutcome> outcomes(roots.size());
+        if (roots.empty()) {
+            return outcomes;
+        }
+
+        jobCount = std::clamp(jobCount, 1u, static_cast<unsigned int>(roots.size()));
+
+        auto jobOptions = options;
+        jobOptions.threadLimit = ShareOutThreads(options.threadLimit, jobCount);
+
+        // Likewise, the operation limit applies to all of the concurrent scans combined.
+        if (options.operationLimit > 0) {
+            jobOptions.operationLimit = std::max(1u, options.operationLimit / jobCount);
+        }
+
+        // Each job claims the next unscanned root until there are none left, so that a job that
+        // happens to draw a small root simply moves on to the next one.
+        std::atomic<std::size_t> nextRoot{ 0 };
+
+        const auto runJob = [&]() noexcept {
+            for (auto index = nextRoot.fetch_add(1); index < roots.size();
+                 index = nextRoot.fetch_add(1)) {
+                if (cancellationToken.load()) {
+                    outcomes[index].root = roots[index];
+                    outcomes[index].error = "Skipped, since the scan was interrupted";
+                    continue;
+                }
+
+                try {
+                    outcomes[index] =
+                        ScanRoot(roots[index], jobOptions, entryLimit, cancellationToken);
+                } catch (const std::exception& exception) {
+                    outcomes[index].root = roots[index];
+                    outcomes[index].error = exception.what();
+                }
+            }
+        };
+
+        std::vector<std::thread> jobs;
+        jobs.reserve(jobCount - 1);
+
+        for (unsigned int job = 1; job < jobCount; ++job) {
+            jobs.emplace_back(runJob);
+        }
+
+        runJob();
+
+        for (auto& job : jobs) {
+            job.join();
+        }
+
+        return outcomes;
+    }
+} // namespace Cli
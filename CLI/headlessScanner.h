@@ -0,0 +1,61 @@
+#ifndef HEADLESSSCANNER_H
+#define HEADLESSSCANNER_H
+
+#include <Model/Scanner/scanningOptions.h>
+#include <Model/scanSummary.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Cli
+{
+    /**
+     * @brief The result of scanning a single root: either a summary of what was found, or the
+     * reason why the root could not be scanned.
+     */
+    struct ScanOutcome
+    {
+        std::filesystem::path root;
+
+        std::optional<Summary::Report> report;
+        std::string error;
+
+        std::chrono::duration<double> elapsedTime{ 0 };
+
+        // Summed across all scanning threads. The throttled time is spent waiting on the operation
+        // limit, and is only ever non-zero if there is one.
+        std::chrono::duration<double> activeTime{ 0 };
+        std::chrono::duration<double> throttledTime{ 0 };
+    };
+
+    /**
+     * @brief Scans each of the given roots, and summarizes the results.
+     *
+     * Several roots are scanned at once, with the scanning threads shared out between them, so
+     * that many small roots keep every core busy just as well as a single large root would. Each
+     * tree is summarized as soon as its scan completes, and is then released, so that only a
+     * handful of trees are ever held in memory at once.
+     *
+     * @param[in] roots           The directories to scan.
+     * @param[in] options         The options to scan each root with. The path is ignored, and the
+     *                            checkpoint path, if any, names the directory in which each root
+     *                            keeps its journal.
+     * @param[in] jobCount        The number of roots to scan at once.
+     * @param[in] entryLimit      The number of directories and files to rank per root.
+     * @param[in] cancellationToken   Once set, every scan in progress stops short, and reports
+     *                            whatever it found up to that point, while the roots that are yet
+     *                            to be scanned are skipped.
+     *
+     * @returns One outcome per root, in the order in which the roots were given.
+     */
+    std::vector<ScanOutcome> ScanRoots(
+        const std::vector<std::filesystem::path>& roots, const ScanningOptions& options,
+        unsigned int jobCount, std::size_t entryLimit, std::atomic<bool>& cancellationToken);
+} // namespace Cli
+
+#endif // HEADLESSSCANNER_H
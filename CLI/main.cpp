@@ -0,0 +1,163 @@
+#include "headlessScanner.h"
+#include "reportWriter.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include <bootstrapper.h>
+#include <constants.h>
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::atomic<bool> cancellationToken{ false };
+
+    /**
+     * @brief Cancels the scans on the first interrupt, so that whatever they found so far can
+     * still be reported, and leaves any further interrupt to terminate the process as usual.
+     */
+    void HandleInterrupt(int /*signal*/)
+    {
+        cancellationToken.store(true);
+        std::signal(SIGINT, SIG_DFL);
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    [[maybe_unused]] const auto locale = std::locale::global(std::locale{ "en_US.UTF-8" });
+
+    QCoreApplication application{ argc, argv };
+
+    Bootstrapper::RegisterMetaTypes();
+    Bootstrapper::InitializeLogs("-cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Scans one or more directories, and reports on the largest directories and files in each "
+        "one, as well as on how much space each type of file takes up.");
+
+    parser.addHelpOption();
+    parser.addPositionalArgument("roots", "The directories to scan.", "<root>...");
+
+    const auto defaultJobCount = std::to_string(std::max(1u, std::thread::hardware_concurrency()));
+
+    parser.addOptions({
+        { "json", "Write the report as JSON." },
+        { "output", "Write the report to <file> instead of to stdout.", "file" },
+        { "top", "Rank the <count> largest directories and files.", "count", "10" },
+        { "jobs", "Scan up to <count> roots at once.", "count",
+          QString::fromStdString(defaultJobCount) },
+        { "threads", "Use at most <count> scanning threads in total.", "count", "0" },
+        { "allocated", "Measure files by the space they occupy on disk." },
+        { "one-file-system", "Skip directories on other filesystems." },
+        { "count-hard-links-once", "Only count the first link to a file." },
+        { "inode-order", "Stat the files in each directory in inode order; faster on HDDs." },
+        { "background", "Scan at the lowest CPU and I/O priority." },
+        { "max-ops", "Issue at most <count> filesystem operations per second.", "count", "0" },
+        { "exclude", "Skip directories whose name, or trailing path, matches <pattern>.",
+          "pattern" },
+        { "exclude-path", "Skip the directory at <path>.", "path" },
+        { "exclude-fs-type", "Skip directories on filesystems of type <type>.", "type" },
+        { "tally-excluded", "Still count the size of skipped directories towards the totals." },
+        { "overview", "Only read down to <depth> in full, and estimate everything below.",
+          "depth", "0" },
+        { "exact", "Read the subtree at <path> in full, even in an overview.", "path" },
+        { "entry-budget", "Estimate every directory found after reading <count> entries.",
+          "count", "0" },
+        { "checkpoint-dir", "Journal each scan to <dir>, and resume unfinished scans from it.",
+          "dir" },
+        { "checkpoint-interval", "Write to the journal every <seconds>.", "seconds", "30" },
+        { "decimal", "Present sizes with decimal rather than binary prefixes." },
+    });
+
+    parser.process(application);
+
+    std::vector<std::filesystem::path> roots;
+    for (const auto& argument : parser.positionalArguments()) {
+        roots.emplace_back(argument.toStdString());
+    }
+
+    if (roots.empty()) {
+        parser.showHelp(EXIT_FAILURE);
+    }
+
+    ScanningOptions options;
+    options.threadLimit = parser.value("threads").toUInt();
+    options.sizeMetric =
+        parser.isSet("allocated") ? FileSizeMetric::Allocated : FileSizeMetric::Apparent;
+    options.shouldStayOnFilesystem = parser.isSet("one-file-system");
+    options.shouldCountHardLinksOnce = parser.isSet("count-hard-links-once");
+    options.shouldStatInInodeOrder = parser.isSet("inode-order");
+    options.shouldRunInBackground = parser.isSet("background");
+    options.operationLimit = parser.value("max-ops").toUInt();
+
+    options.overviewDepth = parser.value("overview").toUInt();
+    options.entryBudget = parser.value("entry-budget").toULongLong();
+
+    options.checkpointPath = parser.value("checkpoint-dir").toStdString();
+    options.checkpointInterval =
+        std::chrono::seconds{ std::max(1u, parser.value("checkpoint-interval").toUInt()) };
+
+    for (const auto& path : parser.values("exact")) {
+        options.exactSubtrees.emplace_back(path.toStdString());
+    }
+
+    auto& exclusionRules = options.exclusionRules;
+    exclusionRules.shouldTallyExcludedDirectories = parser.isSet("tally-excluded");
+
+    for (const auto& pattern : parser.values("exclude")) {
+        exclusionRules.names.emplace_back(pattern.toStdString());
+    }
+
+    for (const auto& path : parser.values("exclude-path")) {
+        exclusionRules.paths.emplace_back(path.toStdString());
+    }
+
+    for (const auto& type : parser.values("exclude-fs-type")) {
+        exclusionRules.filesystemTypes.emplace_back(type.toStdString());
+    }
+
+    std::signal(SIGINT, HandleInterrupt);
+
+    const auto outcomes = Cli::ScanRoots(
+        roots, options, parser.value("jobs").toUInt(), parser.value("top").toUInt(),
+        cancellationToken);
+
+    std::ofstream file;
+    const auto outputPath = parser.value("output").toStdString();
+    if (!outputPath.empty()) {
+        file.open(outputPath);
+        if (!file) {
+            std::cerr << "Could not open \"" << outputPath << "\" for writing.\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto& stream = outputPath.empty() ? std::cout : file;
+
+    if (parser.isSet("json")) {
+        Cli::WriteJson(outcomes, stream);
+    } else {
+        const auto prefix = parser.isSet("decimal") ? Constants::SizePrefix::Decimal
+                                                    : Constants::SizePrefix::Binary;
+
+        Cli::WriteText(outcomes, prefix, stream);
+    }
+
+    // An interrupted scan still reports what it found, but doesn't count as a success.
+    const auto hasFailures =
+        std::any_of(std::begin(outcomes), std::end(outcomes), [](const auto& outcome) {
+            return !outcome.report.has_value() || !outcome.report->isComplete;
+        });
+
+    return hasFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
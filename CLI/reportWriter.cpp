@@ -0,0 +1,191 @@
+#include "reportWriter.h"
+
+#include <Utilities/utilities.h>
+
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+
+#include <spdlog/spdlog.h>
+
+#include <string>
+
+namespace
+{
+    std::string FormatSize(std::uintmax_t size, Constants::SizePrefix prefix)
+    {
+        const auto [prefixedSize, units] = Utilities::ToPrefixedSize(size, prefix);
+        return fmt::format("{:>10.2f}{:<6}", prefixedSize, units);
+    }
+
+    void WriteRanking(
+        const char* heading, const std::vector<Summary::RankedEntry>& entries,
+        Constants::SizePrefix prefix, std::ostream& stream)
+    {
+        if (entries.empty()) {
+            return;
+        }
+
+        stream << '\n' << heading << ":\n";
+
+        for (const auto& entry : entries) {
+            stream << FormatSize(entry.size, prefix) << "  " << entry.path.string();
+
+            if (entry.confidence < 100) {
+                stream << fmt::format(" (estimated, {}% confidence)", entry.confidence);
+            }
+
+            stream << '\n';
+        }
+    }
+
+    template <typename WriterType> void WriteString(const std::string& value, WriterType& writer)
+    {
+        writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.size()));
+    }
+
+    template <typename WriterType>
+    void WriteRankingJson(
+        const char* key, const std::vector<Summary::RankedEntry>& entries, WriterType& writer)
+    {
+        writer.Key(key);
+        writer.StartArray();
+
+        for (const auto& entry : entries) {
+            writer.StartObject();
+            writer.Key("path");
+            WriteString(entry.path.string(), writer);
+            writer.Key("size");
+            writer.Uint64(entry.size);
+            writer.Key("confidence");
+            writer.Uint(entry.confidence);
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+    }
+} // namespace
+
+namespace Cli
+{
+    void WriteText(
+        const std::vector<ScanOutcome>& outcomes, Constants::SizePrefix prefix,
+        std::ostream& stream)
+    {
+        bool isFirst = true;
+
+        for (const auto& outcome : outcomes) {
+            if (!isFirst) {
+                stream << '\n';
+            }
+
+            isFirst = false;
+
+            if (!outcome.report) {
+                stream << outcome.root.string() << ": " << outcome.error << '\n';
+                continue;
+            }
+
+            const auto& report = *outcome.report;
+
+            const auto [totalSize, units] = Utilities::ToPrefixedSize(report.totalSize, prefix);
+            stream << fmt::format(
+                "{}: {:.2f}{} in {:L} files and {:L} directories, scanned in {:.2f} seconds\n",
+                report.root.string(), totalSize, units, report.fileCount, report.directoryCount,
+                outcome.elapsedTime.count());
+
+            if (!report.isComplete) {
+                stream << "Interrupted before the scan could complete; the figures only cover what "
+                          "was scanned up to that point\n";
+            }
+
+            if (outcome.throttledTime.count() > 0) {
+                stream << fmt::format(
+                    "Held back for {:.2f} seconds by the operation limit, against {:.2f} "
+                    "seconds of active scanning\n",
+                    outcome.throttledTime.count(), outcome.activeTime.count());
+            }
+
+            WriteRanking("Largest directories", report.largestDirectories, prefix, stream);
+            WriteRanking("Largest files", report.largestFiles, prefix, stream);
+
+            if (report.extensions.empty()) {
+                continue;
+            }
+
+            stream << "\nFile types:\n";
+
+            for (const auto& tally : report.extensions) {
+                const auto extension =
+                    tally.extension.empty() ? std::string{ "No Extension" } : tally.extension;
+
+                stream << FormatSize(tally.totalSize, prefix)
+                       << fmt::format("{:>12L} files  ", tally.fileCount) << extension << '\n';
+            }
+        }
+    }
+
+    void WriteJson(const std::vector<ScanOutcome>& outcomes, std::ostream& stream)
+    {
+        rapidjson::OStreamWrapper streamWrapper{ stream };
+        rapidjson::PrettyWriter<decltype(streamWrapper)> writer{ streamWrapper };
+
+        writer.StartObject();
+        writer.Key("roots");
+        writer.StartArray();
+
+        for (const auto& outcome : outcomes) {
+            writer.StartObject();
+            writer.Key("root");
+            WriteString(outcome.root.string(), writer);
+
+            if (!outcome.report) {
+                writer.Key("error");
+                WriteString(outcome.error, writer);
+                writer.EndObject();
+                continue;
+            }
+
+            const auto& report = *outcome.report;
+
+            writer.Key("isComplete");
+            writer.Bool(report.isComplete);
+            writer.Key("totalSize");
+            writer.Uint64(report.totalSize);
+            writer.Key("fileCount");
+            writer.Uint64(report.fileCount);
+            writer.Key("directoryCount");
+            writer.Uint64(report.directoryCount);
+            writer.Key("elapsedSeconds");
+            writer.Double(outcome.elapsedTime.count());
+            writer.Key("activeSeconds");
+            writer.Double(outcome.activeTime.count());
+            writer.Key("throttledSeconds");
+            writer.Double(outcome.throttledTime.count());
+
+            WriteRankingJson("largestDirectories", report.largestDirectories, writer);
+            WriteRankingJson("largestFiles", report.largestFiles, writer);
+
+            writer.Key("extensions");
+            writer.StartArray();
+
+            for (const auto& tally : report.extensions) {
+                writer.StartObject();
+                writer.Key("extension");
+                WriteString(tally.extension, writer);
+                writer.Key("totalSize");
+                writer.Uint64(tally.totalSize);
+                writer.Key("fileCount");
+                writer.Uint64(tally.fileCount);
+                writer.EndObject();
+            }
+
+            writer.EndArray();
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.EndObject();
+
+        stream << '\n';
+    }
+} // namespace Cli
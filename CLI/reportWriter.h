@@ -0,0 +1,33 @@
+#ifndef REPORTWRITER_H
+#define REPORTWRITER_H
+
+#include "headlessScanner.h"
+
+#include <constants.h>
+
+#include <ostream>
+#include <vector>
+
+namespace Cli
+{
+    /**
+     * @brief Writes a human-readable report, with a section per root.
+     *
+     * @param[in] outcomes        The outcome of every scan.
+     * @param[in] prefix          The prefix with which to present sizes.
+     * @param[in] stream          The stream to write the report to.
+     */
+    void WriteText(
+        const std::vector<ScanOutcome>& outcomes, Constants::SizePrefix prefix,
+        std::ostream& stream);
+
+    /**
+     * @brief Writes the same report as a JSON document, with all sizes given in bytes.
+     *
+     * @param[in] outcomes        The outcome of every scan.
+     * @param[in] stream          The stream to write the report to.
+     */
+    void WriteJson(const std::vector<ScanOutcome>& outcomes, std::ostream& stream);
+} // namespace Cli
+
+#endif // REPORTWRITER_H
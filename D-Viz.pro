@@ -11,9 +11,13 @@ CONFIG += \
 SUBDIRS += \
    Source \
    Tests \
+   Benchmarks \
+   CLI \
    App \
    Installer
 
 App.depends = Source
 Tests.depends = Source
+Benchmarks.depends = Source
+CLI.depends = Source
 Installer.depends = App
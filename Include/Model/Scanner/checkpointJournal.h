@@ -0,0 +1,167 @@
+#ifndef CHECKPOINTJOURNAL_H
+#define CHECKPOINTJOURNAL_H
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <Tree/Tree.hpp>
+
+#include "Model/vizBlock.h"
+
+enum class FileSizeMetric;
+
+namespace Scanner
+{
+    /**
+     * @brief Keeps a journal of every directory that a scan has read, so that a scan that was
+     * cancelled, or that crashed, can later be resumed rather than started over.
+     *
+     * Each scanning thread encodes the listing of every directory that it reads into one of several
+     * independently locked buffers, which are periodically appended to the journal on disk. Since
+     * the journal is only ever appended to, and since every record carries its own checksum, a
+     * journal that was cut short by a crash loses no more than whatever hadn't been flushed yet.
+     *
+     * A directory whose listing made it into the journal can be carried over by the next scan,
+     * while any subdirectory that wasn't read yet shows up as a placeholder, and will be read
+     * afresh. The journal is restored as the previous tree of an incremental rescan, which also
+     * means that any directory that changed in the meantime will be read again.
+     *
+     * Every scan that resumes from a journal appends a new session to it. Within a session, only
+     * the directories that had to be read again are recorded in full; the listing of a directory
+     * that was carried over is already in the journal.
+     */
+    class CheckpointJournal
+    {
+      public:
+        using DirectoryId = std::size_t;
+
+        static constexpr DirectoryId NoParent = std::numeric_limits<DirectoryId>::max();
+
+        /**
+         * @brief The extension conventionally used for journal files.
+         */
+        static constexpr auto& FileExtension = ".dvizjournal";
+
+        /**
+         * @brief Determines where the journal of a scan of the given root is kept. Every root gets
+         * a journal of its own, so that scanning something else in the meantime doesn't throw away
+         * the progress made on a scan that is yet to be resumed.
+         *
+         * @param[in] directory       The directory that holds the journals.
+         * @param[in] root            The root of the scan.
+         *
+         * @returns The path of the journal file.
+         */
+        static std::filesystem::path
+        DeterminePath(const std::filesystem::path& directory, const std::filesystem::path& root);
+
+        /**
+         * @brief Starts a new session in the journal at the given path.
+         *
+         * @param[in] path            The journal file.
+         * @param[in] root            The root of the scan.
+         * @param[in] sizeMetric      The metric by which the scan sizes its files.
+         * @param[in] intactSize      The size up to which `Restore(...)` found an existing journal
+         *                            to be intact, in order to append to that journal, or zero to
+         *                            start a new one. Anything beyond that size is cut off first.
+         *
+         * @returns True if the journal is ready to be written to.
+         */
+        bool Open(
+            const std::filesystem::path& path, const std::filesystem::path& root,
+            FileSizeMetric sizeMetric, std::uintmax_t intactSize);
+
+        /**
+         * @returns True if the journal was opened successfully, and hasn't been closed since.
+         */
+        bool IsOpen() const noexcept;
+
+        /**
+         * @brief Records the complete listing of a directory that has just been read. Safe to call
+         * from any thread.
+         *
+         * @param[in] id              The directory's identifier, which must be greater than that of
+         *                            its parent.
+         * @param[in] parentId        The parent's identifier, or `NoParent` for the root.
+         * @param[in] directory       The directory, along with its immediate children.
+         */
+        void RecordListing(
+            DirectoryId id, DirectoryId parentId, const Tree<VizBlock>::Node& directory);
+
+        /**
+         * @brief Records that a directory was carried over from the journal unchanged, which
+         * allows any of its subdirectories that are recorded later on to be placed. Safe to call
+         * from any thread.
+         *
+         * @param[in] id              The directory's identifier.
+         * @param[in] parentId        The parent's identifier, or `NoParent` for the root.
+         * @param[in] directory       The directory itself.
+         */
+        void RecordReuse(DirectoryId id, DirectoryId parentId, const FileInfo& directory);
+
+        /**
+         * @brief Appends everything recorded since the last flush to the journal on disk. This
+         * function is not meant to be called from more than one thread at a time.
+         *
+         * @returns True if the records were handed over to the operating system.
+         */
+        bool Flush();
+
+        /**
+         * @brief Flushes and closes the journal.
+         *
+         * @param[in] shouldKeep      Whether to keep the journal around, so that a later scan can
+         *                            resume from it, or to delete it.
+         */
+        void Close(bool shouldKeep);
+
+        /**
+         * @brief Restores the directories recorded in a journal into a tree that can serve as the
+         * previous tree of a rescan.
+         *
+         * @param[in] path            The journal file.
+         * @param[in] root            The root of the scan that is about to resume.
+         * @param[in] sizeMetric      The metric by which that scan sizes its files.
+         * @param[out] intactSize     If given, set to the offset just past the last intact record,
+         *                            which is where the resumed scan should append its session.
+         *
+         * @returns The restored tree, or a null pointer if there is no journal, if the journal
+         * belongs to a different root or metric, or if nothing could be restored from it. Directory
+         * sizes are not restored.
+         */
+        static std::shared_ptr<Tree<VizBlock>> Restore(
+            const std::filesystem::path& path, const std::filesystem::path& root,
+            FileSizeMetric sizeMetric, std::uintmax_t* intactSize = nullptr);
+
+      private:
+        struct Shard
+        {
+            std::mutex mutex;
+            std::string buffer;
+        };
+
+        /**
+         * @brief Frames a single encoded record with its size and checksum, and appends it to the
+         * calling thread's shard.
+         */
+        void Append(const std::string& payload);
+
+        static constexpr std::size_t ShardCount = 64;
+
+        std::array<Shard, ShardCount> m_shards;
+
+        std::filesystem::path m_path;
+        std::ofstream m_stream;
+
+        // Only ever accessed by the thread flushing the journal.
+        std::string m_pendingBytes;
+    };
+} // namespace Scanner
+
+#endif // CHECKPOINTJOURNAL_H
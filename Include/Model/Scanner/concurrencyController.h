@@ -0,0 +1,94 @@
+#ifndef CONCURRENCYCONTROLLER_H
+#define CONCURRENCYCONTROLLER_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Scanner
+{
+    /**
+     * @brief A single measurement of scanning throughput at a given level of concurrency.
+     */
+    struct ThroughputSample
+    {
+        unsigned int threadCount;
+
+        double entriesPerSecond;
+        double latencyInMicroseconds;
+    };
+
+    /**
+     * @brief Decides how many scanning threads should be active, based on the throughput that the
+     * scanner observes while it runs.
+     *
+     * The controller performs a simple hill climb: as long as adding threads buys a meaningful
+     * increase in throughput, more threads are added. Once throughput falls off, or stops
+     * improving, the controller backs off and holds for a while before probing again. If shedding
+     * threads costs nothing in throughput while cutting the per-entry latency, the storage is
+     * assumed to be saturated (as is typical of spinning disks, where extra threads only cause the
+     * heads to thrash), and threads continue to be shed.
+     */
+    class ConcurrencyController
+    {
+      public:
+        /**
+         * @param[in] minimumThreadCount    The fewest number of threads to ever run.
+         * @param[in] maximumThreadCount    The ceiling on the number of threads to run.
+         * @param[in] initialThreadCount    The number of threads to start out with.
+         */
+        ConcurrencyController(
+            unsigned int minimumThreadCount, unsigned int maximumThreadCount,
+            unsigned int initialThreadCount) noexcept;
+
+        /**
+         * @brief Feeds the controller the latest cumulative counters, and decides on the number of
+         * threads that should be active until the next update.
+         *
+         * @param[in] entriesProcessed      The total number of entries processed so far.
+         * @param[in] busyTime              The total time that all threads combined have spent
+         *                                  waiting on the filesystem so far.
+         * @param[in] elapsedTime           The time elapsed since the previous update.
+         *
+         * @returns The number of threads that should be active.
+         */
+        unsigned int Update(
+            std::uintmax_t entriesProcessed, std::chrono::nanoseconds busyTime,
+            std::chrono::nanoseconds elapsedTime) noexcept;
+
+        /**
+         * @returns The number of threads that should currently be active.
+         */
+        unsigned int GetThreadCount() const noexcept;
+
+        /**
+         * @returns Every sample taken so far, in order. Together, these trace out the throughput
+         * curve of the storage being scanned.
+         */
+        const std::vector<ThroughputSample>& GetSamples() const noexcept;
+
+      private:
+        unsigned int ComputeStepSize() const noexcept;
+
+        void Step(int direction) noexcept;
+
+        void Revert(unsigned int threadCount) noexcept;
+
+        unsigned int m_minimumThreadCount;
+        unsigned int m_maximumThreadCount;
+        unsigned int m_threadCount;
+
+        unsigned int m_samplesSinceLastChange = 0;
+
+        bool m_isReverting = false;
+
+        int m_probeDirection = 1;
+
+        std::uintmax_t m_previousEntriesProcessed = 0;
+        std::chrono::nanoseconds m_previousBusyTime{ 0 };
+
+        std::vector<ThroughputSample> m_samples;
+    };
+} // namespace Scanner
+
+#endif // CONCURRENCYCONTROLLER_H
@@ -0,0 +1,65 @@
+#ifndef CONCURRENTINODESET_H
+#define CONCURRENTINODESET_H
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+
+namespace Scanner
+{
+    /**
+     * @brief A thread-safe set of `(device, inode)` pairs, used to make sure that a file that is
+     * reachable through multiple hard links is only ever counted once.
+     *
+     * The set is split into a number of independently locked shards, so that scanning threads will
+     * rarely end up contending for the same lock.
+     */
+    class ConcurrentInodeSet
+    {
+      public:
+        /**
+         * @brief Records the given file.
+         *
+         * @param[in] device          The device on which the file resides.
+         * @param[in] inode           The file's inode number on that device.
+         *
+         * @returns True if the file had not been seen before.
+         */
+        bool Insert(std::uint64_t device, std::uint64_t inode);
+
+        /**
+         * @returns The number of files recorded so far.
+         */
+        std::size_t Size() const;
+
+      private:
+        struct Key
+        {
+            std::uint64_t device;
+            std::uint64_t inode;
+
+            bool operator==(const Key& other) const noexcept
+            {
+                return device == other.device && inode == other.inode;
+            }
+        };
+
+        struct KeyHasher
+        {
+            std::size_t operator()(const Key& key) const noexcept;
+        };
+
+        struct Shard
+        {
+            mutable std::mutex mutex;
+            std::unordered_set<Key, KeyHasher> keys;
+        };
+
+        static constexpr std::size_t ShardCount = 64;
+
+        std::array<Shard, ShardCount> m_shards;
+    };
+} // namespace Scanner
+
+#endif // CONCURRENTINODESET_H
@@ -56,6 +56,15 @@ class DriveScanner final : public QObject
      */
     void HandleCompletion(const std::shared_ptr<Tree<VizBlock>>& fileTree);
 
+    /**
+     * @brief Handles the ScanningWorker::PartialResults signal.
+     *
+     * @see ScanningWorker::PartialResults
+     *
+     * @param[in] fileTree        A snapshot of the drive scanned so far.
+     */
+    void HandlePartialResults(const std::shared_ptr<Tree<VizBlock>>& fileTree);
+
     /**
      * @brief Handle the ScanningWorker::ProgressUpdate signal.
      *
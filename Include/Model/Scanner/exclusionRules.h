@@ -0,0 +1,160 @@
+#ifndef EXCLUSIONRULES_H
+#define EXCLUSIONRULES_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Scanner
+{
+    /**
+     * @brief The rules that decide which directories the scanner should not enter at all.
+     */
+    struct ExclusionRules
+    {
+        // Glob patterns, such as "node_modules" or "*.cache", that are matched against the name of
+        // each directory. A "*" matches any run of characters, a "?" matches any single character,
+        // and a "[...]" matches any one of the enclosed characters or ranges. A pattern that spans
+        // several components, such as ".git/objects", only excludes the directories whose path ends
+        // in components that match, one by one, so that a rule can single out a directory by what
+        // it's nested in.
+        std::vector<std::string> names;
+
+        // Directories to exclude along with everything below them. Relative paths are taken to be
+        // relative to the scan root.
+        std::vector<std::filesystem::path> paths;
+
+        // Filesystem types, such as "nfs" or "fuse.sshfs", whose mount points should be excluded.
+        // Only honoured on Linux, where the mount table tells us which type each mount point has.
+        std::vector<std::string> filesystemTypes;
+
+        // If set, every excluded directory still shows up as a single node that is sized by
+        // everything below it, so that the totals still add up. Otherwise, excluded directories
+        // are left out entirely, and their contents are never even listed.
+        bool shouldTallyExcludedDirectories = false;
+
+        /**
+         * @returns True if there are no rules that could exclude anything.
+         */
+        bool IsEmpty() const noexcept
+        {
+            return names.empty() && paths.empty() && filesystemTypes.empty();
+        }
+    };
+
+    /**
+     * @brief The name and path rules, compiled into a form that can be checked for every single
+     * directory without slowing the scan down.
+     *
+     * Names without wildcards are looked up in a hash set, so that only the actual glob patterns
+     * need to be matched one by one, and names that span several components are only matched
+     * against the path once their last component matches. Paths are resolved against the scan root up front, and then
+     * spelled exactly the way that the scanner spells the paths that it builds, which reduces
+     * matching them to a hash set lookup as well. Since an excluded directory is never entered,
+     * there is no need to also check for any of the directories below it.
+     */
+    class ExclusionMatcher
+    {
+      public:
+        ExclusionMatcher() = default;
+
+        /**
+         * @param[in] rules           The rules to compile. Filesystem types are not handled here,
+         *                            since they have to be resolved into mount points first.
+         * @param[in] scanRoot        The path from which the scan starts, spelled exactly as the
+         *                            scanner will spell it.
+         */
+        ExclusionMatcher(const ExclusionRules& rules, const std::filesystem::path& scanRoot);
+
+        /**
+         * @returns True if the matcher could never exclude anything.
+         */
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @param[in] parent          The path to the directory being read.
+         * @param[in] name            The name of one of its subdirectories.
+         *
+         * @returns True if the subdirectory should not be scanned.
+         */
+        bool IsExcluded(const std::filesystem::path& parent, const std::string& name) const;
+
+        /**
+         * @brief Does the same as `IsExcluded(...)`, except that the path to the directory being
+         * read is only worked out if need be.
+         *
+         * @param[in] name            The name of a subdirectory of the directory being read.
+         * @param[in] resolveParent   Supplies the path to the directory being read. Since a rule
+         *                            that spans several components can only apply if its last
+         *                            component matches the name, this is rarely called.
+         *
+         * @returns True if the subdirectory should not be scanned.
+         */
+        template <typename PathResolverType>
+        bool IsExcludedLazily(const std::string& name, const PathResolverType& resolveParent) const
+        {
+            if (IsExcludedByName(name)) {
+                return true;
+            }
+
+            const auto isPathCandidate = m_pathNames.count(name) > 0;
+            const auto isTrailingPathCandidate =
+                m_hasTrailingNamePatterns || m_trailingNames.count(name) > 0;
+
+            if (!isPathCandidate && !isTrailingPathCandidate) {
+                return false;
+            }
+
+            const auto& parent = resolveParent();
+            if (isPathCandidate && m_paths.count((parent / name).string()) > 0) {
+                return true;
+            }
+
+            return isTrailingPathCandidate && IsExcludedByTrailingPath(parent, name);
+        }
+
+        /**
+         * @brief Matches a name against a single glob pattern.
+         *
+         * @param[in] pattern         The pattern, in the syntax described by ExclusionRules.
+         * @param[in] name            The name to match.
+         *
+         * @returns True if the pattern matches the entire name.
+         */
+        static bool MatchesGlob(std::string_view pattern, std::string_view name) noexcept;
+
+      private:
+        /**
+         * @returns True if a subdirectory by the given name should not be scanned, regardless of
+         * where it resides.
+         */
+        bool IsExcludedByName(const std::string& name) const;
+
+        /**
+         * @returns True if a subdirectory by the given name should not be scanned, because the
+         * path to the directory being read ends in the components that a name rule calls for.
+         */
+        bool IsExcludedByTrailingPath(
+            const std::filesystem::path& parent, const std::string& name) const;
+
+        std::unordered_set<std::string> m_literalNames;
+        std::vector<std::string> m_namePatterns;
+
+        // The name rules that span several components, split into their components.
+        std::vector<std::vector<std::string>> m_trailingPatterns;
+
+        // The last component of every rule that spans several components, unless it's a glob
+        // pattern, in which case any name could match, and the flag is set instead.
+        std::unordered_set<std::string> m_trailingNames;
+        bool m_hasTrailingNamePatterns = false;
+
+        std::unordered_set<std::string> m_paths;
+
+        // The last component of every path, which rules out most directories by name alone.
+        std::unordered_set<std::string> m_pathNames;
+    };
+} // namespace Scanner
+
+#endif // EXCLUSIONRULES_H
@@ -4,12 +4,17 @@
 #include <cstdint>
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Model/Scanner/nameArena.h"
 
 /**
  * @brief Represents the three basic file types: non-directory files,
  * directories, and symbolic links (which includes reparse points on Windows).
  */
-enum class FileType
+enum class FileType : std::uint8_t
 {
     Regular,
     Directory,
@@ -18,31 +23,106 @@ enum class FileType
 
 /**
  * @brief A wrapper around various pieces of file metadata.
+ *
+ * Since a tree may well hold tens of millions of these, the name is kept in an arena and the
+ * extension in an interning table, which keeps the struct itself small and trivially copyable.
  */
 struct FileInfo
 {
     FileInfo() = default;
 
-    FileInfo(const std::filesystem::path& path, std::uintmax_t size, FileType type) noexcept
-        : name{ path.filename().stem().string() },
-          extension{ path.extension().string() },
-          size{ size },
-          type{ type }
+    FileInfo(
+        Scanner::ArenaName name, Scanner::Extension extension, std::uintmax_t size,
+        FileType type) noexcept
+        : name{ name }, extension{ extension }, type{ type }, size{ size }
+    {
+    }
+
+    /**
+     * @brief Stores the name of the given path in the shared arena. Meant for files that are
+     * discovered outside of a scan.
+     */
+    FileInfo(const std::filesystem::path& path, std::uintmax_t size, FileType type)
+        : FileInfo{
+              Scanner::StoreFileName(
+                  path.filename().string(), *Scanner::NameArena::GetSharedArena()),
+              size, type
+          }
+    {
+    }
+
+    /**
+     * @brief Stores the given name in the shared arena. Meant for files that are discovered
+     * outside of a scan.
+     */
+    FileInfo(std::string_view name, std::string_view extension, std::uintmax_t size, FileType type)
+        : FileInfo{
+              Scanner::StoreFileName(name, extension, *Scanner::NameArena::GetSharedArena()), size,
+              type
+          }
+    {
+    }
+
+    FileInfo(
+        std::pair<Scanner::ArenaName, Scanner::Extension> fileName, std::uintmax_t size,
+        FileType type) noexcept
+        : FileInfo{ fileName.first, fileName.second, size, type }
+    {
+    }
+
+    /**
+     * @returns The name of the file, along with its extension.
+     */
+    std::string GetFullName() const
     {
+        std::string fullName;
+        fullName.reserve(name.size() + extension.size());
+        fullName.append(name.View()).append(extension.View());
+
+        return fullName;
     }
 
-    FileInfo(std::string name, std::string extension, std::uintmax_t size, FileType type) noexcept
-        : name{ std::move(name) }, extension{ std::move(extension) }, size{ size }, type{ type }
+    /**
+     * @returns True if the size is an estimate, rather than a measurement.
+     */
+    bool IsEstimate() const noexcept
     {
+        return confidence < 100;
     }
 
-    std::string name;
-    std::string extension;
+    Scanner::ArenaName name;
+    Scanner::Extension extension;
 
     std::uint32_t identifier = 0;
+    FileType type = FileType::Regular;
+
+    // Set on a directory that was excluded from the scan, but that was kept around as a single
+    // node in order to account for the space taken up by everything below it.
+    bool isExcluded = false;
+
+    // Set on a directory whose contents were never read, because its size was estimated instead.
+    // Such a directory is kept as a leaf, and can be expanded later on by scanning it separately.
+    bool isUnexpanded = false;
+
+    // Set on a directory that a cancelled scan never got to read in full, whether it was the
+    // directory itself or something below it that was left unread. Its size only accounts for
+    // what was read. Since the flag is passed on to every ancestor, the root of a cancelled scan
+    // always carries it.
+    bool isIncomplete = false;
+
+    // How sure we are of the size, as a percentage. Anything short of certainty marks a directory
+    // whose subtree was sized by sampling it, rather than by reading it in full.
+    std::uint8_t confidence = 100;
+
     std::uintmax_t size = 0;
 
-    FileType type = FileType::Regular;
+    // Only meaningful for directories: a fingerprint of the directory's modification and change
+    // times at the moment that it was read, which allows a later scan to tell whether the
+    // directory's listing may have changed since. Zero means that nothing is known, and that the
+    // directory will have to be read again.
+    std::uint64_t changeStamp = 0;
 };
 
+static_assert(std::is_trivially_copyable_v<FileInfo>);
+
 #endif // FILEINFO_H
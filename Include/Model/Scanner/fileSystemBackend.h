@@ -0,0 +1,160 @@
+#ifndef FILESYSTEMBACKEND_H
+#define FILESYSTEMBACKEND_H
+
+#include "Model/Scanner/fileInfo.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Scanner
+{
+    /**
+     * @brief The metadata that a single stat call yields for a regular file.
+     */
+    struct FileMetadata
+    {
+        std::uintmax_t size = 0;
+        std::uintmax_t allocatedSize = 0;
+
+        std::uint64_t device = 0;
+        std::uint64_t inode = 0;
+        std::uint64_t linkCount = 1;
+    };
+
+    /**
+     * @brief A single directory entry, as classified by whatever the filesystem reports alongside
+     * the name of the entry.
+     */
+    struct DirectoryEntry
+    {
+        std::string name;
+        std::uint64_t inode = 0;
+
+        FileType type = FileType::Regular;
+
+        // Filled in for every regular file by the time that a backend hands the entry back, unless
+        // the read was cancelled before the file could be sized. While a directory is still being
+        // read, it is only filled in for those entries that had to be stat-ed in order to be
+        // classified.
+        std::optional<FileMetadata> metadata;
+    };
+
+    /**
+     * @brief The system calls that went into reading a directory, along with an estimate of how
+     * many additional calls a purely path-based scan would have needed to arrive at the same
+     * result.
+     */
+    struct SystemCallTally
+    {
+        std::uintmax_t issued = 0;
+        std::uintmax_t avoided = 0;
+    };
+
+    /**
+     * @brief Supplies the full path to a directory, for the cases in which there's no way around
+     * having one.
+     */
+    using PathResolver = std::function<std::filesystem::path()>;
+
+    /**
+     * @brief A directory that has been opened for reading, relative to which its subdirectories
+     * can then be opened in turn.
+     */
+    class DirectoryHandle
+    {
+      public:
+        virtual ~DirectoryHandle() noexcept = default;
+
+        /**
+         * @brief Reads the immediate contents of the directory.
+         *
+         * A backend that can stop partway through a large directory does so once the token is
+         * set, in which case it returns false, and leaves the metadata of any file that it didn't
+         * get around to sizing empty. Backends that can't stop partway through ignore the token.
+         *
+         * @param[out] entries        The entries found in the directory.
+         * @param[out] tally          The system calls that went into reading the directory.
+         * @param[in] cancellationToken   Set once the scan has been cancelled.
+         *
+         * @see FileSystemBackend::ReadDirectory
+         */
+        virtual bool ReadEntries(
+            std::vector<DirectoryEntry>& entries, SystemCallTally& tally,
+            const std::atomic<bool>& cancellationToken) noexcept = 0;
+
+        /**
+         * @see FileSystemBackend::ComputeChangeStamp
+         */
+        virtual std::uint64_t ComputeChangeStamp() const noexcept = 0;
+    };
+
+    /**
+     * @brief The interface through which the scanner enumerates and sizes the filesystem.
+     *
+     * The scanner calls into its backend from all of its threads at once, so every implementation
+     * must be safe to call concurrently.
+     */
+    class FileSystemBackend
+    {
+      public:
+        virtual ~FileSystemBackend() noexcept = default;
+
+        /**
+         * @returns True if the path refers to a directory that can be read.
+         */
+        virtual bool IsDirectory(const std::filesystem::path& path) const noexcept = 0;
+
+        /**
+         * @brief Reads the immediate contents of a single directory. Entries other than regular
+         * files, directories, and symlinks are left out, as are the "." and ".." entries. Symlinks
+         * and reparse points, which the scanner never follows, are both reported as symlinks.
+         *
+         * @param[in] path            The directory to read.
+         * @param[out] entries        The entries found in the directory, with every regular file's
+         *                            metadata filled in.
+         * @param[out] tally          The system calls that went into reading the directory.
+         *
+         * @returns False if an error was encountered before the end of the directory was reached.
+         * Whatever was read up to that point is still returned.
+         */
+        virtual bool ReadDirectory(
+            const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+            SystemCallTally& tally) const noexcept = 0;
+
+        /**
+         * @returns A fingerprint that changes whenever an entry is added to, removed from, or
+         * renamed within the directory, or zero if the directory is inaccessible.
+         *
+         * @see FileInfo::changeStamp
+         */
+        virtual std::uint64_t
+        ComputeChangeStamp(const std::filesystem::path& path) const noexcept = 0;
+
+        /**
+         * @brief Opens a directory for reading, preferably relative to its parent, so that the
+         * directory's full path need not be resolved all over again.
+         *
+         * The default implementation always resolves the full path, and then reads the directory
+         * through the path-based functions above.
+         *
+         * @param[in] parent          The parent directory, as opened by this same backend, or a
+         *                            null pointer if the parent isn't open.
+         * @param[in] name            The name of the directory within its parent.
+         * @param[in] resolvePath     Supplies the full path to the directory. Only called if the
+         *                            directory can't be opened relative to its parent.
+         *
+         * @returns The opened directory, or a null pointer if it couldn't be opened.
+         */
+        virtual std::unique_ptr<DirectoryHandle> OpenDirectory(
+            const DirectoryHandle* parent, const std::string& name,
+            const PathResolver& resolvePath) const noexcept;
+    };
+} // namespace Scanner
+
+#endif // FILESYSTEMBACKEND_H
@@ -0,0 +1,125 @@
+#ifndef LINUXDIRECTORYREADER_H
+#define LINUXDIRECTORYREADER_H
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include "Model/Scanner/fileSystemBackend.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Scanner
+{
+    class StatxRing;
+
+    /**
+     * @brief Enumerates a single directory using raw `getdents64(...)` calls, and uses the open
+     * directory descriptor to stat the entries relative to it.
+     *
+     * Unlike the `std::filesystem` functions, this reader never needs to stat an entry in order to
+     * figure out whether it's a file, a directory, or a symlink. As a result, the only stat call
+     * that is still needed is the one that retrieves the size of a regular file.
+     */
+    class DirectoryReader
+    {
+      public:
+        /**
+         * @brief Opens the directory at the given path.
+         *
+         * @param[in] path            The directory to read.
+         */
+        explicit DirectoryReader(const std::filesystem::path& path) noexcept;
+
+        /**
+         * @brief Opens a subdirectory of a directory that is already open, which spares the kernel
+         * from resolving the subdirectory's full path. Symlinks are not followed.
+         *
+         * @param[in] parentDescriptor    The open parent directory.
+         * @param[in] name                The name of the subdirectory within its parent.
+         */
+        DirectoryReader(int parentDescriptor, const std::string& name) noexcept;
+
+        ~DirectoryReader() noexcept;
+
+        DirectoryReader(const DirectoryReader&) = delete;
+        DirectoryReader& operator=(const DirectoryReader&) = delete;
+
+        DirectoryReader(DirectoryReader&&) = delete;
+        DirectoryReader& operator=(DirectoryReader&&) = delete;
+
+        /**
+         * @returns True if the directory was successfully opened.
+         */
+        bool IsOpen() const noexcept;
+
+        /**
+         * @brief Reads all entries in the directory. The "." and ".." entries are skipped, as are
+         * any entries that are neither regular files, directories, nor symlinks.
+         *
+         * @param[out] entries        The entries found in the directory.
+         * @param[in] cancellationToken   Checked between batches of entries. Once set, reading
+         *                            stops, and whatever was read so far is kept.
+         *
+         * @returns False if an error was encountered, or if reading was cancelled, before the end
+         * of the directory was reached.
+         */
+        bool ReadEntries(
+            std::vector<DirectoryEntry>& entries,
+            const std::atomic<bool>& cancellationToken) noexcept;
+
+        /**
+         * @brief Retrieves the metadata of a regular file using a single `fstatat(...)` call
+         * relative to the open directory.
+         *
+         * @param[in] name            The name of a file inside of the directory.
+         *
+         * @returns The metadata of the file if it's accessible, and zeroed sizes otherwise.
+         */
+        FileMetadata ComputeFileMetadata(const std::string& name) noexcept;
+
+        /**
+         * @brief Retrieves the metadata of all regular files that haven't been stat-ed yet by
+         * submitting batches of asynchronous `statx(...)` requests to the given ring.
+         *
+         * @param[in, out] entries    The entries, as read by `ReadEntries(...)`.
+         * @param[in] ring            The ring through which to submit the requests.
+         * @param[in] cancellationToken   Checked between batches. Once set, no further batches are
+         *                            submitted.
+         */
+        void ComputeFileSizes(
+            std::vector<DirectoryEntry>& entries, StatxRing& ring,
+            const std::atomic<bool>& cancellationToken) noexcept;
+
+        /**
+         * @returns The change stamp of the open directory, or zero if the directory isn't open.
+         *
+         * @see ComputeChangeStamp
+         */
+        std::uint64_t ComputeChangeStamp() const noexcept;
+
+        /**
+         * @returns The descriptor of the open directory, or -1 if the directory isn't open.
+         */
+        int GetDescriptor() const noexcept;
+
+        /**
+         * @returns The number of system calls issued by this reader so far, including the ones
+         * needed to open and close the directory.
+         */
+        std::uintmax_t GetSyscallCount() const noexcept;
+
+      private:
+        int m_descriptor = -1;
+
+        std::uintmax_t m_syscallCount = 0;
+    };
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
+
+#endif // LINUXDIRECTORYREADER_H
@@ -0,0 +1,73 @@
+#ifndef LINUXFILESYSTEMBACKEND_H
+#define LINUXFILESYSTEMBACKEND_H
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include "Model/Scanner/fileSystemBackend.h"
+#include "Model/Scanner/scanningOptions.h"
+
+namespace Scanner
+{
+    /**
+     * @brief Reads the actual filesystem, using raw `getdents64(...)` calls to enumerate each
+     * directory, and either individual `fstatat(...)` calls or batches of io_uring requests to size
+     * the files in it.
+     */
+    class LinuxFileSystemBackend final : public FileSystemBackend
+    {
+      public:
+        /**
+         * @brief Sets up the backend. If the io_uring engine was requested, but the kernel doesn't
+         * support it, then the thread pool engine will be used instead.
+         *
+         * @param[in] engine          The engine with which to size files.
+         * @param[in] shouldStatInInodeOrder  Whether to size the files in each directory in inode
+         *                            order, rather than in the order in which they're listed.
+         */
+        explicit LinuxFileSystemBackend(
+            ScanningEngine engine, bool shouldStatInInodeOrder = false) noexcept;
+
+        /**
+         * @returns The engine that is actually in use.
+         */
+        ScanningEngine GetEngine() const noexcept;
+
+        /**
+         * @copydoc FileSystemBackend::IsDirectory
+         */
+        bool IsDirectory(const std::filesystem::path& path) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ReadDirectory
+         */
+        bool ReadDirectory(
+            const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+            SystemCallTally& tally) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ComputeChangeStamp
+         */
+        std::uint64_t ComputeChangeStamp(const std::filesystem::path& path) const noexcept override;
+
+        /**
+         * @brief Opens a directory with a single `openat(...)` call relative to its parent, if the
+         * parent is open. The open directory's descriptor then also serves to compute its change
+         * stamp, and to stat the files in it.
+         *
+         * @copydoc FileSystemBackend::OpenDirectory
+         */
+        std::unique_ptr<DirectoryHandle> OpenDirectory(
+            const DirectoryHandle* parent, const std::string& name,
+            const PathResolver& resolvePath) const noexcept override;
+
+      private:
+        ScanningEngine m_engine = ScanningEngine::ThreadPool;
+        bool m_shouldStatInInodeOrder = false;
+    };
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
+
+#endif // LINUXFILESYSTEMBACKEND_H
@@ -0,0 +1,89 @@
+#ifndef LINUXMOUNTTABLE_H
+#define LINUXMOUNTTABLE_H
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Scanner
+{
+    /**
+     * @brief A single entry from the kernel's mount table.
+     */
+    struct MountPoint
+    {
+        std::string path;
+        std::string filesystemType;
+
+        std::uint64_t device = 0;
+    };
+
+    /**
+     * @brief A snapshot of the mount points on the system, as described by `/proc/self/mountinfo`.
+     *
+     * Reading the mount table once, up front, allows the scanner to recognize filesystem
+     * boundaries without ever having to stat, let alone open, the mount points themselves. That
+     * matters, since merely touching a stale network mount can hang indefinitely.
+     */
+    class MountTable
+    {
+      public:
+        MountTable() = default;
+
+        /**
+         * @brief Parses a mount table in the format of `/proc/self/mountinfo`.
+         *
+         * @param[in] mountInfo       The stream to parse.
+         */
+        explicit MountTable(std::istream& mountInfo);
+
+        /**
+         * @brief Loads the mount table of the current process.
+         *
+         * @returns The mount table, which will be empty if it couldn't be read.
+         */
+        static MountTable LoadFromSystem();
+
+        /**
+         * @returns The mount point whose root is the given absolute path, or a null pointer if
+         * nothing is mounted there.
+         */
+        const MountPoint* Find(const std::string& path) const noexcept;
+
+        /**
+         * @returns The mount point of the filesystem that holds the given absolute path, or a null
+         * pointer if the table is empty.
+         */
+        const MountPoint* FindContaining(const std::filesystem::path& path) const noexcept;
+
+        /**
+         * @returns Every mount point that lies strictly below the given absolute path.
+         */
+        std::vector<MountPoint> FindBelow(const std::filesystem::path& path) const;
+
+        /**
+         * @returns True if no mount points were found.
+         */
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @returns True if the given filesystem type exposes kernel state rather than stored data,
+         * as is the case for `/proc` and `/sys`, for instance.
+         */
+        static bool IsPseudoFilesystem(const std::string& filesystemType) noexcept;
+
+      private:
+        std::unordered_map<std::string, MountPoint> m_mountPoints;
+    };
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
+
+#endif // LINUXMOUNTTABLE_H
@@ -0,0 +1,123 @@
+#ifndef LINUXSTATXRING_H
+#define LINUXSTATXRING_H
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include "Model/Scanner/linuxDirectoryReader.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+struct statx;
+
+namespace Scanner
+{
+    /**
+     * @brief A minimal io_uring submission and completion ring, driven through the raw system
+     * calls, that is used to retrieve file sizes in large batches of `IORING_OP_STATX` requests.
+     *
+     * Where a blocking scan has at most one stat call in flight per thread, a single ring can keep
+     * hundreds of them in flight at once, which goes a long way towards keeping the queues of fast
+     * storage devices busy, and towards hiding the latency of slow storage.
+     */
+    class StatxRing
+    {
+      public:
+        /**
+         * @brief Sets up a new ring. Check `IsAvailable()` afterwards, since the kernel may either
+         * not support io_uring at all, or it may have been disabled.
+         *
+         * @param[in] depth           The maximum number of requests to keep in flight.
+         */
+        explicit StatxRing(unsigned int depth) noexcept;
+
+        ~StatxRing() noexcept;
+
+        StatxRing(const StatxRing&) = delete;
+        StatxRing& operator=(const StatxRing&) = delete;
+
+        StatxRing(StatxRing&&) = delete;
+        StatxRing& operator=(StatxRing&&) = delete;
+
+        /**
+         * @returns True if the ring was successfully set up, and supports `IORING_OP_STATX`.
+         */
+        bool IsAvailable() const noexcept;
+
+        /**
+         * @brief Fills in the metadata of every regular file in the given list of entries that
+         * hasn't been stat-ed yet. Any file that the ring fails to stat is left unsized, so that
+         * the caller can stat it by other means.
+         *
+         * @param[in] directoryDescriptor  An open descriptor to the directory holding the entries.
+         * @param[in, out] entries         The entries to be sized.
+         * @param[in] cancellationToken    Checked between batches. Once set, no further batches
+         *                                 are submitted, and the remaining files are left unsized.
+         *
+         * @returns The number of system calls that were issued.
+         */
+        std::uintmax_t ComputeFileSizes(
+            int directoryDescriptor, std::vector<DirectoryEntry>& entries,
+            const std::atomic<bool>& cancellationToken) noexcept;
+
+      private:
+        /**
+         * @brief Stops using the ring after an unrecoverable error, but only once the requests
+         * that are still in flight have finished with the buffers that they refer to.
+         *
+         * @param[in] inFlightCount   The number of requests handed to the kernel that have yet
+         *                            to complete.
+         *
+         * @returns The number of system calls that were issued.
+         */
+        std::uintmax_t Abandon(unsigned int inFlightCount) noexcept;
+
+        /**
+         * @brief Unmaps and closes the ring.
+         */
+        void TearDown() noexcept;
+
+        io_uring_sqe* GetSubmissionEntry(unsigned int index) noexcept;
+        io_uring_cqe* GetCompletionEntry(unsigned int index) noexcept;
+
+        bool IsStatxSupported() noexcept;
+
+        int m_descriptor = -1;
+
+        unsigned int m_depth = 0;
+
+        void* m_submissionRing = nullptr;
+        std::size_t m_submissionRingSize = 0;
+
+        void* m_completionRing = nullptr;
+        std::size_t m_completionRingSize = 0;
+
+        void* m_submissionEntries = nullptr;
+        std::size_t m_submissionEntriesSize = 0;
+
+        unsigned int* m_submissionTail = nullptr;
+        unsigned int* m_submissionMask = nullptr;
+        unsigned int* m_submissionArray = nullptr;
+
+        unsigned int* m_completionHead = nullptr;
+        unsigned int* m_completionTail = nullptr;
+        unsigned int* m_completionMask = nullptr;
+        io_uring_cqe* m_completionEntries = nullptr;
+
+        // The buffers that the requests in flight read their names from, and write their results
+        // to.
+        std::vector<char> m_names;
+        std::vector<struct statx> m_results;
+
+        bool m_isAvailable = false;
+    };
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
+
+#endif // LINUXSTATXRING_H
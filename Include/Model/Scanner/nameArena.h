@@ -0,0 +1,319 @@
+#ifndef NAMEARENA_H
+#define NAMEARENA_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+template <typename T> class Tree;
+class VizBlock;
+
+namespace Scanner
+{
+    /**
+     * @brief A reference to a name that is owned by a `NameArena`.
+     *
+     * The name itself is stored in the arena, prefixed by its length, which keeps the reference
+     * down to a single pointer. Copying the reference never copies the name, and the reference is
+     * only valid for as long as the arena that it came from.
+     */
+    class ArenaName
+    {
+      public:
+        ArenaName() noexcept = default;
+
+        /**
+         * @returns The name, or an empty view if no name was ever stored.
+         */
+        std::string_view View() const noexcept
+        {
+            if (!m_record) {
+                return {};
+            }
+
+            const auto shortLength = static_cast<unsigned char>(m_record[0]);
+            if (shortLength != LongLengthMarker) {
+                return { m_record + 1, shortLength };
+            }
+
+            std::uint32_t longLength;
+            std::memcpy(&longLength, m_record + 1, sizeof longLength);
+            return { m_record + 1 + sizeof longLength, longLength };
+        }
+
+        operator std::string_view() const noexcept
+        {
+            return View();
+        }
+
+        std::string ToString() const
+        {
+            return std::string{ View() };
+        }
+
+        bool empty() const noexcept
+        {
+            return View().empty();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return View().size();
+        }
+
+        friend bool operator==(const ArenaName& lhs, const ArenaName& rhs) noexcept
+        {
+            return lhs.View() == rhs.View();
+        }
+
+        friend bool operator==(const ArenaName& lhs, std::string_view rhs) noexcept
+        {
+            return lhs.View() == rhs;
+        }
+
+        friend bool operator==(std::string_view lhs, const ArenaName& rhs) noexcept
+        {
+            return lhs == rhs.View();
+        }
+
+        friend bool operator!=(const ArenaName& lhs, const ArenaName& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator!=(const ArenaName& lhs, std::string_view rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator!=(std::string_view lhs, const ArenaName& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        friend class NameArena;
+
+        // Names shorter than this are prefixed by a single byte holding their length; anything
+        // longer is prefixed by this marker, followed by the length as a 32-bit integer.
+        static constexpr unsigned char LongLengthMarker = 0xFF;
+
+        explicit ArenaName(const char* record) noexcept : m_record{ record }
+        {
+        }
+
+        const char* m_record = nullptr;
+    };
+
+    class ExtensionTable;
+    class NameArena;
+
+    /**
+     * @brief A file extension, as a small integer into a table of extensions.
+     *
+     * Since the same few extensions show up over and over again, every distinct extension is only
+     * ever stored once. The table is shared by every `NameArena` that is alive at the same time,
+     * which keeps extensions comparable across trees, and it is released along with the last of
+     * those arenas, so that a scan that runs once all earlier results are gone starts afresh. An
+     * extension is therefore only valid for as long as the arena that it was interned for.
+     *
+     * The table has room for 65,536 extensions. Beyond that, extensions are no longer interned,
+     * but kept as a part of the file's name instead.
+     */
+    class Extension
+    {
+      public:
+        Extension() noexcept = default;
+
+        /**
+         * @brief Looks up the given extension, and adds it to the table if it hasn't been seen
+         * before. Safe to call from any thread.
+         *
+         * @param[in] extension       The extension, including the leading dot.
+         * @param[in] arena           The arena that will keep the extension alive.
+         *
+         * @returns The interned extension. This will be empty if the extension was empty, or in
+         * the unlikely event that the table has run out of room.
+         */
+        static Extension Intern(std::string_view extension, NameArena& arena);
+
+        /**
+         * @returns The extension, including the leading dot.
+         */
+        std::string_view View() const noexcept;
+
+        operator std::string_view() const noexcept
+        {
+            return View();
+        }
+
+        std::string ToString() const
+        {
+            return std::string{ View() };
+        }
+
+        bool empty() const noexcept
+        {
+            return m_id == 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return View().size();
+        }
+
+        friend bool operator==(Extension lhs, Extension rhs) noexcept
+        {
+            return lhs.m_id == rhs.m_id;
+        }
+
+        friend bool operator==(Extension lhs, std::string_view rhs) noexcept
+        {
+            return lhs.View() == rhs;
+        }
+
+        friend bool operator==(std::string_view lhs, Extension rhs) noexcept
+        {
+            return lhs == rhs.View();
+        }
+
+        friend bool operator!=(Extension lhs, Extension rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator!=(Extension lhs, std::string_view rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator!=(std::string_view lhs, Extension rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+      private:
+        explicit Extension(std::uint32_t id) noexcept : m_id{ id }
+        {
+        }
+
+        // Zero is reserved for the empty extension.
+        std::uint32_t m_id = 0;
+    };
+
+    /**
+     * @brief Packs names into large, contiguous chunks of memory, instead of giving every name an
+     * allocation of its own.
+     *
+     * Names are never released individually; they all go away together with the arena. Each scan
+     * stores its names in an arena of its own, and the tree that the scan produces keeps that
+     * arena alive for as long as the tree is around. The arena, in turn, keeps the table of
+     * extensions alive.
+     *
+     * Much like a `ShardedCounter`, the arena is split into shards that the scanning threads are
+     * spread across, so that storing a name almost never has to wait on another thread.
+     */
+    class NameArena
+    {
+      public:
+        NameArena();
+
+        NameArena(const NameArena&) = delete;
+        NameArena& operator=(const NameArena&) = delete;
+
+        /**
+         * @brief Copies the given name into the arena. Safe to call from any thread.
+         *
+         * @param[in] name            The name to store.
+         *
+         * @returns A reference to the stored name.
+         */
+        ArenaName Store(std::string_view name);
+
+        /**
+         * @returns The number of bytes that the arena has allocated so far.
+         */
+        std::uintmax_t GetByteCount() const noexcept;
+
+        /**
+         * @returns An arena that lives for as long as the process does. This is meant for names
+         * that don't belong to any particular scan, and since nothing stored in it is ever
+         * released, it should be used sparingly.
+         */
+        static const std::shared_ptr<NameArena>& GetSharedArena();
+
+      private:
+        friend class Extension;
+
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+
+        static constexpr std::size_t ShardCount = 16;
+
+        struct alignas(128) Shard
+        {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<char[]>> chunks;
+            char* cursor = nullptr;
+            std::size_t bytesLeft = 0;
+
+            // Kept separately, so that it can be read without taking the lock.
+            std::atomic<std::uintmax_t> byteCount{ 0 };
+        };
+
+        std::array<Shard, ShardCount> m_shards;
+
+        std::shared_ptr<ExtensionTable> m_extensionTable;
+    };
+
+    /**
+     * @brief Stores a file name in the given arena, split into its stem and its extension in the
+     * same way that `std::filesystem::path` would split it.
+     *
+     * @param[in] fileName        The name of the file, without any parent directories.
+     * @param[in] arena           The arena in which to store the stem, and for which to intern
+     *                            the extension.
+     *
+     * @returns The stored stem, along with the interned extension.
+     */
+    std::pair<ArenaName, Extension> StoreFileName(std::string_view fileName, NameArena& arena);
+
+    /**
+     * @brief Stores a stem and an extension that have already been split up.
+     *
+     * @param[in] stem            The name of the file, without its extension.
+     * @param[in] extension       The extension, including the leading dot.
+     * @param[in] arena           The arena in which to store the stem, and for which to intern
+     *                            the extension.
+     *
+     * @returns The stored stem, along with the interned extension.
+     */
+    std::pair<ArenaName, Extension>
+    StoreFileName(std::string_view stem, std::string_view extension, NameArena& arena);
+
+    /**
+     * @brief Creates a tree that keeps the given arena alive for as long as the tree is around,
+     * such that the tree's names can be stored in it.
+     *
+     * @param[in] root            The root of the tree.
+     * @param[in] arena           The arena holding the names in the tree.
+     *
+     * @returns The new tree.
+     */
+    std::shared_ptr<Tree<VizBlock>> CreateTree(VizBlock root, std::shared_ptr<NameArena> arena);
+
+    /**
+     * @returns The arena that was handed to `CreateTree(...)` when the given tree was created, or
+     * the shared arena if the tree was created some other way.
+     */
+    const std::shared_ptr<NameArena>& GetNameArena(const std::shared_ptr<Tree<VizBlock>>& tree);
+} // namespace Scanner
+
+#endif // NAMEARENA_H
@@ -0,0 +1,113 @@
+#ifndef PARTIALTREEBUILDER_H
+#define PARTIALTREEBUILDER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Tree/Tree.hpp>
+
+#include "Model/Scanner/nameArena.h"
+#include "Model/vizBlock.h"
+
+namespace Scanner
+{
+    /**
+     * @brief Assembles consistent snapshots of a scan that is still in progress, without ever
+     * touching the tree that the scanning threads are building.
+     *
+     * Each scanning thread records a brief summary of every directory that it reads. These
+     * summaries are appended to one of several independently locked buffers, so recording one
+     * costs little more than an uncontended lock and a push. Whenever a snapshot is requested, the
+     * buffers are swapped out, and a separate, directories-only tree is built from everything
+     * recorded so far. Each directory in the snapshot is sized by the files found in it and in its
+     * subdirectories so far, which means that the sizes only ever grow from one snapshot to the
+     * next, until they reach their final values.
+     */
+    class PartialTreeBuilder
+    {
+      public:
+        using DirectoryId = std::size_t;
+
+        static constexpr DirectoryId NoParent = std::numeric_limits<DirectoryId>::max();
+
+        /**
+         * @param[in] nameArena       The arena holding the names of the recorded directories.
+         *                            Every snapshot keeps it alive, so that the names never have
+         *                            to be copied.
+         */
+        explicit PartialTreeBuilder(std::shared_ptr<NameArena> nameArena) noexcept;
+
+        /**
+         * @brief Hands out a new directory identifier. Identifiers are handed out in increasing
+         * order, so a directory has to be assigned its identifier after its parent was.
+         *
+         * @returns A unique identifier.
+         */
+        DirectoryId ReserveId() noexcept;
+
+        /**
+         * @brief Records that a directory has been read. Safe to call from any thread.
+         *
+         * @param[in] id              The directory's identifier, as handed out by `ReserveId()`.
+         * @param[in] parentId        The parent's identifier, or `NoParent` for the root.
+         * @param[in] name            The directory's name, as stored in the builder's arena.
+         * @param[in] bytesInFiles    The combined size of the files immediately inside of it.
+         */
+        void RecordDirectory(
+            DirectoryId id, DirectoryId parentId, ArenaName name, std::uintmax_t bytesInFiles);
+
+        /**
+         * @brief Builds a new tree out of everything that has been recorded so far. Directories
+         * whose parent hasn't been recorded yet, as well as directories without any files in them,
+         * are left out. This function is not meant to be called from more than one thread at a
+         * time.
+         *
+         * @returns A snapshot of the scan, or a null pointer if the root hasn't been recorded yet.
+         */
+        std::shared_ptr<Tree<VizBlock>> BuildSnapshot();
+
+      private:
+        struct Record
+        {
+            DirectoryId id;
+            DirectoryId parentId;
+            ArenaName name;
+            std::uintmax_t bytesInFiles;
+        };
+
+        struct Directory
+        {
+            DirectoryId parentId = NoParent;
+            ArenaName name;
+            std::uintmax_t bytesInFiles = 0;
+            bool isRecorded = false;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::vector<Record> records;
+        };
+
+        void CollectRecords();
+
+        static constexpr std::size_t ShardCount = 64;
+
+        std::shared_ptr<NameArena> m_nameArena;
+
+        std::atomic<DirectoryId> m_nextId{ 0 };
+
+        std::array<Shard, ShardCount> m_shards;
+
+        // Only ever accessed by the thread building the snapshots.
+        std::vector<Record> m_collectedRecords;
+        std::vector<Directory> m_directories;
+    };
+} // namespace Scanner
+
+#endif // PARTIALTREEBUILDER_H
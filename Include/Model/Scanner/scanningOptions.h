@@ -1,16 +1,44 @@
 #ifndef SCANNINGOPTIONS_H
 #define SCANNINGOPTIONS_H
 
+#include "Model/Scanner/exclusionRules.h"
+#include "Model/Scanner/subtreeEstimator.h"
+
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 class ScanningProgress;
 template <typename T> class Tree;
 class VizBlock;
 
+namespace Scanner
+{
+    class FileSystemBackend;
+}
+
+/**
+ * @brief The different mechanisms by which the scanner can retrieve file metadata.
+ */
+enum class ScanningEngine
+{
+    ThreadPool, ///< Each scanning thread issues one blocking stat call at a time.
+    IoUring     ///< File sizes are retrieved in batches of asynchronous io_uring requests.
+};
+
+/**
+ * @brief The different ways in which the size of a file can be measured.
+ */
+enum class FileSizeMetric
+{
+    Apparent, ///< The number of bytes in the file, as reported by `st_size`.
+    Allocated ///< The space that the file actually occupies on disk, as per `st_blocks`.
+};
+
 /**
  * @brief Wrapper around all of the options needed to scan a directories, as well as to track
  * progress.
@@ -23,6 +51,9 @@ class ScanningOptions
     using ScanCompleteCallback =
         std::function<void(const ScanningProgress&, std::shared_ptr<Tree<VizBlock>> fileTree)>;
 
+    using PartialResultsCallback =
+        std::function<void(const ScanningProgress&, std::shared_ptr<Tree<VizBlock>> fileTree)>;
+
     ScanningOptions() = default;
 
     ScanningOptions(
@@ -33,6 +64,84 @@ class ScanningOptions
 
     ProgressCallback onProgressUpdateCallback;
     ScanCompleteCallback onScanCompletedCallback;
+
+    // Invoked periodically while the scan is still running, with a directories-only snapshot of
+    // everything scanned so far. Leave the interval at zero to only report the final results.
+    PartialResultsCallback onPartialResultsCallback;
+    std::chrono::milliseconds partialResultsInterval{ 0 };
+
+    // Where to keep a journal of every directory read so far, which is written out at the given
+    // interval, and deleted once the scan completes. If the scan is cancelled, or crashes, the next
+    // scan of the same path with the same size metric will resume from the journal, provided that
+    // no previous tree is given. Leave the path empty to not keep a journal.
+    std::filesystem::path checkpointPath;
+    std::chrono::milliseconds checkpointInterval{ 30'000 };
+
+    // The results of an earlier scan of the same path, made with the same options. If provided,
+    // only the directories that changed since are read again, and everything else is carried
+    // over. Note that a file that merely grew or shrank in place doesn't change its directory, and
+    // will therefore keep its previous size.
+    std::shared_ptr<const Tree<VizBlock>> previousTree;
+
+    // The filesystem to scan through. Leave empty to scan the actual filesystem, in which case the
+    // engine determines how the files are sized.
+    std::shared_ptr<const Scanner::FileSystemBackend> backend;
+
+    ScanningEngine engine = ScanningEngine::ThreadPool;
+
+    // Only honoured on Linux. Stat-ing the files in each directory in the order of their inode
+    // numbers, rather than in the order in which they're listed, turns the random seeks across the
+    // inode table of a spinning disk into a mostly sequential sweep. On solid-state storage, the
+    // extra sorting only costs time.
+    bool shouldStatInInodeOrder = false;
+
+    // An upper bound on the number of scanning threads. Leave at zero to let the scanner decide.
+    unsigned int threadLimit = 0;
+
+    // A scan that runs in the background does so at the lowest CPU and I/O priority, so as not to
+    // get in the way of anything else running on the machine. This includes the thread that
+    // starts the scan, which should therefore be dedicated to it.
+    bool shouldRunInBackground = false;
+
+    // An upper bound on the number of filesystem operations that the scan may issue per second,
+    // where opening a directory and sizing an entry each count as a single operation. Leave at
+    // zero to not limit the scan.
+    std::uint32_t operationLimit = 0;
+
+    // Only honoured on Linux, where both options come for free with the stat call that's needed
+    // to size the file anyway.
+    FileSizeMetric sizeMetric = FileSizeMetric::Apparent;
+    bool shouldCountHardLinksOnce = false;
+
+    // Only honoured on Linux, since Windows volumes are mounted through reparse points, which are
+    // never followed to begin with.
+    bool shouldStayOnFilesystem = false;
+    bool shouldSkipPseudoFilesystems = true;
+
+    // An overview scan only reads the top levels of the tree in full, down to and including the
+    // given depth, with the scan root at a depth of zero. Every subtree below that is sized by
+    // sampling it instead, and marked with the confidence of its estimate. Leave the depth at zero
+    // to read everything in full.
+    unsigned int overviewDepth = 0;
+
+    // Subtrees that an overview scan should read in full nonetheless, which allows the estimates
+    // to be refined where they matter. Relative paths are taken to be relative to the scan root.
+    // Note that a rescan based on an overview keeps any subtree that was read in full in full.
+    std::vector<std::filesystem::path> exactSubtrees;
+
+    // Once the scan has read this many directory entries, every directory that it comes across
+    // from then on is sized by sampling it, just like the subtrees below the overview depth, and
+    // is marked as unexpanded. Such a directory can then be expanded by scanning it on its own.
+    // Since directories are read in parallel, which ones end up unexpanded may vary between scans.
+    // Leave the budget at zero to read everything in full.
+    std::uintmax_t entryBudget = 0;
+
+    // How much of a subtree may be read in order to estimate its size.
+    Scanner::SamplingLimits samplingLimits;
+
+    // The directories that shouldn't be scanned at all, beyond those ruled out by the options
+    // above.
+    Scanner::ExclusionRules exclusionRules;
 };
 
 #endif // SCANNINGOPTIONS_H
@@ -5,6 +5,8 @@
 #include <chrono>
 #include <cstdint>
 
+#include "Model/Scanner/shardedCounter.h"
+
 /**
  * @brief Various pieces of metadata to track file system scan progress.
  */
@@ -16,9 +18,21 @@ class ScanningProgress
      */
     void Reset() noexcept
     {
-        filesScanned.store(0);
-        directoriesScanned.store(0);
-        bytesProcessed.store(0);
+        filesScanned.Reset();
+        directoriesScanned.Reset();
+        bytesProcessed.Reset();
+        syscallsIssued.Reset();
+        syscallsAvoided.Reset();
+        duplicateHardLinksSkipped.Reset();
+        directoriesReused.Reset();
+        filesEstimated.Reset();
+        directoriesEstimated.Reset();
+        enumerationNanoseconds.Reset();
+        propagationNanoseconds.Reset();
+        pruningNanoseconds.Reset();
+        filesystemNanoseconds.Reset();
+        throttledNanoseconds.Reset();
+        queueDepth.store(0);
 
         m_startTime = std::chrono::steady_clock::now();
     }
@@ -32,9 +46,72 @@ class ScanningProgress
             std::chrono::steady_clock::now() - m_startTime);
     }
 
-    std::atomic<std::uintmax_t> filesScanned;
-    std::atomic<std::uintmax_t> directoriesScanned;
-    std::atomic<std::uintmax_t> bytesProcessed;
+    /**
+     * @returns The average time that a single filesystem call has taken so far, or zero if no
+     * calls have been made yet.
+     */
+    std::chrono::nanoseconds GetAverageSyscallLatency() const noexcept
+    {
+        const auto callCount = syscallsIssued.Load();
+        if (callCount == 0) {
+            return std::chrono::nanoseconds{ 0 };
+        }
+
+        return std::chrono::nanoseconds{ filesystemNanoseconds.Load() / callCount };
+    }
+
+    /**
+     * @returns The time that the scanning threads have spent working, summed across all threads.
+     */
+    std::chrono::nanoseconds GetActiveTime() const noexcept
+    {
+        return std::chrono::nanoseconds{ enumerationNanoseconds.Load() +
+                                         propagationNanoseconds.Load() +
+                                         pruningNanoseconds.Load() };
+    }
+
+    // Every scanning thread adds to these counters, so they're sharded in order to keep the threads
+    // from fighting over the same cache lines. Summing them up is comparatively expensive, which
+    // is fine as long as it only happens whenever progress is reported.
+    Scanner::ShardedCounter filesScanned;
+    Scanner::ShardedCounter directoriesScanned;
+    Scanner::ShardedCounter bytesProcessed;
+
+    // Filesystem system calls issued by the scanner, as well as an estimate of how many additional
+    // calls a purely path-based scan would have needed to arrive at the same result.
+    Scanner::ShardedCounter syscallsIssued;
+    Scanner::ShardedCounter syscallsAvoided;
+
+    // Additional links to files that had already been counted through another link.
+    Scanner::ShardedCounter duplicateHardLinksSkipped;
+
+    // Directories that hadn't changed since the previous scan, and whose contents were therefore
+    // taken over from the previous tree instead of being read again.
+    Scanner::ShardedCounter directoriesReused;
+
+    // The files and directories that an overview scan extrapolated, rather than counted, across
+    // all of the subtrees that it sampled.
+    Scanner::ShardedCounter filesEstimated;
+    Scanner::ShardedCounter directoriesEstimated;
+
+    // Time spent in each phase of the scan, summed across all scanning threads. Enumeration covers
+    // reading and sizing the contents of directories, propagation covers rolling the sizes of
+    // finished directories up into their parents, and pruning covers removing empty directories.
+    Scanner::ShardedCounter enumerationNanoseconds;
+    Scanner::ShardedCounter propagationNanoseconds;
+    Scanner::ShardedCounter pruningNanoseconds;
+
+    // Time spent waiting on the filesystem itself, summed across all scanning threads. Together
+    // with the number of calls issued, this yields the average latency of a call.
+    Scanner::ShardedCounter filesystemNanoseconds;
+
+    // Time spent waiting for the operation limit to allow the scan to go on, summed across all
+    // scanning threads. Compared to the active time, this shows how much the limit held back.
+    Scanner::ShardedCounter throttledNanoseconds;
+
+    // A gauge, rather than a counter, of the directories that have been found but whose scan has
+    // yet to complete. It's refreshed periodically while the scan is running.
+    std::atomic<std::uintmax_t> queueDepth{ 0 };
 
   private:
     std::chrono::steady_clock::time_point m_startTime;
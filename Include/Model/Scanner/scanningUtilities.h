@@ -10,7 +10,9 @@
 #include "Utilities/scopedHandle.h"
 #endif // Q_OS_WIN
 
+#include <cstdint>
 #include <filesystem>
+#include <optional>
 
 template <typename T> class Tree;
 class VizBlock;
@@ -45,6 +47,44 @@ namespace Scanner
      */
     std::uintmax_t ComputeFileSize(const std::filesystem::path& path) noexcept;
 
+    /**
+     * @brief Fingerprints the modification and change times of a directory. Since creating,
+     * removing, or renaming an entry updates both times on the directory containing it, an
+     * unchanged stamp means that the directory still lists the same entries as before.
+     *
+     * On Windows, only the last write time is available.
+     *
+     * @param path[in]               The path to the directory.
+     *
+     * @returns A non-zero stamp if the directory is accessible, and zero otherwise.
+     */
+    std::uint64_t ComputeChangeStamp(const std::filesystem::path& path) noexcept;
+
+#ifdef Q_OS_LINUX
+    /**
+     * @overload
+     *
+     * @param descriptor[in]         An open descriptor for the directory, which spares the kernel
+     *                               from resolving the directory's path.
+     */
+    std::uint64_t ComputeChangeStamp(int descriptor) noexcept;
+#endif // Q_OS_LINUX
+
+    /**
+     * @returns The number of directories that the scanner may hold open at once, which leaves at
+     * least half of the process's file descriptors to spare.
+     */
+    std::size_t DetermineOpenDirectoryLimit() noexcept;
+
+    /**
+     * @brief Lowers the CPU and I/O priority of the calling thread as far as it will go, such that
+     * the thread only gets to run, and to touch the disk, once nothing else wants to. Without
+     * elevated privileges, the priority can't be raised back up again.
+     *
+     * @returns True if both priorities were lowered.
+     */
+    bool LowerThreadPriority() noexcept;
+
     /**
      * @brief ComputeDirectorySizes
      *
@@ -52,6 +92,19 @@ namespace Scanner
      */
     void ComputeDirectorySizes(Tree<VizBlock>& tree) noexcept;
 
+    /**
+     * @brief Spells out a path the same way that the scanner spells the paths that it builds up
+     * from the scan root, so that the two can be compared as strings. Relative paths are taken to
+     * be relative to the scan root.
+     *
+     * @param path[in]               The path to resolve.
+     * @param scanRoot[in]           The path from which the scan starts, as given.
+     *
+     * @returns The resolved path, or nothing if the path doesn't lie strictly below the scan root.
+     */
+    std::optional<std::filesystem::path> ResolveBelowScanRoot(
+        const std::filesystem::path& path, const std::filesystem::path& scanRoot);
+
 #ifdef Q_OS_WIN
     /**
      * @returns True if the given path represents a reparse point, and false otherwise.
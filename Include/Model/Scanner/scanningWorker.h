@@ -7,28 +7,30 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
-
-#ifdef Q_OS_WIN
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif // Q_OS_WIN
-
-#include <boost/asio/thread_pool.hpp>
-
-#ifdef Q_OS_WIN
-#pragma warning(pop)
-#endif // Q_OS_WIN
+#include <unordered_set>
+#include <vector>
 
 #include <Tree/Tree.hpp>
 
+#include "Model/Scanner/checkpointJournal.h"
+#include "Model/Scanner/concurrentInodeSet.h"
+#include "Model/Scanner/exclusionRules.h"
 #include "Model/Scanner/fileInfo.h"
+#include "Model/Scanner/fileSystemBackend.h"
+#include "Model/Scanner/nameArena.h"
+#include "Model/Scanner/partialTreeBuilder.h"
 #include "Model/Scanner/scanningOptions.h"
 #include "Model/Scanner/scanningProgress.h"
+#include "Model/Scanner/shardedCounter.h"
+#include "Model/Scanner/tokenBucket.h"
+#include "Model/Scanner/workStealingScheduler.h"
 #include "Model/baseModel.h"
 #include "Model/block.h"
 #include "Model/vizBlock.h"
@@ -77,6 +79,14 @@ class ScanningWorker final : public QObject
      */
     void Finished(const std::shared_ptr<Tree<VizBlock>>& fileTree);
 
+    /**
+     * @brief Signals that a new snapshot of the scan in progress is available. The snapshot only
+     * contains directories, sized by whatever has been found in them so far.
+     *
+     * @param[in] fileTree        A pointer to a snapshot of the scan so far.
+     */
+    void PartialResults(const std::shared_ptr<Tree<VizBlock>>& fileTree);
+
     /**
      * @brief Signals drive scanning progress updates.
      */
@@ -91,42 +101,320 @@ class ScanningWorker final : public QObject
 
   private:
     /**
-     * @brief Helper function to process a single file.
+     * @brief The bookkeeping for a directory whose size isn't yet final.
+     *
+     * A directory's size becomes final once the directory itself has been read, and once all of
+     * its subdirectories have been finalized. At that point, the size is passed on to the parent,
+     * and the bookkeeping is released.
+     */
+    struct PendingDirectory
+    {
+        PendingDirectory(
+            Tree<VizBlock>::Node* node, PendingDirectory* parent,
+            Scanner::PartialTreeBuilder::DirectoryId id) noexcept
+            : node{ node }, parent{ parent }, id{ id }
+        {
+        }
+
+        Tree<VizBlock>::Node* node;
+        PendingDirectory* parent;
+
+        Scanner::PartialTreeBuilder::DirectoryId id;
+
+        std::atomic<std::uintmax_t> size{ 0 };
+        std::atomic<std::size_t> pendingCount{ 0 };
+
+        std::atomic<bool> hasEmptySubdirectories{ false };
+
+        // Set if the scan was cancelled before this directory, or any of its subdirectories,
+        // could be read in full.
+        std::atomic<bool> isIncomplete{ false };
+    };
+
+    /**
+     * @brief A single unit of scanning work: one directory, along with its bookkeeping.
+     */
+    struct DirectoryTask
+    {
+        PendingDirectory* directory;
+
+        // The parent directory, held open so that this directory can be opened relative to it.
+        // Empty for the scan root, and whenever too many directories are being held open already.
+        std::shared_ptr<const Scanner::DirectoryHandle> parentHandle;
+
+        // The same directory as it appeared in the previous scan, if there was one.
+        const Tree<VizBlock>::Node* previous = nullptr;
+
+        // The scan root sits at a depth of zero. Only needed for overview scans, which should
+        // read everything below this directory in full if it lies within an exact subtree.
+        unsigned int depth = 0;
+        bool isWithinExactSubtree = false;
+    };
+
+    /**
+     * @brief The ways in which a scan can treat a subdirectory that would otherwise be left
+     * unexpanded, either because it lies below the overview depth, or because the entry budget has
+     * run out.
+     */
+    enum class OverviewTreatment
+    {
+        Estimate,  ///< Size the entire subtree by sampling it.
+        Read,      ///< Read the subdirectory, but decide afresh for each of its subdirectories.
+        ReadInFull ///< Read the entire subtree.
+    };
+
+    /**
+     * @brief Works out which of the mount points below the scan root should not be entered, given
+     * the scanning options. Mount points that are ruled out by their filesystem type are added to
+     * the paths in the exclusion rules.
+     */
+    void IdentifyExcludedMountPoints();
+
+    /**
+     * @returns True if the directory at the given path should not be scanned.
+     */
+    bool IsExcluded(const std::filesystem::path& path) const;
+
+    /**
+     * @returns The size that counts towards the total for the given regular file, or nothing if
+     * the file has already been counted through another hard link.
+     */
+    std::optional<std::uintmax_t> MeasureFile(const Scanner::FileMetadata& metadata) noexcept;
+
+    /**
+     * @brief Adds up the size of everything below a directory that was excluded by the exclusion
+     * rules, without building any nodes for it.
+     *
+     * @param[in] path            The excluded directory.
+     *
+     * @returns The combined size of all files below the directory.
+     */
+    std::uintmax_t TallyExcludedDirectory(const std::filesystem::path& path) noexcept;
+
+    /**
+     * @brief Decides how to treat a subdirectory that would otherwise be left unexpanded.
+     *
+     * @param[in] path            The subdirectory.
+     * @param[in] previous        The subdirectory as it appeared in the previous scan, if at all.
+     */
+    OverviewTreatment
+    DetermineOverviewTreatment(const std::string& path, const Tree<VizBlock>::Node* previous) const;
+
+    /**
+     * @brief Sizes a subdirectory by sampling its subtree, and marks it as unexpanded, unless the
+     * previous scan already did so, in which case that estimate is carried over.
+     *
+     * @param[in] path            The subdirectory.
+     * @param[in] previous        The subdirectory as it appeared in the previous scan, if at all.
+     * @param[out] file           The subdirectory's metadata, which receives the estimate.
+     */
+    void EstimateDirectory(
+        const std::filesystem::path& path, const Tree<VizBlock>::Node* previous,
+        FileInfo& file) noexcept;
+
+    /**
+     * @brief Pieces together the full path of a directory from the names of its ancestors.
+     *
+     * @param[in] directory       The directory whose path is needed.
+     *
+     * @returns The path, starting from the scan root.
+     */
+    std::filesystem::path ResolvePath(const PendingDirectory& directory);
+
+    /**
+     * @brief Keeps a directory open for the benefit of its subdirectories, provided that there are
+     * any, and that doing so won't exceed the limit on the number of directories held open.
      *
-     * @note This function assumes the path is valid and accessible.
+     * @param[in] handle          The open directory.
+     * @param[in] subdirectoryCount  The number of subdirectories that will be opened relative
+     *                            to it.
      *
-     * @param[in] path            The location on disk to scan.
-     * @param[in] fileNode        The TreeNode in Tree to append newly discoved files to.
+     * @returns A handle to share with the subdirectories, or a null pointer if the directory was
+     * closed instead.
      */
-    void ProcessFile(const std::filesystem::path& path, Tree<VizBlock>::Node& node) noexcept;
+    std::shared_ptr<const Scanner::DirectoryHandle> ShareDirectoryHandle(
+        std::unique_ptr<Scanner::DirectoryHandle> handle, std::size_t subdirectoryCount) noexcept;
 
     /**
-     * @brief Performs a recursive depth-first exploration of the file system.
+     * @brief Reads the immediate contents of a single directory into the given buffer. Files are
+     * sized on the spot, while any subdirectories still need to be scanned.
+     *
+     * @param[in] directory       The directory to read.
+     * @param[out] children       A buffer to receive the files and subdirectories.
+     * @param[out] wasInterrupted Set if the scan was cancelled before the directory could be read
+     *                            in full, in which case the buffer only holds what was read.
      *
-     * @param[in] path            The location on disk to scan.
-     * @param[in] fileNode        The TreeNode in Tree to append newly discoved files to.
+     * @returns The number of entries encountered in the directory, including any entries that were
+     * subsequently discarded.
      */
-    void ProcessPath(const std::filesystem::path& path, Tree<VizBlock>::Node& node) noexcept;
+    std::size_t ReadDirectory(
+        Scanner::DirectoryHandle& directory, std::vector<VizBlock>& children,
+        bool& wasInterrupted) noexcept;
 
     /**
-     * @brief Helper function to facilitate exception-free iteration over a directory.
+     * @brief Carries the immediate contents of a directory over from the previous scan, instead of
+     * reading the directory again. Files keep their previous sizes, while any subdirectories still
+     * need to be checked for changes of their own.
      *
-     * @param[in] itr             Reference to the iterator to iterate over.
-     * @param[in] treeNode        The TreeNode to append the contents of the directory to.
+     * @param[in] previous        The directory as it appeared in the previous scan.
+     * @param[out] children       A buffer to receive the files and subdirectories.
+     * @param[out] matches        The previous incarnation of every subdirectory, in order.
+     *
+     * @returns The number of entries carried over.
      */
-    void AddSubDirectoriesToQueue(
-        const std::filesystem::path& path, Tree<VizBlock>::Node& node) noexcept;
+    std::size_t ReuseDirectory(
+        const Tree<VizBlock>::Node& previous, std::vector<VizBlock>& children,
+        std::vector<const Tree<VizBlock>::Node*>& matches) noexcept;
+
+    /**
+     * @brief Pairs up the subdirectories of a directory that had to be read again with their
+     * previous incarnations, by name.
+     *
+     * @param[in] previous        The directory as it appeared in the previous scan.
+     * @param[in] children        The contents of the directory, as just read.
+     * @param[out] matches        The previous incarnation of every subdirectory, in order, or a
+     *                            null pointer for any subdirectory that is new.
+     */
+    static void MatchPreviousSubdirectories(
+        const Tree<VizBlock>::Node& previous, const std::vector<VizBlock>& children,
+        std::vector<const Tree<VizBlock>::Node*>& matches);
+
+    /**
+     * @returns The root of the previous scan if it can serve as the basis for this scan, and a
+     * null pointer otherwise.
+     */
+    const Tree<VizBlock>::Node* SelectPreviousRoot() const noexcept;
+
+    /**
+     * @brief Scans a single directory, publishes its contents into the tree in a single batch, and
+     * then submits a separate task for each subdirectory.
+     *
+     * @param[in] task            The directory to scan.
+     */
+    void ProcessDirectory(DirectoryTask& task) noexcept;
+
+    /**
+     * @brief Charges the given number of filesystem operations against the operation limit, and
+     * holds up the calling thread for as long as the limit requires, or until the scan is
+     * cancelled.
+     *
+     * @param[in] operationCount  The number of operations just issued.
+     */
+    void Throttle(std::uint64_t operationCount) noexcept;
+
+    /**
+     * @brief Marks one of the outstanding pieces of work on the given directory as complete. Once
+     * nothing remains outstanding, the directory's size is recorded, its empty subdirectories are
+     * removed from the tree, and the same process is repeated for its parent. A directory that was
+     * left incomplete by a cancelled scan marks its parent as incomplete too.
+     *
+     * @param[in] directory       The directory to complete.
+     */
+    void CompleteDirectory(PendingDirectory* directory) noexcept;
+
+    /**
+     * @brief Drops every directory that is still waiting to be scanned, once the scan has been
+     * cancelled. Each dropped directory is marked as unread, and then completed, so that its
+     * parent can be completed in turn.
+     */
+    void AbandonQueuedDirectories() noexcept;
+
+    /**
+     * @brief Periodically samples the scanning throughput, and adjusts the number of active
+     * scanning threads accordingly, until the scan completes.
+     */
+    void RegulateConcurrency() noexcept;
+
+    /**
+     * @brief Periodically publishes a snapshot of the scan so far, until the scan completes.
+     */
+    void PublishPartialResults() noexcept;
+
+    /**
+     * @returns True if snapshots of the scan in progress should be published.
+     */
+    bool ShouldPublishPartialResults() const noexcept;
+
+    /**
+     * @brief Restores the journal of an earlier, unfinished scan of the same path, if there is
+     * one, and then opens the journal for this scan.
+     */
+    void OpenCheckpointJournal();
+
+    /**
+     * @brief Periodically writes out the journal, until the scan completes.
+     */
+    void WriteCheckpoints() noexcept;
+
+    /**
+     * @brief Closes the journal, which is only kept around if the scan was cancelled.
+     */
+    void CloseCheckpointJournal();
 
     ScanningOptions m_options;
 
     ScanningProgress& m_progress;
     std::atomic<bool>& m_cancellationToken;
 
+    std::shared_ptr<const Scanner::FileSystemBackend> m_backend;
+
+    // Holds the names of everything in the tree, and lives on for as long as the tree does.
+    std::shared_ptr<Scanner::NameArena> m_nameArena;
+
     std::shared_ptr<Tree<VizBlock>> m_fileTree;
 
-    mutable std::mutex m_mutex;
+    Scanner::ConcurrentInodeSet m_hardLinkedFiles;
+
+    // The path from which the scan actually starts. This is the same path as the one in the
+    // options, except that it may have been normalized in order to match against the mount table.
+    std::filesystem::path m_scanRoot;
+    std::unordered_set<std::string> m_excludedMountPoints;
+
+    // The names of the excluded mount points, which spare most directories a full path lookup.
+    std::unordered_set<std::string> m_excludedMountPointNames;
+
+    Scanner::ExclusionMatcher m_exclusionMatcher;
+
+    // The exact subtrees of an overview scan, spelled the way that the scanner spells its paths.
+    std::vector<std::string> m_exactSubtrees;
+
+    // The number of entries read so far, as counted against the entry budget. Only maintained if
+    // there is a budget.
+    std::atomic<std::uintmax_t> m_budgetedEntryCount{ 0 };
+
+    std::atomic<std::uintmax_t> m_prunedDirectoryCount{ 0 };
+
+    // Directories that a cancelled scan found, but never got around to reading in full.
+    Scanner::ShardedCounter m_unreadDirectoryCount;
+
+    // Directories are held open while their subdirectories are being opened, up to a limit that
+    // leaves plenty of descriptors to spare.
+    std::size_t m_openDirectoryLimit;
+    std::atomic<std::size_t> m_retainedDirectoryCount{ 0 };
+
+    Scanner::ShardedCounter m_resolvedPathCount;
+
+    Scanner::WorkStealingScheduler<DirectoryTask> m_scheduler;
+
+    // Shared between all scanning threads, so that the limit applies to the scan as a whole.
+    Scanner::TokenBucket m_operationBudget;
+
+    // Used to gauge throughput, so that the number of active threads can be tuned.
+    Scanner::ShardedCounter m_entriesRead;
+    Scanner::ShardedCounter m_busyNanoseconds;
+
+    Scanner::PartialTreeBuilder m_partialTreeBuilder;
+
+    Scanner::CheckpointJournal m_checkpointJournal;
+    bool m_isKeepingJournal = false;
+
+    // Set if the previous tree was restored from the journal, in which case the listings of the
+    // directories that are carried over are already in the journal.
+    bool m_isResumingFromJournal = false;
 
-    boost::asio::thread_pool m_threadPool = Constants::Concurrency::ThreadLimit;
+    std::mutex m_completionMutex;
+    std::condition_variable m_scanCompletionSignal;
+    bool m_isScanComplete = false;
 };
 
 #endif // SCANNINGWORKER_H
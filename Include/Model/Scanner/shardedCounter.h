@@ -0,0 +1,90 @@
+#ifndef SHARDEDCOUNTER_H
+#define SHARDEDCOUNTER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Scanner
+{
+    /**
+     * @brief A counter that many threads can add to at once without contending with each other.
+     *
+     * The count is split across a number of shards, each on a cache line of its own, and every
+     * thread sticks to a single shard for its entire lifetime. As long as there are no more
+     * threads than shards, no two threads ever write to the same cache line, which makes adding to
+     * the counter about as cheap as adding to a local variable. The price is paid by readers,
+     * who have to sum up every shard, so this is only a good fit for counters that are written
+     * far more often than they are read.
+     */
+    class ShardedCounter
+    {
+      public:
+        ShardedCounter() noexcept = default;
+
+        ShardedCounter(const ShardedCounter&) = delete;
+        ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+        /**
+         * @brief Adds the given value to the calling thread's shard.
+         */
+        void Add(std::uintmax_t value) noexcept
+        {
+            m_shards[GetShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        /**
+         * @returns The sum of all shards. Additions that are still in flight on other threads may
+         * or may not be included.
+         */
+        std::uintmax_t Load() const noexcept
+        {
+            std::uintmax_t sum = 0;
+            for (const auto& shard : m_shards) {
+                sum += shard.value.load(std::memory_order_relaxed);
+            }
+
+            return sum;
+        }
+
+        /**
+         * @brief Sets the counter back to zero. This should not race with any additions.
+         */
+        void Reset() noexcept
+        {
+            for (auto& shard : m_shards) {
+                shard.value.store(0, std::memory_order_relaxed);
+            }
+        }
+
+      private:
+        // Large enough to cover the usual 64-byte cache line, as well as the adjacent-line
+        // prefetcher that effectively pairs up cache lines on some processors.
+        static constexpr std::size_t ShardAlignment = 128;
+
+        static constexpr std::size_t ShardCount = 64;
+
+        struct alignas(ShardAlignment) Shard
+        {
+            std::atomic<std::uintmax_t> value{ 0 };
+        };
+
+        /**
+         * @returns The shard assigned to the calling thread. Threads are assigned shards in a
+         * round-robin fashion the first time that they add to any counter.
+         */
+        static std::size_t GetShardIndex() noexcept
+        {
+            static std::atomic<std::size_t> nextIndex{ 0 };
+            thread_local const auto index =
+                nextIndex.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+
+            return index;
+        }
+
+        std::array<Shard, ShardCount> m_shards;
+    };
+} // namespace Scanner
+
+#endif // SHARDEDCOUNTER_H
@@ -0,0 +1,83 @@
+#ifndef SUBTREEESTIMATOR_H
+#define SUBTREEESTIMATOR_H
+
+#include "Model/Scanner/fileSystemBackend.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+
+// The scanning options carry a set of sampling limits, and so can't be included here.
+enum class FileSizeMetric;
+
+namespace Scanner
+{
+    /**
+     * @brief How much of a subtree may be read in order to estimate its size.
+     */
+    struct SamplingLimits
+    {
+        // The number of directories that are read outright, breadth first, before falling back
+        // on sampling. A subtree that fits within this budget is measured exactly.
+        std::size_t directoryBudget = 64;
+
+        // The number of random root-to-leaf paths that are followed once the budget runs out.
+        std::size_t probeCount = 32;
+    };
+
+    /**
+     * @brief Decides whether a subdirectory, given by its parent's path and its own name, should
+     * be left alone.
+     */
+    using ExclusionPredicate =
+        std::function<bool(const std::filesystem::path& parent, const std::string& name)>;
+
+    /**
+     * @brief The extrapolated size and shape of a subtree.
+     */
+    struct SubtreeEstimate
+    {
+        std::uintmax_t size = 0;
+        std::uintmax_t fileCount = 0;
+        std::uintmax_t directoryCount = 0; ///< Excluding the root of the subtree.
+
+        // The confidence in the estimate, as a percentage. Only a subtree that was read in its
+        // entirety is estimated with full confidence.
+        std::uint8_t confidence = 100;
+
+        std::uintmax_t directoriesRead = 0;
+        SystemCallTally tally;
+    };
+
+    /**
+     * @brief Estimates the size of a subtree by reading only a bounded part of it.
+     *
+     * The top of the subtree is read breadth first, until either the subtree is exhausted, in
+     * which case the result is exact, or the directory budget runs out. In the latter case, the
+     * size is estimated by following a number of random paths from the root of the subtree down
+     * to a leaf, as proposed by Knuth for estimating the size of a search tree. Every directory
+     * along such a path stands in for all of its siblings, so that each path yields an unbiased
+     * estimate on its own, and the spread between the paths yields the confidence. Directories
+     * that were already read during the breadth-first phase are never read again.
+     *
+     * Hard links are not recognized, so a file with several links may be counted several times.
+     *
+     * @param[in] backend         The filesystem in which the subtree resides.
+     * @param[in] root            The root of the subtree.
+     * @param[in] sizeMetric      How to measure the size of a file.
+     * @param[in] limits          How much of the subtree may be read.
+     * @param[in] isExcluded      Decides which subdirectories to leave out of the estimate
+     *                            altogether. Leave empty to include everything.
+     *
+     * @returns The estimate. The same subtree always yields the same estimate, since the random
+     * paths are seeded by the path of the root.
+     */
+    SubtreeEstimate EstimateSubtree(
+        const FileSystemBackend& backend, const std::filesystem::path& root,
+        FileSizeMetric sizeMetric, const SamplingLimits& limits,
+        const ExclusionPredicate& isExcluded = {});
+} // namespace Scanner
+
+#endif // SUBTREEESTIMATOR_H
@@ -0,0 +1,103 @@
+#ifndef SYNTHETICFILESYSTEMBACKEND_H
+#define SYNTHETICFILESYSTEMBACKEND_H
+
+#include "Model/Scanner/fileSystemBackend.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace Scanner
+{
+    /**
+     * @brief Describes the tree that a `SyntheticFileSystemBackend` should pretend to hold, as
+     * well as how slow it should pretend to be.
+     */
+    struct SyntheticFileSystemOptions
+    {
+        // The path at which the synthetic tree is rooted. Nothing needs to exist at this path.
+        std::filesystem::path root = "/synthetic";
+
+        // The approximate number of files and directories in the entire tree.
+        std::uint64_t entryCount = 100'000;
+
+        // Every directory holds the same number of files, and, until the entry count runs out, the
+        // same number of subdirectories.
+        std::uint32_t subdirectoriesPerDirectory = 8;
+        std::uint32_t filesPerDirectory = 32;
+
+        // File sizes are spread evenly between one byte and this maximum.
+        std::uintmax_t maximumFileSize = 1024 * 1024;
+
+        // Every simulated system call takes this long, give or take up to the jitter.
+        std::chrono::microseconds latency{ 0 };
+        std::chrono::microseconds jitter{ 0 };
+
+        // Backends with the same options and seed generate the exact same tree.
+        std::uint64_t seed = 0;
+    };
+
+    /**
+     * @brief A filesystem that only exists in memory, and that never actually takes up any.
+     *
+     * Rather than being stored, the tree is derived on the fly from the identity of each directory,
+     * so that even a tree of tens of millions of entries costs nothing to set up. The directories
+     * form a complete tree that is filled in breadth-first, with each directory's name encoding
+     * its position in that order. Every simulated system call can be made to take a configurable
+     * amount of time, which makes it possible to observe the scanner against storage that is far
+     * slower than whatever happens to be at hand, such as a network share.
+     */
+    class SyntheticFileSystemBackend final : public FileSystemBackend
+    {
+      public:
+        explicit SyntheticFileSystemBackend(SyntheticFileSystemOptions options) noexcept;
+
+        /**
+         * @returns The number of directories in the tree, including the root.
+         */
+        std::uint64_t GetDirectoryCount() const noexcept;
+
+        /**
+         * @returns The total number of files and directories in the tree, including the root.
+         */
+        std::uint64_t GetEntryCount() const noexcept;
+
+        /**
+         * @copydoc FileSystemBackend::IsDirectory
+         */
+        bool IsDirectory(const std::filesystem::path& path) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ReadDirectory
+         *
+         * Reading a directory is charged as one call to list the directory, and one more call to
+         * stat each of its files.
+         */
+        bool ReadDirectory(
+            const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+            SystemCallTally& tally) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ComputeChangeStamp
+         */
+        std::uint64_t ComputeChangeStamp(const std::filesystem::path& path) const noexcept override;
+
+      private:
+        /**
+         * @returns The breadth-first index of the directory at the given path, if there is one.
+         */
+        std::optional<std::uint64_t> FindDirectory(const std::filesystem::path& path) const;
+
+        /**
+         * @brief Blocks the calling thread for as long as the given number of calls would take.
+         */
+        void SimulateLatency(std::uintmax_t callCount) const noexcept;
+
+        SyntheticFileSystemOptions m_options;
+
+        std::uint64_t m_directoryCount = 1;
+    };
+} // namespace Scanner
+
+#endif // SYNTHETICFILESYSTEMBACKEND_H
@@ -0,0 +1,64 @@
+#ifndef TOKENBUCKET_H
+#define TOKENBUCKET_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Scanner
+{
+    /**
+     * @brief Limits the rate at which some operation may be performed, while still allowing short
+     * bursts.
+     *
+     * The bucket fills up with tokens at a steady rate, until it holds as many as its capacity
+     * allows. Every operation takes tokens out of the bucket, and once the bucket runs dry, the
+     * caller is told how long to wait before going ahead. Since the number of operations that a
+     * caller is about to perform isn't always known up front, the bucket may go into debt, which
+     * simply means that the next caller will have to wait all the longer.
+     *
+     * Rather than tracking the number of tokens directly, the bucket tracks the point in time at
+     * which it would be full again, which allows it to be shared between threads with nothing
+     * more than a single atomic.
+     */
+    class TokenBucket
+    {
+      public:
+        /**
+         * @param[in] tokensPerSecond     The rate at which the bucket fills up, or zero for a
+         *                                bucket that never runs dry.
+         * @param[in] capacity            The number of tokens that the bucket can hold.
+         */
+        TokenBucket(std::uint64_t tokensPerSecond, std::uint64_t capacity) noexcept;
+
+        TokenBucket(const TokenBucket&) = delete;
+        TokenBucket& operator=(const TokenBucket&) = delete;
+
+        /**
+         * @brief Takes the given number of tokens out of the bucket. Safe to call from any thread.
+         *
+         * @param[in] tokenCount          The number of tokens to take.
+         * @param[in] now                 The current time.
+         *
+         * @returns How long the caller should wait before going ahead, which is zero if there
+         * were enough tokens in the bucket.
+         */
+        std::chrono::nanoseconds
+        Consume(std::uint64_t tokenCount, std::chrono::steady_clock::time_point now) noexcept;
+
+        /**
+         * @returns True if the bucket never runs dry.
+         */
+        bool IsUnlimited() const noexcept;
+
+      private:
+        std::int64_t m_nanosecondsPerToken;
+        std::int64_t m_burstNanoseconds;
+
+        // The point in time, in nanoseconds since the epoch of the steady clock, at which every
+        // token taken so far will have been replenished.
+        std::atomic<std::int64_t> m_replenishedTime{ 0 };
+    };
+} // namespace Scanner
+
+#endif // TOKENBUCKET_H
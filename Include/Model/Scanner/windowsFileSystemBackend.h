@@ -0,0 +1,40 @@
+#ifndef WINDOWSFILESYSTEMBACKEND_H
+#define WINDOWSFILESYSTEMBACKEND_H
+
+#include <QtGlobal>
+
+#ifdef Q_OS_WIN
+
+#include "Model/Scanner/fileSystemBackend.h"
+
+namespace Scanner
+{
+    /**
+     * @brief Reads the actual filesystem through `std::filesystem::directory_iterator`, which
+     * reports the attributes and size of each entry alongside its name.
+     */
+    class WindowsFileSystemBackend final : public FileSystemBackend
+    {
+      public:
+        /**
+         * @copydoc FileSystemBackend::IsDirectory
+         */
+        bool IsDirectory(const std::filesystem::path& path) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ReadDirectory
+         */
+        bool ReadDirectory(
+            const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+            SystemCallTally& tally) const noexcept override;
+
+        /**
+         * @copydoc FileSystemBackend::ComputeChangeStamp
+         */
+        std::uint64_t ComputeChangeStamp(const std::filesystem::path& path) const noexcept override;
+    };
+} // namespace Scanner
+
+#endif // Q_OS_WIN
+
+#endif // WINDOWSFILESYSTEMBACKEND_H
@@ -0,0 +1,358 @@
+#ifndef WORKSTEALINGSCHEDULER_H
+#define WORKSTEALINGSCHEDULER_H
+
+#include <gsl/assert>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Scanner
+{
+    /**
+     * @brief A small work-stealing scheduler in which every thread owns a deque of pending tasks.
+     *
+     * Tasks submitted from inside of a running task are pushed onto the back of the submitting
+     * thread's own deque, and that thread will also pop from the back, which keeps the working set
+     * of each thread close to where it last was. Idle threads steal from the front of the other
+     * deques, thereby taking the oldest (and, in case of a directory tree, usually the largest)
+     * pieces of outstanding work.
+     *
+     * In order to keep the amount of queued work bounded, each deque has a fixed capacity. Once a
+     * thread's deque is full, any further tasks submitted by that thread are executed inline, on
+     * the submitting thread, instead of being queued.
+     *
+     * The number of threads that actively pick up work can be lowered at any time, in which case
+     * the surplus threads will park themselves after finishing their current task. Any tasks left
+     * in their deques will be stolen by the threads that remain active.
+     *
+     * A run can also be cancelled, in which case every task that is still queued up is handed back
+     * to the caller instead of being executed.
+     */
+    template <typename TaskType> class WorkStealingScheduler
+    {
+        static_assert(
+            std::is_move_constructible<TaskType>::value, "Type has to be move-constructible.");
+
+      public:
+        using HandlerType = std::function<void(TaskType&)>;
+
+        /**
+         * @param[in] threadCount     The number of threads that will execute tasks, including the
+         *                            thread that calls `Run(...)`.
+         * @param[in] queueCapacity   The maximum number of tasks that a single thread may queue up.
+         */
+        WorkStealingScheduler(std::size_t threadCount, std::size_t queueCapacity)
+            : m_queueCapacity{ queueCapacity }, m_activeThreadLimit{ threadCount }
+        {
+            Expects(threadCount > 0);
+            Expects(queueCapacity > 0);
+
+            m_queues.reserve(threadCount);
+            for (std::size_t index = 0; index < threadCount; ++index) {
+                m_queues.emplace_back(std::make_unique<WorkerQueue>());
+            }
+        }
+
+        WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+        WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+        /**
+         * @brief Executes the initial task, along with everything that it transitively submits,
+         * and only returns once all of that work has completed.
+         *
+         * @param[in] initialTask     The task that seeds the scheduler.
+         * @param[in] handler         The function that will be invoked to execute each task.
+         * @param[in] initializer     An optional function that every thread, including the calling
+         *                            thread, invokes before it executes any tasks.
+         */
+        void Run(
+            TaskType initialTask, HandlerType handler,
+            const std::function<void()>& initializer = nullptr)
+        {
+            Expects(handler);
+
+            m_handler = std::move(handler);
+            m_outstandingTasks.store(1);
+            m_isCancelled.store(false);
+
+            m_queues.front()->tasks.emplace_back(std::move(initialTask));
+
+            std::vector<std::thread> threads;
+            threads.reserve(m_queues.size() - 1);
+
+            for (std::size_t index = 1; index < m_queues.size(); ++index) {
+                threads.emplace_back([this, index, &initializer] {
+                    if (initializer) {
+                        initializer();
+                    }
+
+                    WorkerLoop(index);
+                });
+            }
+
+            if (initializer) {
+                initializer();
+            }
+
+            WorkerLoop(0);
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            m_handler = nullptr;
+        }
+
+        /**
+         * @brief Submits a new task. This function is meant to be called from within a task that is
+         * already being executed by this scheduler.
+         *
+         * @param[in] task            The task to be executed.
+         */
+        void Submit(TaskType task)
+        {
+            Expects(t_currentScheduler == this);
+
+            // Once the run has been cancelled, there's no point in queueing anything up anymore.
+            if (m_isCancelled.load()) {
+                m_handler(task);
+                return;
+            }
+
+            auto& queue = *m_queues[t_currentIndex];
+
+            {
+                std::unique_lock<std::mutex> lock{ queue.mutex };
+
+                if (queue.tasks.size() >= m_queueCapacity) {
+                    lock.unlock();
+
+                    // Applying backpressure: rather than letting the queue grow without bound, the
+                    // submitting thread will simply take care of the task itself.
+                    m_inlinedTaskCount.fetch_add(1, std::memory_order_relaxed);
+                    m_handler(task);
+
+                    return;
+                }
+
+                m_outstandingTasks.fetch_add(1);
+                queue.tasks.emplace_back(std::move(task));
+            }
+
+            if (m_sleepingThreadCount.load() > 0) {
+                std::lock_guard<std::mutex> lock{ m_sleepMutex };
+                m_wakeUpSignal.notify_one();
+            }
+        }
+
+        /**
+         * @brief Empties every queue, such that none of the tasks that were still waiting to be
+         * picked up will be executed, and such that the run can wind down as soon as the tasks
+         * that are already executing have completed. From then on, and until the next run, any
+         * newly submitted task is executed inline, on the submitting thread.
+         *
+         * A task that is being submitted while the queues are being emptied may still slip into a
+         * queue, in which case it will be executed as usual.
+         *
+         * @returns The tasks that were dropped, so that the caller can dispose of them.
+         */
+        std::vector<TaskType> Cancel()
+        {
+            m_isCancelled.store(true);
+
+            std::vector<TaskType> droppedTasks;
+            for (auto& queue : m_queues) {
+                std::lock_guard<std::mutex> lock{ queue->mutex };
+
+                std::move(
+                    std::begin(queue->tasks), std::end(queue->tasks),
+                    std::back_inserter(droppedTasks));
+
+                queue->tasks.clear();
+            }
+
+            m_outstandingTasks.fetch_sub(droppedTasks.size());
+
+            // Should nothing be left running, the threads that are waiting for work can leave.
+            std::lock_guard<std::mutex> lock{ m_sleepMutex };
+            m_wakeUpSignal.notify_all();
+
+            return droppedTasks;
+        }
+
+        /**
+         * @returns The total number of threads owned by the scheduler, whether active or not.
+         */
+        std::size_t GetThreadCount() const noexcept
+        {
+            return m_queues.size();
+        }
+
+        /**
+         * @brief Limits the number of threads that will pick up new tasks. The thread that called
+         * `Run(...)` is always active, so the limit can never drop below one.
+         *
+         * @param[in] limit           The number of threads that should remain active.
+         */
+        void SetActiveThreadLimit(std::size_t limit) noexcept
+        {
+            m_activeThreadLimit.store(std::clamp<std::size_t>(limit, 1, m_queues.size()));
+
+            std::lock_guard<std::mutex> lock{ m_sleepMutex };
+            m_wakeUpSignal.notify_all();
+        }
+
+        /**
+         * @returns The number of threads that are allowed to pick up new tasks.
+         */
+        std::size_t GetActiveThreadLimit() const noexcept
+        {
+            return m_activeThreadLimit.load();
+        }
+
+        /**
+         * @returns The number of tasks that have been submitted, but that have yet to complete.
+         * This includes the tasks that are currently running.
+         */
+        std::uintmax_t GetOutstandingTaskCount() const noexcept
+        {
+            return m_outstandingTasks.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @returns The number of tasks that were stolen from another thread's queue.
+         */
+        std::uintmax_t GetStolenTaskCount() const noexcept
+        {
+            return m_stolenTaskCount.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @returns The number of tasks that were executed inline because the submitting thread's
+         * queue was already at capacity.
+         */
+        std::uintmax_t GetInlinedTaskCount() const noexcept
+        {
+            return m_inlinedTaskCount.load(std::memory_order_relaxed);
+        }
+
+      private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<TaskType> tasks;
+        };
+
+        std::optional<TaskType> PopLocal(std::size_t index)
+        {
+            auto& queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock{ queue.mutex };
+
+            if (queue.tasks.empty()) {
+                return std::nullopt;
+            }
+
+            auto task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+
+            return task;
+        }
+
+        std::optional<TaskType> Steal(std::size_t thief)
+        {
+            const auto queueCount = m_queues.size();
+
+            for (std::size_t offset = 1; offset < queueCount; ++offset) {
+                auto& victim = *m_queues[(thief + offset) % queueCount];
+                std::lock_guard<std::mutex> lock{ victim.mutex };
+
+                if (victim.tasks.empty()) {
+                    continue;
+                }
+
+                auto task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+
+                m_stolenTaskCount.fetch_add(1, std::memory_order_relaxed);
+                return task;
+            }
+
+            return std::nullopt;
+        }
+
+        void WorkerLoop(std::size_t index)
+        {
+            t_currentScheduler = this;
+            t_currentIndex = index;
+
+            while (m_outstandingTasks.load() > 0) {
+                const auto isParked = index >= m_activeThreadLimit.load();
+
+                auto task = isParked ? std::nullopt : PopLocal(index);
+                if (!task && !isParked) {
+                    task = Steal(index);
+                }
+
+                if (task) {
+                    m_handler(*task);
+
+                    if (m_outstandingTasks.fetch_sub(1) == 1) {
+                        std::lock_guard<std::mutex> lock{ m_sleepMutex };
+                        m_wakeUpSignal.notify_all();
+                    }
+
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{ m_sleepMutex };
+                m_sleepingThreadCount.fetch_add(1);
+
+                // A submission may slip in between the failed steal and the wait, so we'll poll
+                // periodically rather than relying solely on the notification. Parked threads are
+                // explicitly notified when the limit changes, so they can afford to poll less.
+                const auto pollingInterval = std::chrono::milliseconds{ isParked ? 10 : 1 };
+                m_wakeUpSignal.wait_for(lock, pollingInterval);
+
+                m_sleepingThreadCount.fetch_sub(1);
+            }
+
+            t_currentScheduler = nullptr;
+        }
+
+        inline static thread_local WorkStealingScheduler* t_currentScheduler = nullptr;
+        inline static thread_local std::size_t t_currentIndex = 0;
+
+        std::size_t m_queueCapacity;
+
+        std::atomic<std::size_t> m_activeThreadLimit;
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+        HandlerType m_handler;
+
+        std::atomic<std::uintmax_t> m_outstandingTasks{ 0 };
+        std::atomic<std::uintmax_t> m_sleepingThreadCount{ 0 };
+
+        std::atomic<std::uintmax_t> m_stolenTaskCount{ 0 };
+        std::atomic<std::uintmax_t> m_inlinedTaskCount{ 0 };
+
+        std::atomic<bool> m_isCancelled{ false };
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeUpSignal;
+    };
+} // namespace Scanner
+
+#endif // WORKSTEALINGSCHEDULER_H
@@ -15,6 +15,7 @@
 
 #include "Model/Monitor/fileChangeNotification.h"
 #include "Model/Monitor/fileSystemObserver.h"
+#include "Model/flatTree.h"
 #include "Model/vizBlock.h"
 #include "Settings/settings.h"
 #include "Settings/visualizationOptions.h"
@@ -68,6 +69,27 @@ class BaseModel
      */
     virtual void Parse(const std::shared_ptr<Tree<VizBlock>>& theTree) = 0;
 
+    /**
+     * @brief Takes on a tree that has already been laid out, such as one restored from a snapshot,
+     * in lieu of parsing it.
+     *
+     * @param[in] theTree         The fully laid out tree.
+     */
+    void Adopt(const std::shared_ptr<Tree<VizBlock>>& theTree);
+
+    /**
+     * @brief Replaces the estimate of an unexpanded directory with the results of scanning it, and
+     * then lays out the tree anew.
+     *
+     * The scanned subtree is copied into place, and the difference in size is passed on to all of
+     * the directory's ancestors. Should the directory have turned out to be empty, it is removed
+     * from the tree altogether.
+     *
+     * @param[in, out] node       The unexpanded directory.
+     * @param[in] subtree         The results of scanning that directory on its own.
+     */
+    void ExpandNode(Tree<VizBlock>::Node& node, const Tree<VizBlock>& subtree);
+
     /**
      * @brief Updates the minimum Axis-Aligned Bounding Boxes (AABB) for each node in the tree.
      *
@@ -105,6 +127,17 @@ class BaseModel
      */
     const Tree<VizBlock>& GetTree() const;
 
+    /**
+     * @returns A flattened copy of the directory tree, which is kept up to date whenever the tree
+     * is parsed, adopted, or refreshed.
+     */
+    const FlatTree& GetFlatTree() const;
+
+    /**
+     * @returns Shared ownership of the directory tree, which allows the tree to outlive the model.
+     */
+    std::shared_ptr<const Tree<VizBlock>> ShareTree() const;
+
     /**
      * @returns The currently highlighted nodes.
      */
@@ -248,6 +281,12 @@ class BaseModel
     static void SortNodes(Tree<VizBlock>& tree);
 
   protected:
+    /**
+     * @brief Rebuilds the flat tree from the directory tree. This needs to happen whenever the
+     * directory tree changes.
+     */
+    void FlattenTree();
+
     void UpdateAffectedNodes(const FileEvent& notification);
 
     void UpdateAncestorSizes(Tree<VizBlock>::Node* node);
@@ -268,6 +307,9 @@ class BaseModel
     // signaling framework; any type passed through it needs to be copy-constructible.
     std::shared_ptr<Tree<VizBlock>> m_fileTree; ///< @todo Does this need a mutex?
 
+    // Passes over the entire tree sweep over this flattened copy instead of walking the tree.
+    FlatTree m_flatTree;
+
     // While only a single node can be "selected" at any given time, multiple nodes can be
     // "highlighted." This vector tracks those highlighted nodes.
     std::vector<const Tree<VizBlock>::Node*> m_highlightedNodes;
@@ -0,0 +1,137 @@
+#ifndef FLATTREE_H
+#define FLATTREE_H
+
+#include "Model/vizBlock.h"
+
+#include <Tree/Tree.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief A flattened copy of the directory tree's structure, laid out so that whole-tree passes
+ * can sweep over contiguous arrays instead of chasing pointers from one node to the next.
+ *
+ * Nodes are numbered in pre-order, such that every node comes before all of its descendants, and
+ * such that the subtree rooted at any given node occupies the contiguous range of indices starting
+ * at that node and ending at `GetSubtreeEnd(...)`. Each attribute that the sweeps need is kept in
+ * a column of its own, and every index maps back onto the node that it was built from.
+ *
+ * The flat tree is a snapshot; any change to the structure of the tree, or to the files in it,
+ * requires that the flat tree be rebuilt.
+ */
+class FlatTree
+{
+  public:
+    using Index = std::uint32_t;
+
+    constexpr static auto NoIndex = std::numeric_limits<Index>::max();
+
+    FlatTree() = default;
+
+    /**
+     * @brief Flattens the given tree, and records the index of each node in the node itself, such
+     * that nodes can be mapped back onto their indices.
+     *
+     * @param[in, out] tree       The tree to flatten.
+     */
+    explicit FlatTree(Tree<VizBlock>& tree);
+
+    /**
+     * @returns The number of nodes in the flat tree.
+     */
+    Index GetSize() const noexcept
+    {
+        return static_cast<Index>(m_nodes.size());
+    }
+
+    /**
+     * @returns The parent of the node at the given index, or `NoIndex` for the root.
+     */
+    Index GetParent(Index index) const noexcept
+    {
+        return m_parents[index];
+    }
+
+    /**
+     * @returns One past the index of the last descendant of the node at the given index.
+     */
+    Index GetSubtreeEnd(Index index) const noexcept
+    {
+        return m_subtreeEnds[index];
+    }
+
+    bool HasChildren(Index index) const noexcept
+    {
+        return m_subtreeEnds[index] != index + 1;
+    }
+
+    /**
+     * @returns The first child of the node at the given index, or `NoIndex` if it has none.
+     */
+    Index GetFirstChild(Index index) const noexcept
+    {
+        return HasChildren(index) ? index + 1 : NoIndex;
+    }
+
+    /**
+     * @returns The next sibling of the node at the given index, or `NoIndex` if it has none.
+     */
+    Index GetNextSibling(Index index) const noexcept
+    {
+        const auto parent = m_parents[index];
+        if (parent == NoIndex) {
+            return NoIndex;
+        }
+
+        const auto candidate = m_subtreeEnds[index];
+        return candidate < m_subtreeEnds[parent] ? candidate : NoIndex;
+    }
+
+    /**
+     * @returns The index of the given node, or `NoIndex` if the node isn't part of the flat tree.
+     */
+    Index IndexOf(const Tree<VizBlock>::Node& node) const noexcept;
+
+    /**
+     * @returns The node that the given index was built from.
+     */
+    Tree<VizBlock>::Node& GetNode(Index index) const noexcept
+    {
+        return *m_nodes[index];
+    }
+
+    const std::vector<std::uintmax_t>& GetSizes() const noexcept
+    {
+        return m_sizes;
+    }
+
+    const std::vector<FileType>& GetTypes() const noexcept
+    {
+        return m_types;
+    }
+
+    const std::vector<Scanner::ArenaName>& GetNames() const noexcept
+    {
+        return m_names;
+    }
+
+    const std::vector<Scanner::Extension>& GetExtensions() const noexcept
+    {
+        return m_extensions;
+    }
+
+  private:
+    std::vector<Index> m_parents;
+    std::vector<Index> m_subtreeEnds;
+
+    std::vector<std::uintmax_t> m_sizes;
+    std::vector<FileType> m_types;
+    std::vector<Scanner::ArenaName> m_names;
+    std::vector<Scanner::Extension> m_extensions;
+
+    std::vector<Tree<VizBlock>::Node*> m_nodes;
+};
+
+#endif // FLATTREE_H
@@ -0,0 +1,84 @@
+#ifndef SCANSNAPSHOT_H
+#define SCANSNAPSHOT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <Tree/Tree.hpp>
+
+#include "Model/baseModel.h"
+#include "Model/vizBlock.h"
+
+/**
+ * @brief Persists scan results to disk, so that a previous scan can be reopened without having to
+ * scan the filesystem all over again.
+ *
+ * A snapshot consists of a fixed-size header, followed by a table of unique file extensions, a
+ * fixed-size record for every node in the tree (stored in pre-order), an optional record with
+ * the treemap layout of every node, and finally a table holding all of the strings. Since every
+ * record is of a fixed size, a snapshot can be memory-mapped and walked through directly, with
+ * the tree being rebuilt in a single pass, and without any actual parsing.
+ *
+ * The header carries a format version, as well as a CRC-32 checksum over everything that follows
+ * it, so that stale or damaged snapshots are rejected rather than misinterpreted. Snapshots are
+ * written in the byte order of the machine that wrote them, and are rejected by machines of the
+ * opposite byte order.
+ */
+namespace Snapshot
+{
+    /**
+     * @brief The version of the snapshot format written by this build. Any change to the layout of
+     * the file must be accompanied by an increment of this number.
+     */
+    inline constexpr std::uint32_t FormatVersion = 2;
+
+    /**
+     * @brief The extension conventionally used for snapshot files.
+     */
+    inline constexpr auto& FileExtension = ".dviz";
+
+    /**
+     * @brief Everything that can be restored from a snapshot.
+     */
+    struct Contents
+    {
+        std::shared_ptr<Tree<VizBlock>> tree;
+        TreemapMetadata metadata;
+
+        // True if every node's block was restored, in which case the tree need not be parsed
+        // again before it can be rendered.
+        bool hasLayout = false;
+    };
+
+    /**
+     * @brief Writes the given tree to disk. The snapshot is first written to a temporary file,
+     * which then replaces any existing file at the destination, so that an interrupted save never
+     * leaves a truncated snapshot behind.
+     *
+     * @param[in] path                  The destination of the snapshot.
+     * @param[in] tree                  The tree to be saved.
+     * @param[in] metadata              Metadata describing the scan.
+     * @param[in] shouldIncludeLayout   Whether the treemap layout of every node should be saved as
+     *                                  well, which saves having to recompute the layout on load.
+     *
+     * @throws std::runtime_error if the snapshot could not be written.
+     */
+    void Save(
+        const std::filesystem::path& path, const Tree<VizBlock>& tree,
+        const TreemapMetadata& metadata, bool shouldIncludeLayout);
+
+    /**
+     * @brief Reads a snapshot back from disk.
+     *
+     * @param[in] path                  The snapshot to be read.
+     *
+     * @returns The restored tree, along with its metadata.
+     *
+     * @throws std::runtime_error if the snapshot could not be read, was written by an incompatible
+     * version, or fails validation.
+     */
+    Contents Load(const std::filesystem::path& path);
+} // namespace Snapshot
+
+#endif // SCANSNAPSHOT_H
@@ -0,0 +1,78 @@
+#ifndef SCANSUMMARY_H
+#define SCANSUMMARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <Tree/Tree.hpp>
+
+#include "Model/vizBlock.h"
+
+/**
+ * @brief Boils a scanned tree down to the handful of figures that are worth reporting when there
+ * is no visualization to explore, such as when scanning from the command line.
+ */
+namespace Summary
+{
+    /**
+     * @brief A single file or directory, along with its size.
+     */
+    struct RankedEntry
+    {
+        std::filesystem::path path;
+        std::uintmax_t size = 0;
+
+        // Less than 100 if the size was estimated by an overview scan.
+        std::uint8_t confidence = 100;
+    };
+
+    /**
+     * @brief The files that share a single extension. Files without an extension are tallied
+     * under an empty extension.
+     */
+    struct ExtensionTally
+    {
+        std::string extension;
+        std::uintmax_t totalSize = 0;
+        std::uintmax_t fileCount = 0;
+    };
+
+    /**
+     * @brief Everything that is reported about a single scan.
+     */
+    struct Report
+    {
+        std::filesystem::path root;
+
+        std::uintmax_t totalSize = 0;
+        std::uintmax_t fileCount = 0;
+        std::uintmax_t directoryCount = 0; ///< Excluding the root itself.
+
+        // Both lists are sorted from largest to smallest.
+        std::vector<RankedEntry> largestDirectories;
+        std::vector<RankedEntry> largestFiles;
+
+        // Sorted from the largest total size to the smallest.
+        std::vector<ExtensionTally> extensions;
+
+        // False if the scan was cancelled, in which case everything above only covers what was
+        // scanned up to that point.
+        bool isComplete = true;
+    };
+
+    /**
+     * @brief Summarizes the given tree in a single pass.
+     *
+     * @param[in] tree            The tree to summarize, as produced by a completed or a
+     *                            cancelled scan.
+     * @param[in] entryLimit      The number of directories and files to rank.
+     *
+     * @returns The summary.
+     */
+    Report Summarize(const Tree<VizBlock>& tree, std::size_t entryLimit);
+} // namespace Summary
+
+#endif // SCANSUMMARY_H
@@ -25,6 +25,7 @@ class VizBlock
     explicit VizBlock(FileInfo file);
 
     constexpr static auto NotInVBO = std::numeric_limits<std::uint32_t>::max();
+    constexpr static auto NotInFlatTree = std::numeric_limits<std::uint32_t>::max();
 
     FileInfo file;     //< The file that the block represents.
     Block block;       //< The actual block as rendered to the OpenGL canvas.
@@ -32,6 +33,9 @@ class VizBlock
 
     /** The offset of this node into the VBO once the visualization has been generated */
     std::uint32_t offsetIntoVBO = VizBlock::NotInVBO;
+
+    /** The position of this node in the model's `FlatTree`, once the tree has been flattened */
+    std::uint32_t indexInFlatTree = VizBlock::NotInFlatTree;
 };
 
 #endif // VIZNODE_H
@@ -153,6 +153,138 @@ namespace Settings
          */
         bool ShouldUseDarkMode() const;
 
+        /**
+         * @brief Toggles the use of the asynchronous (io_uring) scanning engine. This setting is
+         * ignored on platforms where the engine isn't supported.
+         */
+        void UseAsynchronousScanning(bool isEnabled);
+
+        /**
+         * @return True if the asynchronous scanning engine should be used.
+         */
+        bool ShouldUseAsynchronousScanning() const;
+
+        /**
+         * @returns The maximum number of threads that the scanner may use, clamped between 0 and
+         * 64, inclusive. A value of zero lets the scanner pick its own ceiling.
+         */
+        int GetScanningThreadLimit() const;
+
+        /**
+         * @brief Sets the maximum number of threads that the scanner may use.
+         *
+         * @param[in] limit         A value between 0 and 64, inclusive.
+         */
+        void SetScanningThreadLimit(int limit);
+
+        /**
+         * @brief Toggles whether a file with multiple hard links should only be counted once.
+         */
+        void CountHardLinksOnce(bool isEnabled);
+
+        /**
+         * @return True if a file with multiple hard links should only be counted once.
+         */
+        bool ShouldCountHardLinksOnce() const;
+
+        /**
+         * @brief Toggles whether files should be sized by the space they occupy on disk, rather
+         * than by their apparent size.
+         */
+        void UseAllocatedFileSizes(bool isEnabled);
+
+        /**
+         * @return True if files should be sized by the space they occupy on disk.
+         */
+        bool ShouldUseAllocatedFileSizes() const;
+
+        /**
+         * @brief Toggles whether the scanner should refrain from crossing into other filesystems.
+         */
+        void StayOnFilesystem(bool isEnabled);
+
+        /**
+         * @return True if the scanner should stay on the filesystem that holds the scan root.
+         */
+        bool ShouldStayOnFilesystem() const;
+
+        /**
+         * @brief Toggles whether the files in each directory should be stat-ed in inode order,
+         * which speeds up scans of spinning disks. This setting is ignored on Windows.
+         */
+        void StatInInodeOrder(bool isEnabled);
+
+        /**
+         * @return True if the files in each directory should be stat-ed in inode order.
+         */
+        bool ShouldStatInInodeOrder() const;
+
+        /**
+         * @returns The number of milliseconds between snapshots of a scan in progress, clamped
+         * between 0 and 60,000, inclusive. A value of zero disables the snapshots.
+         */
+        int GetPartialResultsInterval() const;
+
+        /**
+         * @brief Sets the number of milliseconds between snapshots of a scan in progress.
+         *
+         * @param[in] interval      A value between 0 and 60,000, inclusive.
+         */
+        void SetPartialResultsInterval(int interval);
+
+        /**
+         * @returns The number of directory entries that a scan may read before it starts leaving
+         * directories unexpanded. A value of zero means that everything is read.
+         */
+        int GetScanningEntryBudget() const;
+
+        /**
+         * @brief Sets the number of directory entries that a scan may read before it starts leaving
+         * directories unexpanded.
+         *
+         * @param[in] budget        A non-negative value, where zero means that everything is read.
+         */
+        void SetScanningEntryBudget(int budget);
+
+        /**
+         * @brief Toggles whether scans should run at the lowest CPU and I/O priority, so as to not
+         * get in the way of anything else running on the machine.
+         */
+        void ScanInBackground(bool isEnabled);
+
+        /**
+         * @return True if scans should run at the lowest CPU and I/O priority.
+         */
+        bool ShouldScanInBackground() const;
+
+        /**
+         * @returns The number of filesystem operations per second that a scan in the background
+         * may issue. A value of zero means that there's no limit.
+         */
+        int GetScanOperationLimit() const;
+
+        /**
+         * @brief Sets the number of filesystem operations per second that a scan in the
+         * background may issue.
+         *
+         * @param[in] limit         A non-negative value, where zero means that there's no limit.
+         */
+        void SetScanOperationLimit(int limit);
+
+        /**
+         * @returns The number of seconds between checkpoints of a scan in progress, clamped between
+         * 0 and 3,600, inclusive. A value of zero disables the checkpoints, and with them the
+         * ability to resume a scan that didn't finish.
+         */
+        int GetCheckpointInterval() const;
+
+        /**
+         * @brief Sets the number of seconds between checkpoints of a scan in progress.
+         *
+         * @param[in] interval      A value between 0 and 3,600, inclusive.
+         */
+        void SetCheckpointInterval(int interval);
+
         /**
          * @brief Saves all settings to disk.
          *
@@ -35,7 +35,7 @@ namespace Utilities
                 Tree<VizBlock>::SiblingIterator{ node->GetFirstChild() },
                 Tree<VizBlock>::SiblingIterator{}, [&](const auto& childNode) {
                     const auto pathElement = filePathItr->string();
-                    const auto fileName = childNode->file.name + childNode->file.extension;
+                    const auto fileName = childNode->file.GetFullName();
 
                     return fileName == pathElement;
                 });
@@ -64,7 +64,7 @@ namespace Utilities
     inline static Tree<VizBlock>::Node*
     FindNodeViaAbsolutePath(Tree<VizBlock>::Node* rootNode, const std::filesystem::path& path)
     {
-        std::filesystem::path rootPath = rootNode->GetData().file.name;
+        std::filesystem::path rootPath = rootNode->GetData().file.name.View();
         const auto relativePath = std::filesystem::relative(path, rootPath);
 
         return FindNodeViaRelativePath(rootNode, relativePath);
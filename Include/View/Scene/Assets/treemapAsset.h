@@ -118,7 +118,7 @@ namespace Assets
 
         void ComputeAppropriateBlockColor(const Tree<VizBlock>::Node& node);
 
-        void FindLargestDirectory(const Tree<VizBlock>& tree);
+        void FindLargestDirectory(const FlatTree& tree);
 
         void InitializeReferenceBlock();
         void InitializeColors();
@@ -87,7 +87,10 @@ class FileMenu : public QMenu
 {
   public:
     QAction newScan;
+    QAction rescan;
     QAction cancelScan;
+    QAction openSnapshot;
+    QAction saveSnapshot;
     QAction exit;
 };
 
@@ -264,6 +267,12 @@ class MainWindow final : public QMainWindow, public BaseView
   private slots:
     void OnFileMenuNewScan();
 
+    void OnFileMenuRescan();
+
+    void OnFileMenuOpenSnapshot();
+
+    void OnFileMenuSaveSnapshot();
+
     void OnFpsReadoutToggled(bool isEnabled);
 
     void OnShowLightingOptionsToggled(bool isEnabled);
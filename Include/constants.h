@@ -69,8 +69,33 @@ namespace Constants
 
     namespace Concurrency
     {
-        [[maybe_unused]] inline constexpr auto ThreadLimit = 4u;
-    }
+        // The scanner starts out with this many threads, and then adjusts the number of threads
+        // based on the throughput that it observes, never exceeding the maximum.
+        [[maybe_unused]] inline constexpr auto InitialThreadCount = 4u;
+        [[maybe_unused]] inline constexpr auto MaximumThreadCount = 64u;
+
+        [[maybe_unused]] inline constexpr auto TaskQueueCapacity = 1024u;
+
+        // Directories are held open so that their subdirectories can be opened relative to them,
+        // but never more than this many at once, nor more than half of the descriptor limit.
+        [[maybe_unused]] inline constexpr auto MaximumOpenDirectoryCount = 4096u;
+
+        // How often, in milliseconds, a snapshot of the scan in progress may be published.
+        [[maybe_unused]] inline constexpr auto DefaultPartialResultsInterval = 1000;
+        [[maybe_unused]] inline constexpr auto MaximumPartialResultsInterval = 60000;
+
+        // A scan that runs in the background does so at the lowest CPU priority, in terms of the
+        // niceness of its threads.
+        [[maybe_unused]] inline constexpr auto BackgroundNiceness = 19;
+
+        // A scan with an operation limit may burst through this many milliseconds worth of
+        // filesystem operations at once before the limit kicks in.
+        [[maybe_unused]] inline constexpr auto OperationBurstInterval = 100;
+
+        // How often, in seconds, a scan in progress writes what it has read so far to its journal.
+        [[maybe_unused]] inline constexpr auto DefaultCheckpointInterval = 30;
+        [[maybe_unused]] inline constexpr auto MaximumCheckpointInterval = 3600;
+    } // namespace Concurrency
 
     namespace Logging
     {
@@ -98,6 +123,17 @@ namespace Constants
         [[maybe_unused]] inline constexpr auto& ShowDebuggingMenu = "showDebuggingMenu";
         [[maybe_unused]] inline constexpr auto& MonitorFileSystem = "monitorFileSystem";
         [[maybe_unused]] inline constexpr auto& UseDarkMode = "useDarkMode";
+        [[maybe_unused]] inline constexpr auto& UseAsynchronousScanning = "useAsynchronousScanning";
+        [[maybe_unused]] inline constexpr auto& ScanningThreadLimit = "scanningThreadLimit";
+        [[maybe_unused]] inline constexpr auto& CountHardLinksOnce = "countHardLinksOnce";
+        [[maybe_unused]] inline constexpr auto& UseAllocatedFileSizes = "useAllocatedFileSizes";
+        [[maybe_unused]] inline constexpr auto& StayOnFilesystem = "stayOnFilesystem";
+        [[maybe_unused]] inline constexpr auto& PartialResultsInterval = "partialResultsInterval";
+        [[maybe_unused]] inline constexpr auto& ScanningEntryBudget = "scanningEntryBudget";
+        [[maybe_unused]] inline constexpr auto& StatInInodeOrder = "statInInodeOrder";
+        [[maybe_unused]] inline constexpr auto& CheckpointInterval = "checkpointInterval";
+        [[maybe_unused]] inline constexpr auto& ScanInBackground = "scanInBackground";
+        [[maybe_unused]] inline constexpr auto& ScanOperationLimit = "scanOperationLimit";
     } // namespace Preferences
 
     namespace Treemap
@@ -13,6 +13,7 @@
 #include "Factories/viewFactoryInterface.h"
 #include "Model/Monitor/fileChangeNotification.h"
 #include "Model/Scanner/driveScanner.h"
+#include "Model/flatTree.h"
 #include "Model/vizBlock.h"
 #include "Settings/nodePainter.h"
 #include "Settings/persistentSettings.h"
@@ -63,6 +64,38 @@ class Controller : public QObject
      */
     void ScanDrive(const Settings::VisualizationOptions& options);
 
+    /**
+     * @brief Scans the current root directory again. Only the directories that have changed since
+     * the previous scan are read again; everything else is carried over from the previous scan.
+     */
+    void RescanDrive();
+
+    /**
+     * @brief Scans an unexpanded directory in the background, and splices the results into the
+     * current tree in place of the directory's estimated size. Nothing happens while another scan
+     * is still underway.
+     *
+     * Note that a file with several hard links may be counted again if one of its other links lies
+     * outside of the directory, even if hard links are only meant to be counted once.
+     *
+     * @param[in] node            The unexpanded directory.
+     */
+    void ExpandNode(const Tree<VizBlock>::Node& node);
+
+    /**
+     * @brief Restores a previous scan from a snapshot, instead of scanning the drive again.
+     *
+     * @param[in] snapshotPath    The snapshot to load.
+     */
+    void LoadSnapshot(const std::filesystem::path& snapshotPath);
+
+    /**
+     * @brief Saves the current visualization to a snapshot, so that it can be reopened later.
+     *
+     * @param[in] snapshotPath    Where to save the snapshot.
+     */
+    void SaveSnapshot(const std::filesystem::path& snapshotPath);
+
     /**
      * @brief Stops any active drive scanner.
      */
@@ -88,6 +121,11 @@ class Controller : public QObject
      */
     const Tree<VizBlock>& GetTree() const;
 
+    /**
+     * @returns A flattened copy of the tree that represents the most recent drive scan.
+     */
+    const FlatTree& GetFlatTree() const;
+
     /**
      * @returns A reference to the currently highlighted nodes. Highlighted nodes are distinct
      * from the selected node (of which there can be only one).
@@ -328,6 +366,18 @@ class Controller : public QObject
     void OnScanComplete(
         const ScanningProgress& progress, const std::shared_ptr<Tree<VizBlock>>& scanningResults);
 
+    void OnPartialResults(const std::shared_ptr<Tree<VizBlock>>& partialResults);
+
+    void OnExpansionComplete(
+        const std::filesystem::path& path, const ScanningProgress& progress,
+        const std::shared_ptr<Tree<VizBlock>>& subtree);
+
+    void ApplyScanningPreferences(ScanningOptions& options) const;
+
+    void StartScan(
+        const Settings::VisualizationOptions& options,
+        std::shared_ptr<const Tree<VizBlock>> previousScan);
+
     ViewFactoryInterface& m_viewFactory;
     ModelFactoryInterface& m_modelFactory;
 
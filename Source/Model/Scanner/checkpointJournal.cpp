@@ -0,0 +1,650 @@
+#include "Model/Scanner/checkpointJournal.h"
+#include "Model/Scanner/nameArena.h"
+#include "Model/Scanner/scanningOptions.h"
+
+#include "constants.h"
+
+#include <boost/crc.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr std::array<char, 8> Magic = { 'D', '-', 'V', 'i', 'z', 'J', 'n', 'l' };
+
+    constexpr std::uint32_t FormatVersion = 1;
+
+    // Written in the byte order of the writing machine, so that a reader of the opposite byte order
+    // will see it scrambled.
+    constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+    // No single record should ever come close to this size; anything larger means that the size
+    // itself is damaged.
+    constexpr std::uint32_t MaximumRecordSize = 1u << 30;
+    constexpr std::uint32_t MaximumRootLength = 1u << 16;
+
+    // Set on a child that was excluded from the scan, or that was left unexpanded, respectively.
+    constexpr std::uint8_t IsExcludedFlag = 1;
+    constexpr std::uint8_t IsUnexpandedFlag = 2;
+
+    /**
+     * @brief The kinds of records that make up a journal.
+     */
+    enum class RecordKind : std::uint8_t
+    {
+        Session, ///< Marks the start of a new scan; identifiers are only unique within a session.
+        Listing, ///< A directory, along with everything in it.
+        Reuse    ///< A directory that was carried over from an earlier session.
+    };
+
+    struct Header
+    {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrderMark;
+        std::uint32_t sizeMetric;
+        std::uint32_t rootLength; ///< The length of the root path that follows the header.
+    };
+
+    static_assert(sizeof(Header) == 24, "Changing the header requires a new format version.");
+    static_assert(std::is_trivially_copyable<Header>::value, "Must be trivially copyable.");
+
+    /**
+     * @brief A record, as read back from the journal.
+     */
+    struct DecodedRecord
+    {
+        RecordKind kind = RecordKind::Session;
+        Scanner::CheckpointJournal::DirectoryId id = 0;
+        Scanner::CheckpointJournal::DirectoryId parentId = 0;
+        std::uint64_t changeStamp = 0;
+        std::string name;
+        std::vector<FileInfo> children;
+    };
+
+    template <typename ValueType> void AppendValue(std::string& buffer, ValueType value)
+    {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void AppendString(std::string& buffer, std::string_view value)
+    {
+        AppendValue(buffer, static_cast<std::uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    /**
+     * @brief Reads values back out of an encoded record, while guarding against reading past its
+     * end.
+     */
+    class RecordDecoder
+    {
+      public:
+        explicit RecordDecoder(const std::string& payload) noexcept
+            : m_position{ payload.data() }, m_end{ payload.data() + payload.size() }
+        {
+        }
+
+        template <typename ValueType> ValueType Read() noexcept
+        {
+            ValueType value{};
+            if (static_cast<std::size_t>(m_end - m_position) < sizeof(value)) {
+                m_isValid = false;
+                return value;
+            }
+
+            std::memcpy(&value, m_position, sizeof(value));
+            m_position += sizeof(value);
+
+            return value;
+        }
+
+        std::string_view ReadString()
+        {
+            const auto length = Read<std::uint32_t>();
+            if (!m_isValid || static_cast<std::size_t>(m_end - m_position) < length) {
+                m_isValid = false;
+                return {};
+            }
+
+            std::string_view value{ m_position, length };
+            m_position += length;
+
+            return value;
+        }
+
+        bool IsValid() const noexcept
+        {
+            return m_isValid;
+        }
+
+      private:
+        const char* m_position;
+        const char* m_end;
+
+        bool m_isValid = true;
+    };
+
+    /**
+     * @returns The decoded record, or nothing if the payload doesn't describe a valid record. The
+     * names of the children are stored in the given arena.
+     */
+    std::optional<DecodedRecord>
+    DecodeRecord(const std::string& payload, Scanner::NameArena& nameArena)
+    {
+        RecordDecoder decoder{ payload };
+
+        DecodedRecord record;
+        record.kind = static_cast<RecordKind>(decoder.Read<std::uint8_t>());
+
+        if (record.kind == RecordKind::Session) {
+            return decoder.IsValid() ? std::optional{ std::move(record) } : std::nullopt;
+        }
+
+        if (record.kind != RecordKind::Listing && record.kind != RecordKind::Reuse) {
+            return std::nullopt;
+        }
+
+        record.id = decoder.Read<std::uint64_t>();
+        record.parentId = decoder.Read<std::uint64_t>();
+        record.changeStamp = decoder.Read<std::uint64_t>();
+        record.name = decoder.ReadString();
+
+        if (record.kind == RecordKind::Listing) {
+            const auto childCount = decoder.Read<std::uint32_t>();
+
+            for (std::uint32_t index = 0; index < childCount && decoder.IsValid(); ++index) {
+                const auto type = decoder.Read<std::uint8_t>();
+                const auto flags = decoder.Read<std::uint8_t>();
+                const auto confidence = decoder.Read<std::uint8_t>();
+                const auto size = decoder.Read<std::uint64_t>();
+                const auto name = decoder.ReadString();
+                const auto extension = decoder.ReadString();
+
+                if (type > static_cast<std::uint8_t>(FileType::Symlink) || confidence > 100) {
+                    return std::nullopt;
+                }
+
+                FileInfo child{ Scanner::StoreFileName(name, extension, nameArena), size,
+                                static_cast<FileType>(type) };
+
+                child.isExcluded = (flags & IsExcludedFlag) != 0;
+                child.isUnexpanded = (flags & IsUnexpandedFlag) != 0;
+                child.confidence = confidence;
+
+                record.children.emplace_back(std::move(child));
+            }
+        }
+
+        return decoder.IsValid() ? std::optional{ std::move(record) } : std::nullopt;
+    }
+
+    /**
+     * @brief Rebuilds the tree from the records of one session after the other. Since a later
+     * session only records what it had to read again, its records are laid over whatever the
+     * earlier sessions left behind.
+     */
+    class TreeRestorer
+    {
+        // The nodes of the directories recorded so far in the current session, by identifier.
+        using NodeMap =
+            std::unordered_map<Scanner::CheckpointJournal::DirectoryId, Tree<VizBlock>::Node*>;
+
+      public:
+        explicit TreeRestorer(const std::filesystem::path& root)
+            : m_nameArena{ std::make_shared<Scanner::NameArena>() },
+              m_tree{ Scanner::CreateTree(
+                  VizBlock{ FileInfo{ m_nameArena->Store(root.string()), Scanner::Extension{}, 0,
+                                      FileType::Directory } },
+                  m_nameArena) }
+        {
+        }
+
+        /**
+         * @returns The arena in which to store the names of the restored files.
+         */
+        Scanner::NameArena& GetNameArena() noexcept
+        {
+            return *m_nameArena;
+        }
+
+        /**
+         * @brief Applies all records of a single session to the tree.
+         */
+        void ApplySession(std::vector<DecodedRecord>& records)
+        {
+            // Parents are always assigned lower identifiers than their children, but the records
+            // weren't necessarily written in that order.
+            std::sort(std::begin(records), std::end(records), [](const auto& lhs, const auto& rhs) {
+                return lhs.id < rhs.id;
+            });
+
+            NodeMap nodes;
+
+            for (auto& record : records) {
+                auto* const node = FindNode(record, nodes);
+                if (!node) {
+                    // The parent's record was lost, so this directory will simply be read again.
+                    continue;
+                }
+
+                nodes.emplace(record.id, node);
+
+                if (record.kind == RecordKind::Listing) {
+                    ReplaceListing(*node, record);
+                } else if (m_listedDirectories.count(node) > 0) {
+                    // A directory that was carried over was unchanged, but it's the most recent
+                    // stamp that the next scan should compare against all the same.
+                    (*node)->file.changeStamp = record.changeStamp;
+                }
+            }
+        }
+
+        /**
+         * @returns The restored tree, or a null pointer if not even the root was restored.
+         */
+        std::shared_ptr<Tree<VizBlock>> GetTree() const
+        {
+            return m_hasRoot ? m_tree : nullptr;
+        }
+
+        /**
+         * @returns The number of directories whose listing was restored.
+         */
+        std::size_t GetDirectoryCount() const noexcept
+        {
+            return m_directoryCount;
+        }
+
+      private:
+        Tree<VizBlock>::Node* FindNode(const DecodedRecord& record, const NodeMap& nodes) const
+        {
+            if (record.parentId == Scanner::CheckpointJournal::NoParent) {
+                return m_tree->GetRoot();
+            }
+
+            const auto parent = nodes.find(record.parentId);
+            if (parent == std::end(nodes)) {
+                return nullptr;
+            }
+
+            const auto subdirectories = m_subdirectories.find(parent->second);
+            if (subdirectories == std::end(m_subdirectories)) {
+                return nullptr;
+            }
+
+            const auto match = subdirectories->second.find(record.name);
+            return match != std::end(subdirectories->second) ? match->second : nullptr;
+        }
+
+        void ReplaceListing(Tree<VizBlock>::Node& node, DecodedRecord& record)
+        {
+            // The directory changed since it was last recorded, but, just like a rescan, a later
+            // session will have matched up its subdirectories by name, and may well have carried
+            // them over without recording their listings again. Whatever was restored below a
+            // subdirectory that is still around is therefore kept, while everything else makes
+            // way for the new listing.
+            auto previousSubdirectories = std::move(m_subdirectories[&node]);
+            m_subdirectories.erase(&node);
+
+            std::unordered_set<std::string> remainingSubdirectories;
+            for (const auto& child : record.children) {
+                if (IsExpandedDirectory(child)) {
+                    remainingSubdirectories.emplace(child.GetFullName());
+                }
+            }
+
+            auto* child = node.GetFirstChild();
+            while (child) {
+                auto* const nextChild = child->GetNextSibling();
+
+                const auto match = previousSubdirectories.find((*child)->file.GetFullName());
+                const auto isMatch =
+                    match != std::end(previousSubdirectories) && match->second == child;
+
+                if (!isMatch || remainingSubdirectories.count(match->first) == 0) {
+                    if (isMatch) {
+                        previousSubdirectories.erase(match);
+                    }
+
+                    ForgetSubtree(*child);
+                    child->DeleteFromTree();
+                }
+
+                child = nextChild;
+            }
+
+            node->file.changeStamp = record.changeStamp;
+
+            for (auto& child : record.children) {
+                auto name = child.GetFullName();
+                const auto isDirectory = child.type == FileType::Directory;
+
+                Tree<VizBlock>::Node* childNode = nullptr;
+
+                const auto match = IsExpandedDirectory(child)
+                                       ? previousSubdirectories.find(name)
+                                       : std::end(previousSubdirectories);
+
+                if (match != std::end(previousSubdirectories)) {
+                    // The subdirectory's own stamp comes from its own listing, if it has one.
+                    childNode = match->second;
+
+                    const auto changeStamp = (*childNode)->file.changeStamp;
+                    (*childNode)->file = child;
+                    (*childNode)->file.changeStamp = changeStamp;
+                } else {
+                    childNode = node.AppendChild(VizBlock{ std::move(child) });
+                }
+
+                if (isDirectory) {
+                    m_subdirectories[&node].emplace(std::move(name), childNode);
+                }
+            }
+
+            m_listedDirectories.emplace(&node);
+
+            m_hasRoot = m_hasRoot || &node == m_tree->GetRoot();
+            ++m_directoryCount;
+        }
+
+        /**
+         * @returns True if the file is a directory that the scan would have read, rather than one
+         * that it kept as a leaf.
+         */
+        static bool IsExpandedDirectory(const FileInfo& file) noexcept
+        {
+            return file.type == FileType::Directory && !file.isExcluded && !file.isUnexpanded;
+        }
+
+        void ForgetSubtree(Tree<VizBlock>::Node& root)
+        {
+            std::vector<Tree<VizBlock>::Node*> pendingNodes = { &root };
+            while (!pendingNodes.empty()) {
+                auto* const node = pendingNodes.back();
+                pendingNodes.pop_back();
+
+                m_subdirectories.erase(node);
+                m_listedDirectories.erase(node);
+
+                for (auto* child = node->GetFirstChild(); child; child = child->GetNextSibling()) {
+                    pendingNodes.emplace_back(child);
+                }
+            }
+        }
+
+        std::shared_ptr<Scanner::NameArena> m_nameArena;
+        std::shared_ptr<Tree<VizBlock>> m_tree;
+
+        // The subdirectories of every restored directory, by name.
+        std::unordered_map<
+            const Tree<VizBlock>::Node*, std::unordered_map<std::string, Tree<VizBlock>::Node*>>
+            m_subdirectories;
+
+        // The directories whose listing was restored, as opposed to mere placeholders.
+        std::unordered_set<const Tree<VizBlock>::Node*> m_listedDirectories;
+
+        std::size_t m_directoryCount = 0;
+        bool m_hasRoot = false;
+    };
+} // namespace
+
+namespace Scanner
+{
+    std::filesystem::path CheckpointJournal::DeterminePath(
+        const std::filesystem::path& directory, const std::filesystem::path& root)
+    {
+        const auto fileName =
+            fmt::format("{:016x}{}", std::filesystem::hash_value(root), FileExtension);
+
+        return directory / fileName;
+    }
+
+    bool CheckpointJournal::Open(
+        const std::filesystem::path& path, const std::filesystem::path& root,
+        FileSizeMetric sizeMetric, std::uintmax_t intactSize)
+    {
+        m_path = path;
+
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+
+        if (intactSize > 0) {
+            // A record that was cut short would otherwise end up in front of the new session,
+            // where it would keep the next restore from ever getting past it.
+            std::filesystem::resize_file(path, intactSize, errorCode);
+            if (errorCode) {
+                return false;
+            }
+
+            m_stream.open(path, std::ios::binary | std::ios::app);
+        } else {
+            m_stream.open(path, std::ios::binary | std::ios::trunc);
+
+            const auto rootPath = root.string();
+
+            Header header{};
+            header.magic = Magic;
+            header.version = FormatVersion;
+            header.byteOrderMark = ByteOrderMark;
+            header.sizeMetric = static_cast<std::uint32_t>(sizeMetric);
+            header.rootLength = static_cast<std::uint32_t>(rootPath.size());
+
+            m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            m_stream.write(rootPath.data(), static_cast<std::streamsize>(rootPath.size()));
+        }
+
+        std::string payload;
+        AppendValue(payload, RecordKind::Session);
+        Append(payload);
+
+        if (!Flush()) {
+            m_stream.close();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CheckpointJournal::IsOpen() const noexcept
+    {
+        return m_stream.is_open();
+    }
+
+    void CheckpointJournal::RecordListing(
+        DirectoryId id, DirectoryId parentId, const Tree<VizBlock>::Node& directory)
+    {
+        // Encoding the record outside of the lock keeps the lock uncontended for even longer.
+        thread_local std::string payload;
+        payload.clear();
+
+        const auto& file = directory->file;
+
+        AppendValue(payload, RecordKind::Listing);
+        AppendValue(payload, static_cast<std::uint64_t>(id));
+        AppendValue(payload, static_cast<std::uint64_t>(parentId));
+        AppendValue(payload, file.changeStamp);
+        AppendString(payload, file.GetFullName());
+        AppendValue(payload, static_cast<std::uint32_t>(directory.GetChildCount()));
+
+        const auto* child = directory.GetFirstChild();
+        for (; child; child = child->GetNextSibling()) {
+            const auto& childFile = child->GetData().file;
+
+            std::uint8_t flags = 0;
+            flags |= childFile.isExcluded ? IsExcludedFlag : 0;
+            flags |= childFile.isUnexpanded ? IsUnexpandedFlag : 0;
+
+            AppendValue(payload, static_cast<std::uint8_t>(childFile.type));
+            AppendValue(payload, flags);
+            AppendValue(payload, childFile.confidence);
+            AppendValue(payload, static_cast<std::uint64_t>(childFile.size));
+            AppendString(payload, childFile.name);
+            AppendString(payload, childFile.extension);
+        }
+
+        Append(payload);
+    }
+
+    void CheckpointJournal::RecordReuse(
+        DirectoryId id, DirectoryId parentId, const FileInfo& directory)
+    {
+        thread_local std::string payload;
+        payload.clear();
+
+        AppendValue(payload, RecordKind::Reuse);
+        AppendValue(payload, static_cast<std::uint64_t>(id));
+        AppendValue(payload, static_cast<std::uint64_t>(parentId));
+        AppendValue(payload, directory.changeStamp);
+        AppendString(payload, directory.GetFullName());
+
+        Append(payload);
+    }
+
+    void CheckpointJournal::Append(const std::string& payload)
+    {
+        boost::crc_32_type checksum;
+        checksum.process_bytes(payload.data(), payload.size());
+
+        // Threads are spread across the shards, so that a given thread will almost always find its
+        // shard's lock uncontended; only the flushing thread ever competes for it.
+        const auto shardIndex = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        auto& shard = m_shards[shardIndex % ShardCount];
+
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        AppendValue(shard.buffer, static_cast<std::uint32_t>(payload.size()));
+        AppendValue(shard.buffer, static_cast<std::uint32_t>(checksum.checksum()));
+        shard.buffer.append(payload);
+    }
+
+    bool CheckpointJournal::Flush()
+    {
+        for (auto& shard : m_shards) {
+            m_pendingBytes.clear();
+
+            {
+                std::lock_guard<std::mutex> lock{ shard.mutex };
+                shard.buffer.swap(m_pendingBytes);
+            }
+
+            m_stream.write(
+                m_pendingBytes.data(), static_cast<std::streamsize>(m_pendingBytes.size()));
+        }
+
+        // Once flushed, the records survive the process crashing, though not the machine doing so.
+        m_stream.flush();
+
+        return m_stream.good();
+    }
+
+    void CheckpointJournal::Close(bool shouldKeep)
+    {
+        if (!IsOpen()) {
+            return;
+        }
+
+        Flush();
+        m_stream.close();
+
+        if (!shouldKeep) {
+            std::error_code errorCode;
+            std::filesystem::remove(m_path, errorCode);
+        }
+    }
+
+    std::shared_ptr<Tree<VizBlock>> CheckpointJournal::Restore(
+        const std::filesystem::path& path, const std::filesystem::path& root,
+        FileSizeMetric sizeMetric, std::uintmax_t* intactSize)
+    {
+        std::ifstream stream{ path, std::ios::binary };
+        if (!stream) {
+            return nullptr;
+        }
+
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+        Header header{};
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if (!stream || header.magic != Magic || header.byteOrderMark != ByteOrderMark ||
+            header.version != FormatVersion || header.rootLength > MaximumRootLength) {
+            log->warn("Ignoring the unreadable scan journal at \"{}\".", path.string());
+            return nullptr;
+        }
+
+        std::string rootPath(header.rootLength, '\0');
+        stream.read(rootPath.data(), static_cast<std::streamsize>(rootPath.size()));
+
+        if (!stream || rootPath != root.string() ||
+            header.sizeMetric != static_cast<std::uint32_t>(sizeMetric)) {
+            log->info("The scan journal at \"{}\" belongs to a different scan.", path.string());
+            return nullptr;
+        }
+
+        TreeRestorer restorer{ root };
+
+        auto lastIntactOffset = static_cast<std::uintmax_t>(stream.tellg());
+
+        std::vector<DecodedRecord> session;
+        std::string payload;
+
+        while (true) {
+            std::uint32_t frame[2] = { 0, 0 };
+            stream.read(reinterpret_cast<char*>(frame), sizeof(frame));
+
+            const auto [size, expectedChecksum] = frame;
+            if (!stream || size > MaximumRecordSize) {
+                break;
+            }
+
+            payload.resize(size);
+            stream.read(payload.data(), static_cast<std::streamsize>(size));
+
+            boost::crc_32_type checksum;
+            checksum.process_bytes(payload.data(), payload.size());
+
+            // Whatever follows a record that was cut short, or that was damaged, is just as
+            // suspect, so it's all left for the resumed scan to read again.
+            if (!stream || checksum.checksum() != expectedChecksum) {
+                break;
+            }
+
+            auto record = DecodeRecord(payload, restorer.GetNameArena());
+            if (!record) {
+                break;
+            }
+
+            if (record->kind == RecordKind::Session) {
+                restorer.ApplySession(session);
+                session.clear();
+            } else {
+                session.emplace_back(std::move(*record));
+            }
+
+            lastIntactOffset = static_cast<std::uintmax_t>(stream.tellg());
+        }
+
+        restorer.ApplySession(session);
+
+        if (intactSize) {
+            *intactSize = lastIntactOffset;
+        }
+
+        log->info(
+            "Restored {:L} directories from the scan journal at \"{}\".",
+            restorer.GetDirectoryCount(), path.string());
+
+        return restorer.GetTree();
+    }
+} // namespace Scanner
@@ -0,0 +1,149 @@
+#include "Model/Scanner/concurrencyController.h"
+
+#include <algorithm>
+
+#include <gsl/assert>
+
+namespace
+{
+    // Changes in throughput that fall within this band are considered to be noise.
+    constexpr double ThroughputTolerance = 0.05;
+
+    // If shedding threads doesn't cost any throughput, but does reduce latency by more than this
+    // ratio, then the storage is likely saturated.
+    constexpr double LatencyTolerance = 1.25;
+
+    // After holding steady for this many samples, the controller will probe for more throughput.
+    constexpr unsigned int SamplesBeforeProbing = 8;
+} // namespace
+
+namespace Scanner
+{
+    ConcurrencyController::ConcurrencyController(
+        unsigned int minimumThreadCount, unsigned int maximumThreadCount,
+        unsigned int initialThreadCount) noexcept
+        : m_minimumThreadCount{ minimumThreadCount },
+          m_maximumThreadCount{ maximumThreadCount },
+          m_threadCount{ std::clamp(initialThreadCount, minimumThreadCount, maximumThreadCount) }
+    {
+        Expects(minimumThreadCount > 0);
+        Expects(minimumThreadCount <= maximumThreadCount);
+    }
+
+    unsigned int ConcurrencyController::Update(
+        std::uintmax_t entriesProcessed, std::chrono::nanoseconds busyTime,
+        std::chrono::nanoseconds elapsedTime) noexcept
+    {
+        const auto newEntries = entriesProcessed - m_previousEntriesProcessed;
+        const auto newBusyTime = busyTime - m_previousBusyTime;
+
+        m_previousEntriesProcessed = entriesProcessed;
+        m_previousBusyTime = busyTime;
+
+        // A single enormous directory can keep every thread busy without completing any entries
+        // for a while, in which case there's nothing to learn from this interval.
+        if (newEntries == 0 || elapsedTime.count() <= 0) {
+            return m_threadCount;
+        }
+
+        const auto elapsedSeconds = std::chrono::duration<double>(elapsedTime).count();
+
+        ThroughputSample sample;
+        sample.threadCount = m_threadCount;
+        sample.entriesPerSecond = static_cast<double>(newEntries) / elapsedSeconds;
+        sample.latencyInMicroseconds =
+            std::chrono::duration<double, std::micro>(newBusyTime).count() /
+            static_cast<double>(newEntries);
+
+        if (m_samples.empty()) {
+            m_samples.emplace_back(sample);
+            Step(1);
+
+            return m_threadCount;
+        }
+
+        const auto previous = m_samples.back();
+        m_samples.emplace_back(sample);
+
+        // Only compare samples taken at different levels of concurrency; otherwise we'd just be
+        // measuring noise.
+        if (previous.threadCount == sample.threadCount) {
+            if (++m_samplesSinceLastChange >= SamplesBeforeProbing) {
+                // Alternate between probing upwards and downwards, since the optimum could lie in
+                // either direction.
+                Step(m_probeDirection);
+                m_probeDirection = -m_probeDirection;
+            }
+
+            return m_threadCount;
+        }
+
+        const auto threadsWereAdded = sample.threadCount > previous.threadCount;
+        const auto throughputRatio = sample.entriesPerSecond / previous.entriesPerSecond;
+
+        if (m_isReverting) {
+            // The last change merely undid a bad move, so the comparison with the sample before it
+            // isn't meaningful. Sit tight for a while before probing again.
+            m_isReverting = false;
+            m_samplesSinceLastChange = 0;
+        } else if (throughputRatio > 1.0 + ThroughputTolerance) {
+            // Whatever we just did helped, so let's keep going.
+            Step(threadsWereAdded ? 1 : -1);
+        } else if (throughputRatio < 1.0 - ThroughputTolerance) {
+            // Whatever we just did hurt, so let's undo it.
+            Revert(previous.threadCount);
+        } else if (threadsWereAdded) {
+            // The additional threads aren't buying us anything, so we might as well not run them.
+            Revert(previous.threadCount);
+        } else if (
+            sample.latencyInMicroseconds * LatencyTolerance < previous.latencyInMicroseconds) {
+            // Fewer threads are getting just as much done, and are waiting on the storage for less
+            // time in the process, which suggests that the storage is saturated.
+            Step(-1);
+        } else {
+            // Hold steady.
+            m_samplesSinceLastChange = 0;
+        }
+
+        return m_threadCount;
+    }
+
+    unsigned int ConcurrencyController::GetThreadCount() const noexcept
+    {
+        return m_threadCount;
+    }
+
+    const std::vector<ThroughputSample>& ConcurrencyController::GetSamples() const noexcept
+    {
+        return m_samples;
+    }
+
+    unsigned int ConcurrencyController::ComputeStepSize() const noexcept
+    {
+        // Take larger steps when running many threads, so that the controller can find its way
+        // around a wide range of thread counts in a reasonable amount of time.
+        return std::max(1u, m_threadCount / 4);
+    }
+
+    void ConcurrencyController::Revert(unsigned int threadCount) noexcept
+    {
+        m_threadCount = threadCount;
+        m_samplesSinceLastChange = 0;
+        m_isReverting = true;
+    }
+
+    void ConcurrencyController::Step(int direction) noexcept
+    {
+        m_samplesSinceLastChange = 0;
+
+        const auto stepSize = ComputeStepSize();
+
+        if (direction > 0) {
+            m_threadCount = std::min(m_threadCount + stepSize, m_maximumThreadCount);
+        } else {
+            m_threadCount = m_threadCount > m_minimumThreadCount + stepSize
+                                ? m_threadCount - stepSize
+                                : m_minimumThreadCount;
+        }
+    }
+} // namespace Scanner
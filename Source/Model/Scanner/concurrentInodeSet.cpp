@@ -0,0 +1,45 @@
+#include "Model/Scanner/concurrentInodeSet.h"
+
+namespace
+{
+    /**
+     * @brief Inode numbers tend to be dense, so a cheap multiplicative mix is enough to spread them
+     * out across both the shards and the buckets within each shard.
+     */
+    std::uint64_t Mix(std::uint64_t device, std::uint64_t inode) noexcept
+    {
+        constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+        return (inode ^ (device << 32)) * multiplier;
+    }
+} // namespace
+
+namespace Scanner
+{
+    std::size_t ConcurrentInodeSet::KeyHasher::operator()(const Key& key) const noexcept
+    {
+        return static_cast<std::size_t>(Mix(key.device, key.inode));
+    }
+
+    bool ConcurrentInodeSet::Insert(std::uint64_t device, std::uint64_t inode)
+    {
+        const Key key{ device, inode };
+
+        // The upper bits of the hash are the best mixed, so use those to pick the shard.
+        auto& shard = m_shards[(Mix(device, inode) >> 58) % ShardCount];
+
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        return shard.keys.insert(key).second;
+    }
+
+    std::size_t ConcurrentInodeSet::Size() const
+    {
+        std::size_t size = 0;
+
+        for (const auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock{ shard.mutex };
+            size += shard.keys.size();
+        }
+
+        return size;
+    }
+} // namespace Scanner
@@ -13,10 +13,23 @@ void DriveScanner::HandleCompletion(const std::shared_ptr<Tree<VizBlock>>& fileT
 
     m_options.onScanCompletedCallback(m_progress, fileTree);
 
+    // There's no point in holding on to the results of the previous scan any longer.
+    m_options.previousTree.reset();
+
     m_isActive = false;
     emit Finished();
 }
 
+void DriveScanner::HandlePartialResults(const std::shared_ptr<Tree<VizBlock>>& fileTree)
+{
+    // A cancelled scan may still have a snapshot or two in flight, which are of no use to anyone.
+    if (!m_isActive) {
+        return;
+    }
+
+    m_options.onPartialResultsCallback(m_progress, fileTree);
+}
+
 void DriveScanner::HandleMessageBox(const QString& message)
 {
     QMessageBox messageBox;
@@ -45,6 +58,7 @@ void DriveScanner::StartScanning(const ScanningOptions& options)
 
     connect(worker, &ScanningWorker::Finished, this, &DriveScanner::HandleCompletion);
     connect(worker, &ScanningWorker::Finished, worker, &ScanningWorker::deleteLater);
+    connect(worker, &ScanningWorker::PartialResults, this, &DriveScanner::HandlePartialResults);
     connect(worker, &ScanningWorker::ProgressUpdate, this, &DriveScanner::HandleProgressUpdates);
     connect(
         worker, &ScanningWorker::ShowMessageBox, this, &DriveScanner::HandleMessageBox,
@@ -0,0 +1,228 @@
+#include "Model/Scanner/exclusionRules.h"
+#include "Model/Scanner/scanningUtilities.h"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+namespace
+{
+    /**
+     * @brief Matches a single character against the pattern element at the given position.
+     *
+     * @param[in] pattern         The glob pattern.
+     * @param[in] position        The position of a pattern element other than "*".
+     * @param[in] character       The character to match.
+     *
+     * @returns The position of the next pattern element if the character matches, and nothing
+     * otherwise.
+     */
+    std::optional<std::size_t>
+    MatchCharacter(std::string_view pattern, std::size_t position, char character) noexcept
+    {
+        if (pattern[position] == '?') {
+            return position + 1;
+        }
+
+        if (pattern[position] != '[') {
+            return pattern[position] == character ? std::optional{ position + 1 } : std::nullopt;
+        }
+
+        auto index = position + 1;
+
+        const auto isNegated =
+            index < pattern.size() && (pattern[index] == '!' || pattern[index] == '^');
+        if (isNegated) {
+            ++index;
+        }
+
+        // A closing bracket that immediately follows the opening one is taken literally.
+        const auto closingBracket = pattern.find(']', index + 1);
+        if (index >= pattern.size() || closingBracket == std::string_view::npos) {
+            // Without a closing bracket, the opening bracket is just an ordinary character.
+            return character == '[' ? std::optional{ position + 1 } : std::nullopt;
+        }
+
+        bool isMatch = false;
+        while (index < closingBracket) {
+            if (index + 2 < closingBracket && pattern[index + 1] == '-') {
+                isMatch |= pattern[index] <= character && character <= pattern[index + 2];
+                index += 3;
+            } else {
+                isMatch |= pattern[index] == character;
+                ++index;
+            }
+        }
+
+        return isMatch != isNegated ? std::optional{ closingBracket + 1 } : std::nullopt;
+    }
+
+    /**
+     * @returns The components of a name rule, as separated by slashes, leaving out empty ones.
+     */
+    std::vector<std::string> SplitIntoComponents(const std::string& pattern)
+    {
+        std::vector<std::string> components;
+
+        std::size_t start = 0;
+        while (start <= pattern.size()) {
+            const auto end = std::min(pattern.find('/', start), pattern.size());
+            if (end > start) {
+                components.emplace_back(pattern.substr(start, end - start));
+            }
+
+            start = end + 1;
+        }
+
+        return components;
+    }
+
+    bool IsGlobPattern(const std::string& pattern) noexcept
+    {
+        return pattern.find_first_of("*?[") != std::string::npos;
+    }
+} // namespace
+
+namespace Scanner
+{
+    ExclusionMatcher::ExclusionMatcher(
+        const ExclusionRules& rules, const std::filesystem::path& scanRoot)
+    {
+        for (const auto& name : rules.names) {
+            auto components = SplitIntoComponents(name);
+            if (components.empty()) {
+                continue;
+            }
+
+            if (components.size() > 1) {
+                if (IsGlobPattern(components.back())) {
+                    m_hasTrailingNamePatterns = true;
+                } else {
+                    m_trailingNames.emplace(components.back());
+                }
+
+                m_trailingPatterns.emplace_back(std::move(components));
+            } else if (IsGlobPattern(components.front())) {
+                m_namePatterns.emplace_back(std::move(components.front()));
+            } else {
+                m_literalNames.emplace(std::move(components.front()));
+            }
+        }
+
+        for (const auto& path : rules.paths) {
+            // Only paths that lie strictly below the scan root could ever be reached.
+            if (const auto resolvedPath = ResolveBelowScanRoot(path, scanRoot)) {
+                m_paths.emplace(resolvedPath->string());
+                m_pathNames.emplace(resolvedPath->filename().string());
+            }
+        }
+    }
+
+    bool ExclusionMatcher::IsEmpty() const noexcept
+    {
+        return m_literalNames.empty() && m_namePatterns.empty() && m_trailingPatterns.empty() &&
+               m_paths.empty();
+    }
+
+    bool ExclusionMatcher::IsExcluded(
+        const std::filesystem::path& parent, const std::string& name) const
+    {
+        return IsExcludedLazily(name, [&]() -> const std::filesystem::path& { return parent; });
+    }
+
+    bool ExclusionMatcher::IsExcludedByName(const std::string& name) const
+    {
+        if (m_literalNames.count(name) > 0) {
+            return true;
+        }
+
+        for (const auto& pattern : m_namePatterns) {
+            if (MatchesGlob(pattern, name)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ExclusionMatcher::IsExcludedByTrailingPath(
+        const std::filesystem::path& parent, const std::string& name) const
+    {
+        // The parent is only taken apart once a rule's last component has matched the name.
+        std::vector<std::string> parentComponents;
+        auto hasSplitParent = false;
+
+        for (const auto& components : m_trailingPatterns) {
+            if (!MatchesGlob(components.back(), name)) {
+                continue;
+            }
+
+            if (!hasSplitParent) {
+                for (const auto& component : parent) {
+                    if (!component.empty()) {
+                        parentComponents.emplace_back(component.string());
+                    }
+                }
+
+                hasSplitParent = true;
+            }
+
+            if (components.size() - 1 > parentComponents.size()) {
+                continue;
+            }
+
+            const auto isMatch = std::equal(
+                std::next(components.rbegin()), components.rend(), parentComponents.rbegin(),
+                [](const std::string& pattern, const std::string& component) {
+                    return MatchesGlob(pattern, component);
+                });
+
+            if (isMatch) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ExclusionMatcher::MatchesGlob(std::string_view pattern, std::string_view name) noexcept
+    {
+        std::size_t patternIndex = 0;
+        std::size_t nameIndex = 0;
+
+        // Where to resume if the current attempt fails: just past the most recent "*", which then
+        // swallows one more character of the name than it did before.
+        std::optional<std::size_t> starIndex;
+        std::size_t starNameIndex = 0;
+
+        while (nameIndex < name.size()) {
+            if (patternIndex < pattern.size()) {
+                if (pattern[patternIndex] == '*') {
+                    starIndex = ++patternIndex;
+                    starNameIndex = nameIndex;
+                    continue;
+                }
+
+                const auto nextIndex = MatchCharacter(pattern, patternIndex, name[nameIndex]);
+                if (nextIndex) {
+                    patternIndex = *nextIndex;
+                    ++nameIndex;
+                    continue;
+                }
+            }
+
+            if (!starIndex) {
+                return false;
+            }
+
+            patternIndex = *starIndex;
+            nameIndex = ++starNameIndex;
+        }
+
+        while (patternIndex < pattern.size() && pattern[patternIndex] == '*') {
+            ++patternIndex;
+        }
+
+        return patternIndex == pattern.size();
+    }
+} // namespace Scanner
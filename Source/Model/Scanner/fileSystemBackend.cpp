@@ -0,0 +1,51 @@
+#include "Model/Scanner/fileSystemBackend.h"
+
+#include <utility>
+
+namespace
+{
+    /**
+     * @brief A directory that is identified by its full path, for backends that have no better
+     * way of keeping track of it.
+     */
+    class PathBasedDirectoryHandle final : public Scanner::DirectoryHandle
+    {
+      public:
+        PathBasedDirectoryHandle(
+            const Scanner::FileSystemBackend& backend, std::filesystem::path path) noexcept
+            : m_backend{ backend }, m_path{ std::move(path) }
+        {
+        }
+
+        bool ReadEntries(
+            std::vector<Scanner::DirectoryEntry>& entries, Scanner::SystemCallTally& tally,
+            const std::atomic<bool>& /*cancellationToken*/) noexcept override
+        {
+            // The path-based interface offers no way of stopping partway through.
+            return m_backend.ReadDirectory(m_path, entries, tally);
+        }
+
+        std::uint64_t ComputeChangeStamp() const noexcept override
+        {
+            return m_backend.ComputeChangeStamp(m_path);
+        }
+
+      private:
+        const Scanner::FileSystemBackend& m_backend;
+        std::filesystem::path m_path;
+    };
+} // namespace
+
+namespace Scanner
+{
+    std::unique_ptr<DirectoryHandle> FileSystemBackend::OpenDirectory(
+        const DirectoryHandle* /*parent*/, const std::string& /*name*/,
+        const PathResolver& resolvePath) const noexcept
+    {
+        try {
+            return std::make_unique<PathBasedDirectoryHandle>(*this, resolvePath());
+        } catch (...) {
+            return nullptr;
+        }
+    }
+} // namespace Scanner
@@ -0,0 +1,203 @@
+#include "Model/Scanner/linuxDirectoryReader.h"
+#include "Model/Scanner/linuxStatxRing.h"
+#include "Model/Scanner/scanningUtilities.h"
+
+#ifdef Q_OS_LINUX
+
+#include <array>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    // Large enough to drain most directories in a single `getdents64(...)` call.
+    constexpr std::size_t DirectoryBufferSize = 64 * 1024;
+
+    /**
+     * @returns The metadata that the scanner cares about, extracted from a full stat buffer.
+     */
+    Scanner::FileMetadata ToFileMetadata(const struct stat64& status) noexcept
+    {
+        Scanner::FileMetadata metadata;
+        metadata.size = static_cast<std::uintmax_t>(status.st_size);
+
+        // POSIX specifies `st_blocks` in units of 512 bytes, regardless of the filesystem's actual
+        // block size.
+        metadata.allocatedSize = static_cast<std::uintmax_t>(status.st_blocks) * 512u;
+
+        metadata.device = static_cast<std::uint64_t>(status.st_dev);
+        metadata.inode = static_cast<std::uint64_t>(status.st_ino);
+        metadata.linkCount = static_cast<std::uint64_t>(status.st_nlink);
+
+        return metadata;
+    }
+
+    /**
+     * @returns True if the name refers to either the current or the parent directory.
+     */
+    bool IsDotOrDotDot(const char* name) noexcept
+    {
+        return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+    }
+} // namespace
+
+namespace Scanner
+{
+    DirectoryReader::DirectoryReader(const std::filesystem::path& path) noexcept
+        : m_descriptor{ ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC) }
+    {
+        // One call to open the directory, and, if that succeeded, one more to eventually close it:
+        m_syscallCount = IsOpen() ? 2 : 1;
+    }
+
+    DirectoryReader::DirectoryReader(int parentDescriptor, const std::string& name) noexcept
+        : m_descriptor{ ::openat(
+              parentDescriptor, name.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW) }
+    {
+        m_syscallCount = IsOpen() ? 2 : 1;
+    }
+
+    DirectoryReader::~DirectoryReader() noexcept
+    {
+        if (m_descriptor != -1) {
+            ::close(m_descriptor);
+        }
+    }
+
+    bool DirectoryReader::IsOpen() const noexcept
+    {
+        return m_descriptor != -1;
+    }
+
+    bool DirectoryReader::ReadEntries(
+        std::vector<DirectoryEntry>& entries, const std::atomic<bool>& cancellationToken) noexcept
+    {
+        if (!IsOpen()) {
+            return false;
+        }
+
+        alignas(dirent64) thread_local std::array<char, DirectoryBufferSize> buffer;
+
+        while (true) {
+            if (cancellationToken.load()) {
+                return false;
+            }
+
+            const auto bytesRead =
+                ::syscall(SYS_getdents64, m_descriptor, buffer.data(), buffer.size());
+
+            ++m_syscallCount;
+
+            if (bytesRead == 0) {
+                return true;
+            }
+
+            if (bytesRead < 0) {
+                return false;
+            }
+
+            for (long position = 0; position < bytesRead;) {
+                const auto* const record = reinterpret_cast<const dirent64*>(&buffer[position]);
+                position += record->d_reclen;
+
+                if (IsDotOrDotDot(record->d_name)) {
+                    continue;
+                }
+
+                DirectoryEntry entry;
+                entry.inode = record->d_ino;
+
+                switch (record->d_type) {
+                    case DT_REG: {
+                        entry.type = FileType::Regular;
+                        break;
+                    }
+                    case DT_DIR: {
+                        entry.type = FileType::Directory;
+                        break;
+                    }
+                    case DT_LNK: {
+                        entry.type = FileType::Symlink;
+                        break;
+                    }
+                    case DT_UNKNOWN: {
+                        // Some filesystems don't fill in the type, in which case we have no choice
+                        // but to stat the entry. We'll hold on to the metadata so that the file
+                        // doesn't have to be stat-ed a second time.
+                        struct stat64 status;
+                        ++m_syscallCount;
+
+                        if (::fstatat64(
+                                m_descriptor, record->d_name, &status, AT_SYMLINK_NOFOLLOW) != 0) {
+                            continue;
+                        }
+
+                        if (S_ISREG(status.st_mode)) {
+                            entry.type = FileType::Regular;
+                            entry.metadata = ToFileMetadata(status);
+                        } else if (S_ISDIR(status.st_mode)) {
+                            entry.type = FileType::Directory;
+                        } else if (S_ISLNK(status.st_mode)) {
+                            entry.type = FileType::Symlink;
+                        } else {
+                            continue;
+                        }
+
+                        break;
+                    }
+                    default: {
+                        // Named pipes, sockets, and devices don't take up any space.
+                        continue;
+                    }
+                }
+
+                entry.name = record->d_name;
+                entries.emplace_back(std::move(entry));
+            }
+        }
+    }
+
+    FileMetadata DirectoryReader::ComputeFileMetadata(const std::string& name) noexcept
+    {
+        struct stat64 status;
+        ++m_syscallCount;
+
+        if (::fstatat64(m_descriptor, name.c_str(), &status, AT_SYMLINK_NOFOLLOW) != 0) {
+            return {};
+        }
+
+        return ToFileMetadata(status);
+    }
+
+    void DirectoryReader::ComputeFileSizes(
+        std::vector<DirectoryEntry>& entries, StatxRing& ring,
+        const std::atomic<bool>& cancellationToken) noexcept
+    {
+        if (!IsOpen()) {
+            return;
+        }
+
+        m_syscallCount += ring.ComputeFileSizes(m_descriptor, entries, cancellationToken);
+    }
+
+    std::uint64_t DirectoryReader::ComputeChangeStamp() const noexcept
+    {
+        return IsOpen() ? Scanner::ComputeChangeStamp(m_descriptor) : 0;
+    }
+
+    int DirectoryReader::GetDescriptor() const noexcept
+    {
+        return m_descriptor;
+    }
+
+    std::uintmax_t DirectoryReader::GetSyscallCount() const noexcept
+    {
+        return m_syscallCount;
+    }
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
@@ -0,0 +1,257 @@
+#include "Model/Scanner/linuxFileSystemBackend.h"
+
+#ifdef Q_OS_LINUX
+
+#include "Model/Scanner/linuxDirectoryReader.h"
+#include "Model/Scanner/linuxStatxRing.h"
+#include "Model/Scanner/scanningUtilities.h"
+#include "constants.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    // The number of stat-family calls that a purely path-based scan needs in order to process a
+    // single entry. For a file, that's `is_regular_file(...)`, `is_directory(...)`, and
+    // `file_size(...)`. For a directory, that's `is_regular_file(...)`, `is_directory(...)`,
+    // `is_symlink(...)`, and the open, read, and close calls hidden behind `is_empty(...)`.
+    // Anything else is rejected after the first two checks.
+    constexpr std::uintmax_t PathBasedCallsPerFile = 3;
+    constexpr std::uintmax_t PathBasedCallsPerDirectory = 6;
+    constexpr std::uintmax_t PathBasedCallsPerOtherEntry = 2;
+
+    // The maximum number of `statx(...)` requests that each scanning thread will keep in flight.
+    constexpr unsigned int StatxRingDepth = 256;
+
+    // Stands in for a cancellation token where the caller has none to offer.
+    const std::atomic<bool> NeverCancelled{ false };
+
+    /**
+     * @brief Determines which of the scanning engines to use.
+     *
+     * @param[in] requestedEngine     The engine that the user asked for.
+     *
+     * @returns The engine that will actually be used.
+     */
+    ScanningEngine SelectEngine(ScanningEngine requestedEngine) noexcept
+    {
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+        if (requestedEngine == ScanningEngine::ThreadPool) {
+            log->info("Scanning with the thread pool engine.");
+            return ScanningEngine::ThreadPool;
+        }
+
+        if (Scanner::StatxRing{ 1 }.IsAvailable()) {
+            log->info("Scanning with the io_uring engine.");
+            return ScanningEngine::IoUring;
+        }
+
+        log->info("The io_uring engine is unavailable; falling back to the thread pool engine.");
+        return ScanningEngine::ThreadPool;
+    }
+
+    /**
+     * @brief Reads all entries from an open directory, and sizes every regular file among them.
+     *
+     * @param[in, out] reader         The open directory.
+     * @param[in] engine              The engine with which to size the files.
+     * @param[in] shouldStatInInodeOrder  Whether to size the files in inode order.
+     * @param[out] entries            The entries found in the directory.
+     * @param[out] tally              The system calls that went into reading the directory.
+     * @param[in] cancellationToken   Once set, no further calls are issued, and any file that
+     *                                hasn't been sized by then is left unsized.
+     *
+     * @returns False if an error was encountered, or if the read was cancelled, before the end of
+     * the directory was reached.
+     */
+    bool ReadEntries(
+        Scanner::DirectoryReader& reader, ScanningEngine engine, bool shouldStatInInodeOrder,
+        std::vector<Scanner::DirectoryEntry>& entries, Scanner::SystemCallTally& tally,
+        const std::atomic<bool>& cancellationToken) noexcept
+    {
+        auto wasReadEntirely = reader.ReadEntries(entries, cancellationToken);
+
+        // Since the entire directory has been read by now, the entries can be put in inode order
+        // before any of them are stat-ed. That also goes for the subdirectories, which will later
+        // be opened in the same order.
+        if (shouldStatInInodeOrder) {
+            std::sort(
+                std::begin(entries), std::end(entries),
+                [](const auto& lhs, const auto& rhs) { return lhs.inode < rhs.inode; });
+        }
+
+        // Reading the directory itself costs the same number of calls either way:
+        std::uintmax_t pathBasedCallCount = reader.GetSyscallCount();
+
+        if (engine == ScanningEngine::IoUring) {
+            // Each thread sets up its own ring the first time that it needs one. Any file that the
+            // ring fails to stat will simply be stat-ed individually below.
+            thread_local Scanner::StatxRing ring{ StatxRingDepth };
+            reader.ComputeFileSizes(entries, ring, cancellationToken);
+        }
+
+        for (auto& entry : entries) {
+            switch (entry.type) {
+                case FileType::Regular: {
+                    pathBasedCallCount += PathBasedCallsPerFile;
+
+                    // A huge directory can take seconds to size, which a cancelled scan shouldn't
+                    // have to wait out.
+                    if (!entry.metadata) {
+                        if (cancellationToken.load()) {
+                            wasReadEntirely = false;
+                        } else {
+                            entry.metadata = reader.ComputeFileMetadata(entry.name);
+                        }
+                    }
+
+                    break;
+                }
+                case FileType::Directory: {
+                    pathBasedCallCount += PathBasedCallsPerDirectory;
+                    break;
+                }
+                case FileType::Symlink: {
+                    pathBasedCallCount += PathBasedCallsPerOtherEntry;
+                    break;
+                }
+            }
+        }
+
+        const auto callsIssued = reader.GetSyscallCount();
+        tally.issued += callsIssued;
+
+        if (pathBasedCallCount > callsIssued) {
+            tally.avoided += pathBasedCallCount - callsIssued;
+        }
+
+        return wasReadEntirely;
+    }
+
+    /**
+     * @brief A directory that is held open, so that its subdirectories can be opened relative to
+     * it.
+     */
+    class LinuxDirectoryHandle final : public Scanner::DirectoryHandle
+    {
+      public:
+        LinuxDirectoryHandle(
+            ScanningEngine engine, bool shouldStatInInodeOrder,
+            const std::filesystem::path& path) noexcept
+            : m_reader{ path },
+              m_engine{ engine },
+              m_shouldStatInInodeOrder{ shouldStatInInodeOrder }
+        {
+        }
+
+        LinuxDirectoryHandle(
+            ScanningEngine engine, bool shouldStatInInodeOrder, int parentDescriptor,
+            const std::string& name) noexcept
+            : m_reader{ parentDescriptor, name },
+              m_engine{ engine },
+              m_shouldStatInInodeOrder{ shouldStatInInodeOrder }
+        {
+        }
+
+        bool IsOpen() const noexcept
+        {
+            return m_reader.IsOpen();
+        }
+
+        int GetDescriptor() const noexcept
+        {
+            return m_reader.GetDescriptor();
+        }
+
+        bool ReadEntries(
+            std::vector<Scanner::DirectoryEntry>& entries, Scanner::SystemCallTally& tally,
+            const std::atomic<bool>& cancellationToken) noexcept override
+        {
+            return ::ReadEntries(
+                m_reader, m_engine, m_shouldStatInInodeOrder, entries, tally, cancellationToken);
+        }
+
+        std::uint64_t ComputeChangeStamp() const noexcept override
+        {
+            return m_reader.ComputeChangeStamp();
+        }
+
+      private:
+        Scanner::DirectoryReader m_reader;
+        ScanningEngine m_engine;
+        bool m_shouldStatInInodeOrder;
+    };
+} // namespace
+
+namespace Scanner
+{
+    LinuxFileSystemBackend::LinuxFileSystemBackend(
+        ScanningEngine engine, bool shouldStatInInodeOrder) noexcept
+        : m_engine{ SelectEngine(engine) }, m_shouldStatInInodeOrder{ shouldStatInInodeOrder }
+    {
+        if (shouldStatInInodeOrder) {
+            const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+            log->info("Files will be stat-ed in inode order.");
+        }
+    }
+
+    ScanningEngine LinuxFileSystemBackend::GetEngine() const noexcept
+    {
+        return m_engine;
+    }
+
+    bool LinuxFileSystemBackend::IsDirectory(const std::filesystem::path& path) const noexcept
+    {
+        std::error_code errorCode;
+        return std::filesystem::is_directory(path, errorCode);
+    }
+
+    bool LinuxFileSystemBackend::ReadDirectory(
+        const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+        SystemCallTally& tally) const noexcept
+    {
+        DirectoryReader reader{ path };
+        return ReadEntries(
+            reader, m_engine, m_shouldStatInInodeOrder, entries, tally, NeverCancelled);
+    }
+
+    std::uint64_t
+    LinuxFileSystemBackend::ComputeChangeStamp(const std::filesystem::path& path) const noexcept
+    {
+        return Scanner::ComputeChangeStamp(path);
+    }
+
+    std::unique_ptr<DirectoryHandle> LinuxFileSystemBackend::OpenDirectory(
+        const DirectoryHandle* parent, const std::string& name,
+        const PathResolver& resolvePath) const noexcept
+    {
+        std::unique_ptr<LinuxDirectoryHandle> handle;
+
+        try {
+            if (parent) {
+                const auto parentDescriptor =
+                    static_cast<const LinuxDirectoryHandle*>(parent)->GetDescriptor();
+
+                handle = std::make_unique<LinuxDirectoryHandle>(
+                    m_engine, m_shouldStatInInodeOrder, parentDescriptor, name);
+            } else {
+                handle = std::make_unique<LinuxDirectoryHandle>(
+                    m_engine, m_shouldStatInInodeOrder, resolvePath());
+            }
+        } catch (...) {
+            return nullptr;
+        }
+
+        if (!handle->IsOpen()) {
+            return nullptr;
+        }
+
+        return handle;
+    }
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
@@ -0,0 +1,182 @@
+#include "Model/Scanner/linuxMountTable.h"
+
+#ifdef Q_OS_LINUX
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <sstream>
+
+#include <sys/sysmacros.h>
+
+namespace
+{
+    /**
+     * @brief Paths in the mount table escape spaces, tabs, newlines, and backslashes as three-digit
+     * octal sequences, such as `\040` for a space.
+     */
+    std::string DecodeEscapes(const std::string& encoded)
+    {
+        const auto isOctalDigit = [](char digit) { return digit >= '0' && digit <= '7'; };
+
+        std::string decoded;
+        decoded.reserve(encoded.size());
+
+        for (std::size_t index = 0; index < encoded.size(); ++index) {
+            const auto isEscape =
+                encoded[index] == '\\' && index + 3 < encoded.size() &&
+                std::all_of(encoded.begin() + index + 1, encoded.begin() + index + 4, isOctalDigit);
+
+            if (!isEscape) {
+                decoded += encoded[index];
+                continue;
+            }
+
+            const auto value = (encoded[index + 1] - '0') * 64 + (encoded[index + 2] - '0') * 8 +
+                               (encoded[index + 3] - '0');
+
+            decoded += static_cast<char>(value);
+            index += 3;
+        }
+
+        return decoded;
+    }
+
+    /**
+     * @returns True if the path is either equal to, or nested inside of, the given ancestor.
+     */
+    bool IsWithin(const std::string& path, const std::string& ancestor) noexcept
+    {
+        if (ancestor == "/") {
+            return !path.empty() && path.front() == '/';
+        }
+
+        return path.compare(0, ancestor.size(), ancestor) == 0 &&
+               (path.size() == ancestor.size() || path[ancestor.size()] == '/');
+    }
+} // namespace
+
+namespace Scanner
+{
+    MountTable::MountTable(std::istream& mountInfo)
+    {
+        std::string line;
+        while (std::getline(mountInfo, line)) {
+            // Each line looks as follows, where the number of optional fields before the separator
+            // varies: "36 35 98:0 /mnt1 /mnt/parent rw,noatime master:1 - ext3 /dev/root rw"
+            std::istringstream fields{ line };
+
+            std::string mountId;
+            std::string parentId;
+            std::string deviceNumbers;
+            std::string root;
+            std::string mountPath;
+
+            if (!(fields >> mountId >> parentId >> deviceNumbers >> root >> mountPath)) {
+                continue;
+            }
+
+            std::string field;
+            while (fields >> field && field != "-") {
+                // Skip the mount options and any optional fields.
+            }
+
+            std::string filesystemType;
+            if (!(fields >> filesystemType)) {
+                continue;
+            }
+
+            const auto separator = deviceNumbers.find(':');
+            if (separator == std::string::npos) {
+                continue;
+            }
+
+            MountPoint mountPoint;
+            mountPoint.path = DecodeEscapes(mountPath);
+            mountPoint.filesystemType = std::move(filesystemType);
+
+            try {
+                const auto major = std::stoul(deviceNumbers.substr(0, separator));
+                const auto minor = std::stoul(deviceNumbers.substr(separator + 1));
+                mountPoint.device = makedev(major, minor);
+            } catch (...) {
+                continue;
+            }
+
+            // Later entries shadow earlier ones that were mounted on the same path.
+            auto path = mountPoint.path;
+            m_mountPoints.insert_or_assign(std::move(path), std::move(mountPoint));
+        }
+    }
+
+    MountTable MountTable::LoadFromSystem()
+    {
+        std::ifstream mountInfo{ "/proc/self/mountinfo" };
+        if (!mountInfo.is_open()) {
+            return {};
+        }
+
+        return MountTable{ mountInfo };
+    }
+
+    const MountPoint* MountTable::Find(const std::string& path) const noexcept
+    {
+        const auto itr = m_mountPoints.find(path);
+        return itr == std::end(m_mountPoints) ? nullptr : &itr->second;
+    }
+
+    const MountPoint* MountTable::FindContaining(const std::filesystem::path& path) const noexcept
+    {
+        const auto target = path.string();
+
+        const MountPoint* bestMatch = nullptr;
+        for (const auto& [mountPath, mountPoint] : m_mountPoints) {
+            if (!IsWithin(target, mountPath)) {
+                continue;
+            }
+
+            if (!bestMatch || mountPath.size() > bestMatch->path.size()) {
+                bestMatch = &mountPoint;
+            }
+        }
+
+        return bestMatch;
+    }
+
+    std::vector<MountPoint> MountTable::FindBelow(const std::filesystem::path& path) const
+    {
+        const auto ancestor = path.string();
+
+        std::vector<MountPoint> mountPoints;
+        for (const auto& [mountPath, mountPoint] : m_mountPoints) {
+            if (mountPath != ancestor && IsWithin(mountPath, ancestor)) {
+                mountPoints.emplace_back(mountPoint);
+            }
+        }
+
+        return mountPoints;
+    }
+
+    bool MountTable::IsEmpty() const noexcept
+    {
+        return m_mountPoints.empty();
+    }
+
+    bool MountTable::IsPseudoFilesystem(const std::string& filesystemType) noexcept
+    {
+        // These filesystems either expose kernel state (and thus take up no actual storage), or
+        // are known to misbehave when walked.
+        static constexpr std::array<const char*, 22> pseudoFilesystems = {
+            "autofs",   "binfmt_misc", "bpf",     "cgroup",     "cgroup2",    "configfs",
+            "debugfs",  "devpts",      "devtmpfs", "efivarfs",  "fusectl",    "hugetlbfs",
+            "mqueue",   "nsfs",        "proc",    "pstore",     "rpc_pipefs", "securityfs",
+            "selinuxfs", "sysfs",      "tracefs", "usbfs"
+        };
+
+        return std::any_of(
+            std::begin(pseudoFilesystems), std::end(pseudoFilesystems),
+            [&](const char* type) { return filesystemType == type; });
+    }
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
@@ -0,0 +1,364 @@
+#include "Model/Scanner/linuxStatxRing.h"
+
+#ifdef Q_OS_LINUX
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    int SetUpRing(unsigned int entries, io_uring_params& parameters) noexcept
+    {
+        return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &parameters));
+    }
+
+    int EnterRing(
+        int descriptor, unsigned int submissionCount, unsigned int completionCount,
+        unsigned int flags) noexcept
+    {
+        return static_cast<int>(::syscall(
+            __NR_io_uring_enter, descriptor, submissionCount, completionCount, flags, nullptr, 0));
+    }
+
+    int RegisterWithRing(
+        int descriptor, unsigned int opcode, void* argument, unsigned int argumentCount) noexcept
+    {
+        return static_cast<int>(
+            ::syscall(__NR_io_uring_register, descriptor, opcode, argument, argumentCount));
+    }
+
+    void* MapRegion(int descriptor, std::size_t size, off_t offset) noexcept
+    {
+        auto* const region =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor,
+                   offset);
+
+        return region == MAP_FAILED ? nullptr : region;
+    }
+
+    /**
+     * @returns The metadata that the scanner cares about, extracted from a statx buffer.
+     */
+    Scanner::FileMetadata ToFileMetadata(const struct statx& status) noexcept
+    {
+        Scanner::FileMetadata metadata;
+        metadata.size = status.stx_size;
+
+        // Just like `st_blocks`, `stx_blocks` is always expressed in units of 512 bytes.
+        metadata.allocatedSize = status.stx_blocks * 512u;
+
+        // Compose the device number the same way that `stat(...)` would, so that the results of
+        // both calls can be compared.
+        metadata.device = makedev(status.stx_dev_major, status.stx_dev_minor);
+        metadata.inode = status.stx_ino;
+        metadata.linkCount = status.stx_nlink;
+
+        return metadata;
+    }
+
+    // The ring indices are shared with the kernel, so the usual acquire-release pairing is needed
+    // to make sure that neither side observes an index before the entry it refers to.
+    unsigned int LoadAcquire(const unsigned int* value) noexcept
+    {
+        return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+    }
+
+    void StoreRelease(unsigned int* value, unsigned int newValue) noexcept
+    {
+        __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+    }
+} // namespace
+
+namespace Scanner
+{
+    StatxRing::StatxRing(unsigned int depth) noexcept
+    {
+        io_uring_params parameters;
+        std::memset(&parameters, 0, sizeof(parameters));
+
+        m_descriptor = SetUpRing(depth, parameters);
+        if (m_descriptor < 0) {
+            m_descriptor = -1;
+            return;
+        }
+
+        m_depth = parameters.sq_entries;
+
+        m_submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+        m_completionRingSize =
+            parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+
+        const auto isSingleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (isSingleMapping) {
+            m_submissionRingSize = std::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = MapRegion(m_descriptor, m_submissionRingSize, IORING_OFF_SQ_RING);
+        if (!m_submissionRing) {
+            return;
+        }
+
+        m_completionRing = isSingleMapping
+                               ? m_submissionRing
+                               : MapRegion(m_descriptor, m_completionRingSize, IORING_OFF_CQ_RING);
+
+        if (!m_completionRing) {
+            return;
+        }
+
+        m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+        m_submissionEntries = MapRegion(m_descriptor, m_submissionEntriesSize, IORING_OFF_SQES);
+        if (!m_submissionEntries) {
+            return;
+        }
+
+        auto* const submissionBase = static_cast<char*>(m_submissionRing);
+        m_submissionTail = reinterpret_cast<unsigned*>(submissionBase + parameters.sq_off.tail);
+        m_submissionMask =
+            reinterpret_cast<unsigned*>(submissionBase + parameters.sq_off.ring_mask);
+        m_submissionArray = reinterpret_cast<unsigned*>(submissionBase + parameters.sq_off.array);
+
+        auto* const completionBase = static_cast<char*>(m_completionRing);
+        m_completionHead = reinterpret_cast<unsigned*>(completionBase + parameters.cq_off.head);
+        m_completionTail = reinterpret_cast<unsigned*>(completionBase + parameters.cq_off.tail);
+        m_completionMask =
+            reinterpret_cast<unsigned*>(completionBase + parameters.cq_off.ring_mask);
+        m_completionEntries =
+            reinterpret_cast<io_uring_cqe*>(completionBase + parameters.cq_off.cqes);
+
+        m_isAvailable = IsStatxSupported();
+    }
+
+    StatxRing::~StatxRing() noexcept
+    {
+        TearDown();
+    }
+
+    void StatxRing::TearDown() noexcept
+    {
+        m_isAvailable = false;
+
+        if (m_submissionEntries) {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+            m_submissionEntries = nullptr;
+        }
+
+        if (m_completionRing && m_completionRing != m_submissionRing) {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+
+        m_completionRing = nullptr;
+
+        if (m_submissionRing) {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+            m_submissionRing = nullptr;
+        }
+
+        if (m_descriptor != -1) {
+            ::close(m_descriptor);
+            m_descriptor = -1;
+        }
+    }
+
+    bool StatxRing::IsAvailable() const noexcept
+    {
+        return m_isAvailable;
+    }
+
+    bool StatxRing::IsStatxSupported() noexcept
+    {
+        constexpr auto operationCount = 256u;
+
+        // The probe is a header followed by a flexible array of supported operations.
+        alignas(io_uring_probe) std::array<
+            char, sizeof(io_uring_probe) + operationCount * sizeof(io_uring_probe_op)>
+            buffer{};
+
+        auto* const probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+
+        if (RegisterWithRing(m_descriptor, IORING_REGISTER_PROBE, probe, operationCount) < 0) {
+            return false;
+        }
+
+        if (probe->last_op < IORING_OP_STATX) {
+            return false;
+        }
+
+        return (probe->ops[IORING_OP_STATX].flags & IO_URING_OP_SUPPORTED) != 0;
+    }
+
+    std::uintmax_t StatxRing::Abandon(unsigned int inFlightCount) noexcept
+    {
+        std::uintmax_t syscallCount = 0;
+
+        // Requests that never made it into the kernel go away together with the ring, so only the
+        // ones in flight need to be waited on. Their results are of no further use.
+        while (inFlightCount > 0) {
+            const auto result = EnterRing(m_descriptor, 0, inFlightCount, IORING_ENTER_GETEVENTS);
+            ++syscallCount;
+
+            if (result < 0 && errno != EINTR) {
+                break;
+            }
+
+            auto head = *m_completionHead;
+            const auto completionTail = LoadAcquire(m_completionTail);
+
+            while (head != completionTail && inFlightCount > 0) {
+                ++head;
+                --inFlightCount;
+            }
+
+            StoreRelease(m_completionHead, head);
+        }
+
+        if (inFlightCount > 0) {
+            // Should the kernel not even let us wait for the stragglers, then the buffers that
+            // they read from and write to are handed over to them for good. Moving the buffers
+            // leaves their memory where it is, and it's deliberately never released.
+            static_cast<void>(new std::vector<char>{ std::move(m_names) });
+            static_cast<void>(new std::vector<struct statx>{ std::move(m_results) });
+        }
+
+        TearDown();
+        return syscallCount;
+    }
+
+    io_uring_sqe* StatxRing::GetSubmissionEntry(unsigned int index) noexcept
+    {
+        return static_cast<io_uring_sqe*>(m_submissionEntries) + index;
+    }
+
+    io_uring_cqe* StatxRing::GetCompletionEntry(unsigned int index) noexcept
+    {
+        return m_completionEntries + index;
+    }
+
+    std::uintmax_t StatxRing::ComputeFileSizes(
+        int directoryDescriptor, std::vector<DirectoryEntry>& entries,
+        const std::atomic<bool>& cancellationToken) noexcept
+    {
+        if (!m_isAvailable) {
+            return 0;
+        }
+
+        thread_local std::vector<std::size_t> pendingEntries;
+
+        pendingEntries.clear();
+        for (std::size_t index = 0; index < entries.size(); ++index) {
+            if (entries[index].type == FileType::Regular && !entries[index].metadata) {
+                pendingEntries.emplace_back(index);
+            }
+        }
+
+        m_results.resize(m_depth);
+
+        std::uintmax_t syscallCount = 0;
+
+        const auto pendingCount = pendingEntries.size();
+
+        for (std::size_t batchStart = 0; batchStart < pendingCount && !cancellationToken.load();
+             batchStart += m_depth) {
+            const auto batchSize = static_cast<unsigned int>(
+                std::min<std::size_t>(m_depth, pendingCount - batchStart));
+
+            // The requests refer to copies of the names that the ring owns, so that no request can
+            // ever outlive the name that it refers to, whatever happens to the entries.
+            std::size_t nameBufferSize = 0;
+            for (unsigned int slot = 0; slot < batchSize; ++slot) {
+                nameBufferSize += entries[pendingEntries[batchStart + slot]].name.size() + 1;
+            }
+
+            m_names.resize(std::max(m_names.size(), nameBufferSize));
+
+            auto* nextName = m_names.data();
+
+            auto tail = *m_submissionTail;
+            const auto mask = *m_submissionMask;
+
+            for (unsigned int slot = 0; slot < batchSize; ++slot) {
+                const auto& name = entries[pendingEntries[batchStart + slot]].name;
+                std::memcpy(nextName, name.c_str(), name.size() + 1);
+
+                const auto ringIndex = tail & mask;
+
+                auto* const request = GetSubmissionEntry(ringIndex);
+                std::memset(request, 0, sizeof(io_uring_sqe));
+
+                request->opcode = IORING_OP_STATX;
+                request->fd = directoryDescriptor;
+                request->addr = reinterpret_cast<std::uint64_t>(nextName);
+                request->len = STATX_SIZE | STATX_BLOCKS | STATX_NLINK | STATX_INO;
+                request->off = reinterpret_cast<std::uint64_t>(&m_results[slot]);
+                request->statx_flags = AT_SYMLINK_NOFOLLOW;
+                request->user_data = slot;
+
+                m_submissionArray[ringIndex] = ringIndex;
+                nextName += name.size() + 1;
+                ++tail;
+            }
+
+            StoreRelease(m_submissionTail, tail);
+
+            auto remainingSubmissions = batchSize;
+            auto remainingCompletions = batchSize;
+
+            while (remainingCompletions > 0) {
+                const auto result = EnterRing(
+                    m_descriptor, remainingSubmissions, remainingCompletions,
+                    IORING_ENTER_GETEVENTS);
+
+                ++syscallCount;
+
+                if (result < 0) {
+                    if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                        continue;
+                    }
+
+                    // Since we can no longer be sure of the state of the ring, we'll stop using
+                    // it, and let the caller take care of any files that are still unsized.
+                    syscallCount += Abandon(remainingCompletions - remainingSubmissions);
+                    return syscallCount;
+                }
+
+                const auto submittedCount = static_cast<unsigned int>(result);
+                remainingSubmissions -= std::min(remainingSubmissions, submittedCount);
+
+                auto head = *m_completionHead;
+                const auto completionTail = LoadAcquire(m_completionTail);
+
+                while (head != completionTail) {
+                    const auto* const completion = GetCompletionEntry(head & *m_completionMask);
+                    const auto slot = static_cast<std::size_t>(completion->user_data);
+
+                    // Files that the ring fails to stat are left unsized, so that the caller can
+                    // fall back on stat-ing them one at a time.
+                    if (completion->res == 0) {
+                        auto& entry = entries[pendingEntries[batchStart + slot]];
+                        entry.metadata = ToFileMetadata(m_results[slot]);
+                    }
+
+                    ++head;
+                    --remainingCompletions;
+                }
+
+                StoreRelease(m_completionHead, head);
+            }
+        }
+
+        return syscallCount;
+    }
+} // namespace Scanner
+
+#endif // Q_OS_LINUX
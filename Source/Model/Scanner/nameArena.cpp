@@ -0,0 +1,317 @@
+#include "Model/Scanner/nameArena.h"
+
+#include "Model/vizBlock.h"
+
+#include <Tree/Tree.hpp>
+#include <gsl/assert>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+    /**
+     * @returns The shard assigned to the calling thread. Threads are assigned shards in a
+     * round-robin fashion the first time that they store a name in any arena.
+     */
+    std::size_t GetShardIndex() noexcept
+    {
+        static std::atomic<std::size_t> nextIndex{ 0 };
+        thread_local const auto index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+
+        return index;
+    }
+
+    /**
+     * @brief Ties the lifetime of an arena to that of a tree. Since the arena is only released
+     * once the tree has been deleted, none of the tree's nodes can outlive their names, nor the
+     * table that their extensions were interned in.
+     */
+    struct TreeDeleter
+    {
+        void operator()(Tree<VizBlock>* tree) const noexcept
+        {
+            delete tree;
+        }
+
+        std::shared_ptr<Scanner::NameArena> arena;
+    };
+} // namespace
+
+namespace Scanner
+{
+    /**
+     * @brief The table behind `Scanner::Extension`.
+     *
+     * Extensions are appended to fixed-size chunks that never move once allocated, which means
+     * that an extension can be looked up without a lock, while interning one requires the lock.
+     *
+     * At most one table is alive at any one time, which is what allows an extension to find its
+     * table without having to point to it.
+     */
+    class ExtensionTable
+    {
+      public:
+        ExtensionTable() : m_generation{ s_nextGeneration.fetch_add(1) }
+        {
+            // The first entry stands in for the empty extension.
+            m_ownedChunks.emplace_back(std::make_unique<std::string_view[]>(ChunkSize));
+            m_chunks[0].store(m_ownedChunks.back().get(), std::memory_order_release);
+
+            s_currentTable.store(this, std::memory_order_release);
+        }
+
+        ExtensionTable(const ExtensionTable&) = delete;
+        ExtensionTable& operator=(const ExtensionTable&) = delete;
+
+        ~ExtensionTable()
+        {
+            // A newer table may already have taken over, in which case it must be left in place.
+            auto* expectedTable = this;
+            s_currentTable.compare_exchange_strong(expectedTable, nullptr);
+        }
+
+        /**
+         * @returns The table that is currently in use, or a new one if the previous table has
+         * already been released.
+         */
+        static std::shared_ptr<ExtensionTable> Acquire()
+        {
+            static std::mutex mutex;
+            static std::weak_ptr<ExtensionTable> currentTable;
+
+            std::lock_guard<std::mutex> lock{ mutex };
+
+            auto table = currentTable.lock();
+            if (!table) {
+                table = std::make_shared<ExtensionTable>();
+                currentTable = table;
+            }
+
+            return table;
+        }
+
+        /**
+         * @returns The table that is currently in use. Only meant for looking up extensions that
+         * are known to be alive, which implies that the table is too.
+         */
+        static const ExtensionTable& GetCurrent() noexcept
+        {
+            return *s_currentTable.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @returns A number that sets this table apart from every other table that the process
+         * has ever used, unlike its address, which may well be reused.
+         */
+        std::uint64_t GetGeneration() const noexcept
+        {
+            return m_generation;
+        }
+
+        /**
+         * @returns The identifier of the given, non-empty extension, along with a view of the
+         * interned copy, or zero if the table is full.
+         */
+        std::pair<std::uint32_t, std::string_view> Intern(std::string_view extension)
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+
+            const auto match = m_identifiers.find(extension);
+            if (match != std::end(m_identifiers)) {
+                return { match->second, match->first };
+            }
+
+            const auto id = m_count;
+            if (id == ChunkSize * MaxChunkCount) {
+                return { 0, {} };
+            }
+
+            auto* chunk = m_chunks[id / ChunkSize].load(std::memory_order_relaxed);
+            if (!chunk) {
+                m_ownedChunks.emplace_back(std::make_unique<std::string_view[]>(ChunkSize));
+                chunk = m_ownedChunks.back().get();
+                m_chunks[id / ChunkSize].store(chunk, std::memory_order_release);
+            }
+
+            const auto internedExtension = std::string_view{ m_characters.emplace_back(extension) };
+            chunk[id % ChunkSize] = internedExtension;
+
+            m_identifiers.emplace(internedExtension, id);
+            ++m_count;
+
+            return { id, internedExtension };
+        }
+
+        std::string_view Lookup(std::uint32_t id) const noexcept
+        {
+            // Whoever handed out the identifier must have interned it first, so the entry will
+            // already have been written.
+            const auto* const chunk = m_chunks[id / ChunkSize].load(std::memory_order_acquire);
+            return chunk[id % ChunkSize];
+        }
+
+      private:
+        static constexpr std::uint32_t ChunkSize = 1024;
+        static constexpr std::uint32_t MaxChunkCount = 64;
+
+        inline static std::atomic<ExtensionTable*> s_currentTable{ nullptr };
+        inline static std::atomic<std::uint64_t> s_nextGeneration{ 1 };
+
+        std::uint64_t m_generation;
+
+        std::array<std::atomic<std::string_view*>, MaxChunkCount> m_chunks{};
+
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<std::string_view[]>> m_ownedChunks;
+        std::unordered_map<std::string_view, std::uint32_t> m_identifiers;
+
+        // Unlike those in a vector, the strings in a deque stay put as more are added.
+        std::deque<std::string> m_characters;
+
+        std::uint32_t m_count = 1;
+    };
+
+    Extension Extension::Intern(std::string_view extension, NameArena& arena)
+    {
+        if (extension.empty()) {
+            return {};
+        }
+
+        // Most files share one of a handful of extensions, so a cache of its own saves each
+        // scanning thread from taking the table's lock for every file that it comes across.
+        // The cache refers into the table, so it has to be cleared once the table is replaced.
+        thread_local std::unordered_map<std::string_view, std::uint32_t> cache;
+        thread_local std::uint64_t cachedGeneration = 0;
+
+        auto& table = *arena.m_extensionTable;
+        if (cachedGeneration != table.GetGeneration()) {
+            cache.clear();
+            cachedGeneration = table.GetGeneration();
+        }
+
+        const auto match = cache.find(extension);
+        if (match != std::end(cache)) {
+            return Extension{ match->second };
+        }
+
+        const auto [id, internedExtension] = table.Intern(extension);
+        if (id != 0) {
+            cache.emplace(internedExtension, id);
+        }
+
+        return Extension{ id };
+    }
+
+    std::string_view Extension::View() const noexcept
+    {
+        if (m_id == 0) {
+            return {};
+        }
+
+        return ExtensionTable::GetCurrent().Lookup(m_id);
+    }
+
+    NameArena::NameArena() : m_extensionTable{ ExtensionTable::Acquire() }
+    {
+    }
+
+    ArenaName NameArena::Store(std::string_view name)
+    {
+        if (name.empty()) {
+            return {};
+        }
+
+        Expects(name.size() <= std::numeric_limits<std::uint32_t>::max());
+
+        const auto isLong = name.size() >= ArenaName::LongLengthMarker;
+        const auto prefixSize = isLong ? 1 + sizeof(std::uint32_t) : 1;
+        const auto recordSize = prefixSize + name.size();
+
+        auto& shard = m_shards[GetShardIndex() % ShardCount];
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+
+        if (recordSize > shard.bytesLeft) {
+            const auto chunkSize = std::max(ChunkSize, recordSize);
+
+            shard.chunks.emplace_back(new char[chunkSize]);
+            shard.cursor = shard.chunks.back().get();
+            shard.bytesLeft = chunkSize;
+            shard.byteCount.fetch_add(chunkSize, std::memory_order_relaxed);
+        }
+
+        auto* const record = shard.cursor;
+
+        if (isLong) {
+            const auto longLength = static_cast<std::uint32_t>(name.size());
+            record[0] = static_cast<char>(ArenaName::LongLengthMarker);
+            std::memcpy(record + 1, &longLength, sizeof longLength);
+        } else {
+            record[0] = static_cast<char>(name.size());
+        }
+
+        std::memcpy(record + prefixSize, name.data(), name.size());
+
+        shard.cursor += recordSize;
+        shard.bytesLeft -= recordSize;
+
+        return ArenaName{ record };
+    }
+
+    std::uintmax_t NameArena::GetByteCount() const noexcept
+    {
+        std::uintmax_t byteCount = 0;
+        for (const auto& shard : m_shards) {
+            byteCount += shard.byteCount.load(std::memory_order_relaxed);
+        }
+
+        return byteCount;
+    }
+
+    const std::shared_ptr<NameArena>& NameArena::GetSharedArena()
+    {
+        static const auto arena = std::make_shared<NameArena>();
+        return arena;
+    }
+
+    std::pair<ArenaName, Extension> StoreFileName(std::string_view fileName, NameArena& arena)
+    {
+        // Just like `std::filesystem::path`, leading dots don't start an extension, and neither
+        // "." nor ".." have one.
+        const auto lastDot = fileName.rfind('.');
+        if (lastDot == std::string_view::npos || lastDot == 0 || fileName == "..") {
+            return { arena.Store(fileName), Extension{} };
+        }
+
+        return StoreFileName(fileName.substr(0, lastDot), fileName.substr(lastDot), arena);
+    }
+
+    std::pair<ArenaName, Extension>
+    StoreFileName(std::string_view stem, std::string_view extension, NameArena& arena)
+    {
+        const auto internedExtension = Extension::Intern(extension, arena);
+
+        if (internedExtension.empty() && !extension.empty()) {
+            // The table has run out of room, so the extension stays a part of the name instead.
+            std::string fileName{ stem };
+            fileName += extension;
+
+            return { arena.Store(fileName), Extension{} };
+        }
+
+        return { arena.Store(stem), internedExtension };
+    }
+
+    std::shared_ptr<Tree<VizBlock>> CreateTree(VizBlock root, std::shared_ptr<NameArena> arena)
+    {
+        return { new Tree<VizBlock>{ std::move(root) }, TreeDeleter{ std::move(arena) } };
+    }
+
+    const std::shared_ptr<NameArena>& GetNameArena(const std::shared_ptr<Tree<VizBlock>>& tree)
+    {
+        const auto* const deleter = std::get_deleter<TreeDeleter>(tree);
+        return deleter && deleter->arena ? deleter->arena : NameArena::GetSharedArena();
+    }
+} // namespace Scanner
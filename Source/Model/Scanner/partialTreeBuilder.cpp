@@ -0,0 +1,118 @@
+#include "Model/Scanner/partialTreeBuilder.h"
+
+#include <gsl/assert>
+
+#include <functional>
+#include <thread>
+#include <utility>
+
+namespace Scanner
+{
+    PartialTreeBuilder::PartialTreeBuilder(std::shared_ptr<NameArena> nameArena) noexcept
+        : m_nameArena{ std::move(nameArena) }
+    {
+    }
+
+    PartialTreeBuilder::DirectoryId PartialTreeBuilder::ReserveId() noexcept
+    {
+        return m_nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void PartialTreeBuilder::RecordDirectory(
+        DirectoryId id, DirectoryId parentId, ArenaName name, std::uintmax_t bytesInFiles)
+    {
+        // Threads are spread across the shards, so that a given thread will almost always find its
+        // shard's lock uncontended; only the snapshot builder ever competes for it.
+        const auto shardIndex = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        auto& shard = m_shards[shardIndex % ShardCount];
+
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        shard.records.emplace_back(Record{ id, parentId, name, bytesInFiles });
+    }
+
+    void PartialTreeBuilder::CollectRecords()
+    {
+        for (auto& shard : m_shards) {
+            m_collectedRecords.clear();
+
+            {
+                std::lock_guard<std::mutex> lock{ shard.mutex };
+                shard.records.swap(m_collectedRecords);
+            }
+
+            for (auto& record : m_collectedRecords) {
+                if (record.id >= m_directories.size()) {
+                    m_directories.resize(record.id + 1);
+                }
+
+                auto& directory = m_directories[record.id];
+                directory.parentId = record.parentId;
+                directory.name = record.name;
+                directory.bytesInFiles = record.bytesInFiles;
+                directory.isRecorded = true;
+            }
+        }
+    }
+
+    std::shared_ptr<Tree<VizBlock>> PartialTreeBuilder::BuildSnapshot()
+    {
+        CollectRecords();
+
+        constexpr DirectoryId rootId = 0;
+        if (m_directories.empty() || !m_directories[rootId].isRecorded) {
+            return nullptr;
+        }
+
+        const auto directoryCount = m_directories.size();
+
+        // Since parents always have lower identifiers than their children, a single forward pass
+        // suffices to determine which directories are connected to the root. Since the shards are
+        // collected one after the other, a directory may well have been collected before its
+        // parent was; such directories will simply show up in a later snapshot.
+        std::vector<std::uintmax_t> sizes(directoryCount, 0);
+        std::vector<bool> isConnected(directoryCount, false);
+
+        for (DirectoryId id = 0; id < directoryCount; ++id) {
+            const auto& directory = m_directories[id];
+            if (!directory.isRecorded) {
+                continue;
+            }
+
+            isConnected[id] =
+                id == rootId || (directory.parentId < id && isConnected[directory.parentId]);
+            sizes[id] = directory.bytesInFiles;
+        }
+
+        // ...and a single backward pass suffices to roll the sizes up into the root.
+        for (auto id = directoryCount - 1; id > rootId; --id) {
+            if (isConnected[id]) {
+                sizes[m_directories[id].parentId] += sizes[id];
+            }
+        }
+
+        FileInfo rootInfo{ m_directories[rootId].name, Extension{}, sizes[rootId],
+                           FileType::Directory };
+
+        auto tree = CreateTree(VizBlock{ std::move(rootInfo) }, m_nameArena);
+
+        std::vector<Tree<VizBlock>::Node*> nodes(directoryCount, nullptr);
+        nodes[rootId] = tree->GetRoot();
+
+        for (DirectoryId id = rootId + 1; id < directoryCount; ++id) {
+            if (!isConnected[id] || sizes[id] == 0) {
+                continue;
+            }
+
+            // Sizes include those of all subdirectories, so the parent can't have been left out.
+            auto* const parentNode = nodes[m_directories[id].parentId];
+            Expects(parentNode);
+
+            FileInfo directoryInfo{ m_directories[id].name, Extension{}, sizes[id],
+                                    FileType::Directory };
+
+            nodes[id] = parentNode->AppendChild(VizBlock{ std::move(directoryInfo) });
+        }
+
+        return tree;
+    }
+} // namespace Scanner
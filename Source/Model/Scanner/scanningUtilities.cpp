@@ -6,20 +6,53 @@
 
 #ifdef Q_OS_WIN
 #include <fileapi.h>
+#include <processthreadsapi.h>
 #include <winioctl.h>
 
 #include "Utilities/reparsePointDeclarations.h"
 #endif // Q_OS_WIN
 
+#ifdef Q_OS_LINUX
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // Q_OS_LINUX
+
 #include "constants.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <system_error>
 
 #include <Tree/Tree.hpp>
 #include <gsl/assert>
 #include <spdlog/spdlog.h>
 
+#ifdef Q_OS_LINUX
+namespace
+{
+    std::uint64_t ToChangeStamp(const struct stat64& status) noexcept
+    {
+        constexpr std::uint64_t nanosecondsPerSecond = 1'000'000'000;
+
+        const auto modificationTime =
+            static_cast<std::uint64_t>(status.st_mtim.tv_sec) * nanosecondsPerSecond +
+            static_cast<std::uint64_t>(status.st_mtim.tv_nsec);
+
+        const auto changeTime =
+            static_cast<std::uint64_t>(status.st_ctim.tv_sec) * nanosecondsPerSecond +
+            static_cast<std::uint64_t>(status.st_ctim.tv_nsec);
+
+        // The change time usually moves in lockstep with the modification time, but it also
+        // catches the cases in which the modification time was deliberately set back.
+        constexpr std::uint64_t goldenRatio = 0x9E3779B97F4A7C15;
+        return modificationTime ^ (changeTime * goldenRatio);
+    }
+} // namespace
+#endif // Q_OS_LINUX
+
 namespace Scanner
 {
     std::uintmax_t GetFileSizeUsingWinAPI(const std::filesystem::path& path) noexcept
@@ -57,6 +90,86 @@ namespace Scanner
         }
     }
 
+    std::uint64_t ComputeChangeStamp(const std::filesystem::path& path) noexcept
+    {
+        std::uint64_t stamp = 0;
+
+#if defined(Q_OS_LINUX)
+        struct stat64 status;
+        if (::stat64(path.c_str(), &status) != 0) {
+            return 0;
+        }
+
+        stamp = ToChangeStamp(status);
+#elif defined(Q_OS_WIN)
+        std::error_code errorCode;
+        const auto lastWriteTime = std::filesystem::last_write_time(path, errorCode);
+        if (errorCode) {
+            return 0;
+        }
+
+        stamp = static_cast<std::uint64_t>(lastWriteTime.time_since_epoch().count());
+#endif // Q_OS_WIN
+
+        // Zero is reserved to mean that nothing is known about the directory.
+        return stamp == 0 ? 1 : stamp;
+    }
+
+#ifdef Q_OS_LINUX
+    std::uint64_t ComputeChangeStamp(int descriptor) noexcept
+    {
+        struct stat64 status;
+        if (::fstat64(descriptor, &status) != 0) {
+            return 0;
+        }
+
+        const auto stamp = ToChangeStamp(status);
+        return stamp == 0 ? 1 : stamp;
+    }
+#endif // Q_OS_LINUX
+
+    std::size_t DetermineOpenDirectoryLimit() noexcept
+    {
+        std::size_t limit = Constants::Concurrency::MaximumOpenDirectoryCount;
+
+#ifdef Q_OS_LINUX
+        struct rlimit descriptorLimit;
+        if (::getrlimit(RLIMIT_NOFILE, &descriptorLimit) == 0 &&
+            descriptorLimit.rlim_cur != RLIM_INFINITY) {
+            limit = std::min(limit, static_cast<std::size_t>(descriptorLimit.rlim_cur / 2));
+        }
+#endif // Q_OS_LINUX
+
+        return limit;
+    }
+
+    bool LowerThreadPriority() noexcept
+    {
+#if defined(Q_OS_WIN)
+        // Background mode lowers the I/O and memory priority of the thread along with its CPU
+        // priority.
+        return ::SetThreadPriority(::GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN) != 0;
+#elif defined(Q_OS_LINUX)
+        // Not every C library wraps `ioprio_set(...)`, nor defines the constants that go with it.
+        constexpr int ioPriorityWhoProcess = 1;
+        constexpr int ioPriorityClassIdle = 3;
+        constexpr int ioPriorityClassShift = 13;
+
+        // On Linux, both priorities belong to the individual thread rather than to the process.
+        const auto threadId = static_cast<id_t>(::syscall(SYS_gettid));
+
+        const auto hasLoweredIoPriority =
+            ::syscall(
+                SYS_ioprio_set, ioPriorityWhoProcess, threadId,
+                ioPriorityClassIdle << ioPriorityClassShift) == 0;
+
+        const auto hasLoweredCpuPriority =
+            ::setpriority(PRIO_PROCESS, threadId, Constants::Concurrency::BackgroundNiceness) == 0;
+
+        return hasLoweredIoPriority && hasLoweredCpuPriority;
+#endif // Q_OS_LINUX
+    }
+
     void ComputeDirectorySizes(Tree<VizBlock>& tree) noexcept
     {
         for (auto&& node : tree) {
@@ -74,6 +187,36 @@ namespace Scanner
         }
     }
 
+    std::optional<std::filesystem::path> ResolveBelowScanRoot(
+        const std::filesystem::path& path, const std::filesystem::path& scanRoot)
+    {
+        // Strips any trailing separator, since "/data/build/" and "/data/build" ought to refer to
+        // the same directory.
+        const auto normalize = [](const std::filesystem::path& unnormalizedPath) {
+            auto normalizedPath = unnormalizedPath.lexically_normal();
+            if (!normalizedPath.has_filename() && normalizedPath.has_relative_path()) {
+                normalizedPath = normalizedPath.parent_path();
+            }
+
+            return normalizedPath;
+        };
+
+        std::error_code errorCode;
+        const auto absoluteRoot = normalize(std::filesystem::absolute(scanRoot, errorCode));
+        if (errorCode) {
+            return std::nullopt;
+        }
+
+        const auto absolutePath = normalize(path.is_absolute() ? path : absoluteRoot / path);
+        const auto relativePath = absolutePath.lexically_relative(absoluteRoot);
+
+        if (relativePath.empty() || relativePath == "." || *relativePath.begin() == "..") {
+            return std::nullopt;
+        }
+
+        return scanRoot / relativePath;
+    }
+
 #ifdef Q_OS_WIN
     bool IsReparsePoint(const std::filesystem::path& path) noexcept
     {
@@ -1,98 +1,147 @@
 #include "Model/Scanner/scanningWorker.h"
 
+#include "Model/Scanner/concurrencyController.h"
+#include "Model/Scanner/linuxFileSystemBackend.h"
+#include "Model/Scanner/linuxMountTable.h"
 #include "Model/Scanner/scanningUtilities.h"
+#include "Model/Scanner/subtreeEstimator.h"
+#include "Model/Scanner/windowsFileSystemBackend.h"
 #include "constants.h"
 
-#ifdef Q_OS_WIN
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif // Q_OS_WIN
-
-#include <boost/asio/post.hpp>
-
-#ifdef Q_OS_WIN
-#pragma warning(pop)
-#endif // Q_OS_WIN
-
 #include <spdlog/spdlog.h>
 #include <stopwatch.h>
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
 namespace
 {
+    // How often the scanning throughput is sampled in order to tune the number of active threads.
+    constexpr std::chrono::milliseconds ThroughputSamplingInterval{ 250 };
+
+    // How long a throttled thread sleeps at a time before checking whether the scan was cancelled.
+    constexpr std::chrono::milliseconds ThrottlingSleepInterval{ 100 };
+
+    std::uintmax_t ToNanoseconds(std::chrono::steady_clock::duration duration) noexcept
+    {
+        return static_cast<std::uintmax_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
     /**
-     * @brief Removes nodes whose corresponding file or directory size is zero. This is often
-     * necessary because a directory may contain only a single other directory within it that is
-     * empty. In such a case, the outer directory has a size of zero, but std::filesystem::is_empty
-     * will still have reported this directory as being non-empty.
+     * @brief Determines the maximum number of threads that the scanner may use.
      *
-     * @param[in, out] tree           The tree to be pruned.
+     * @param[in] userLimit           The user-specified limit, or zero if none was specified.
+     *
+     * @returns The ceiling on the number of scanning threads.
      */
-    void PruneEmptyFilesAndDirectories(Tree<VizBlock>& tree) noexcept
+    unsigned int DetermineThreadCeiling(unsigned int userLimit) noexcept
     {
-        std::vector<Tree<VizBlock>::Node*> toBeDeleted;
-
-        for (auto&& node : tree) {
-            if (node->file.size == 0) {
-                toBeDeleted.emplace_back(&node);
-            }
+        if (userLimit > 0) {
+            return std::min(userLimit, Constants::Concurrency::MaximumThreadCount);
         }
 
-        const auto nodesRemoved = toBeDeleted.size();
+        // Scanning spends most of its time waiting on the filesystem, so it's worth having more
+        // threads available than there are cores.
+        const auto hardwareThreads = std::thread::hardware_concurrency();
+        return std::clamp(
+            4 * hardwareThreads, Constants::Concurrency::InitialThreadCount,
+            Constants::Concurrency::MaximumThreadCount);
+    }
+
+    /**
+     * @brief Logs the average throughput observed at each level of concurrency.
+     *
+     * @param[in] samples             The samples collected over the course of the scan.
+     */
+    void LogThroughputCurve(const std::vector<Scanner::ThroughputSample>& samples) noexcept
+    {
+        struct Aggregate
+        {
+            double entriesPerSecond = 0;
+            double latencyInMicroseconds = 0;
+            std::size_t sampleCount = 0;
+        };
 
-        for (auto* node : toBeDeleted) {
-            node->DeleteFromTree();
+        std::map<unsigned int, Aggregate> curve;
+        for (const auto& sample : samples) {
+            auto& aggregate = curve[sample.threadCount];
+            aggregate.entriesPerSecond += sample.entriesPerSecond;
+            aggregate.latencyInMicroseconds += sample.latencyInMicroseconds;
+            ++aggregate.sampleCount;
         }
 
         const auto& log = spdlog::get(Constants::Logging::DefaultLog);
-        log->info("Number of Sizeless Files Removed: {:L}", nodesRemoved);
+
+        for (const auto& [threadCount, aggregate] : curve) {
+            const auto sampleCount = static_cast<double>(aggregate.sampleCount);
+
+            log->info(
+                "Throughput at {} threads: {:L} entries/s, {:.1f} us per entry ({} samples).",
+                threadCount, static_cast<std::uintmax_t>(aggregate.entriesPerSecond / sampleCount),
+                aggregate.latencyInMicroseconds / sampleCount, aggregate.sampleCount);
+        }
+    }
+
+    /**
+     * @returns The number of filesystem operations that a scan with the given operation limit may
+     * issue in a single burst.
+     */
+    std::uint64_t DetermineOperationBurst(std::uint32_t operationLimit) noexcept
+    {
+        constexpr auto millisecondsPerSecond = 1'000u;
+        const auto burst = std::uint64_t{ operationLimit } *
+                           Constants::Concurrency::OperationBurstInterval / millisecondsPerSecond;
+
+        return std::max<std::uint64_t>(burst, 1);
     }
 
     /**
      * @brief Contructs the root node for the file tree.
      *
+     * @param[in] backend             The filesystem in which the directory resides.
      * @param[in] path                The path to the directory that should constitute the root
      * node.
+     * @param[in] nameArena           The arena in which to store the names in the tree.
      */
-    std::shared_ptr<Tree<VizBlock>>
-    CreateTreeAndRootNode(const std::filesystem::path& path) noexcept
+    std::shared_ptr<Tree<VizBlock>> CreateTreeAndRootNode(
+        const Scanner::FileSystemBackend& backend, const std::filesystem::path& path,
+        const std::shared_ptr<Scanner::NameArena>& nameArena) noexcept
     {
-        if (!std::filesystem::is_directory(path)) {
+        if (!backend.IsDirectory(path)) {
             return nullptr;
         }
 
-        constexpr auto noExtension = "";
-        FileInfo fileInfo{ path.string(), noExtension, ScanningWorker::UndefinedFileSize,
-                           FileType::Directory };
+        FileInfo fileInfo{ nameArena->Store(path.string()), Scanner::Extension{},
+                           ScanningWorker::UndefinedFileSize, FileType::Directory };
 
-        return std::make_shared<Tree<VizBlock>>(VizBlock{ std::move(fileInfo) });
+        return Scanner::CreateTree(VizBlock{ std::move(fileInfo) }, nameArena);
     }
 
     /**
-     * @brief Detects path elements that will cause infinite looping.
+     * @brief Sets up the backend through which to scan, unless one was provided.
      *
-     * During testing, I ran across a directory containing files whose path contained either
-     * a single dot (representing the current directory), or two dots (representing the parent
-     * directory). The presense of these path elements caused the scanning logic to loop
-     * indefinitely.
-     *
-     * @param[in] path              The path to test.
-     *
-     * @returns True if a problematic element is detected.
+     * @param[in] options             The scanning options.
      */
-    bool ContainsProblematicPathElements(const std::filesystem::path& path) noexcept
+    std::shared_ptr<const Scanner::FileSystemBackend>
+    CreateBackend(const ScanningOptions& options) noexcept
     {
-        for (const auto& entry : path) {
-            const auto& data = entry.native();
+        if (options.backend) {
+            return options.backend;
+        }
+
 #if defined(Q_OS_WIN)
-            if (data == L".." || data == L".") {
+        return std::make_shared<Scanner::WindowsFileSystemBackend>();
 #elif defined(Q_OS_LINUX)
-            if (data == ".." || data == ".") {
+        return std::make_shared<Scanner::LinuxFileSystemBackend>(
+            options.engine, options.shouldStatInInodeOrder);
 #endif // Q_OS_LINUX
-                return true;
-            }
-        }
-
-        return false;
     }
 } // namespace
 
@@ -102,7 +151,15 @@ ScanningWorker::ScanningWorker(
     : m_options{ options },
       m_progress{ progress },
       m_cancellationToken{ cancellationToken },
-      m_fileTree{ CreateTreeAndRootNode(options.path) }
+      m_backend{ CreateBackend(options) },
+      m_nameArena{ std::make_shared<Scanner::NameArena>() },
+      m_fileTree{ CreateTreeAndRootNode(*m_backend, options.path, m_nameArena) },
+      m_scanRoot{ options.path },
+      m_openDirectoryLimit{ Scanner::DetermineOpenDirectoryLimit() },
+      m_scheduler{ DetermineThreadCeiling(options.threadLimit),
+                   Constants::Concurrency::TaskQueueCapacity },
+      m_operationBudget{ options.operationLimit, DetermineOperationBurst(options.operationLimit) },
+      m_partialTreeBuilder{ m_nameArena }
 {
 }
 
@@ -115,102 +172,1024 @@ bool ScanningWorker::IsScannable(const std::filesystem::path& path) noexcept
 #endif // Q_OS_LINUX
 }
 
-void ScanningWorker::ProcessFile(
-    const std::filesystem::path& path, Tree<VizBlock>::Node& treeNode) noexcept
+std::optional<std::uintmax_t>
+ScanningWorker::MeasureFile(const Scanner::FileMetadata& metadata) noexcept
 {
-    const auto fileSize = Scanner::ComputeFileSize(path);
-    if (fileSize == 0u) {
-        return;
+    // A file with multiple hard links is only charged to the first link that we come across, since
+    // all links share the same underlying data.
+    if (m_options.shouldCountHardLinksOnce && metadata.linkCount > 1 &&
+        !m_hardLinkedFiles.Insert(metadata.device, metadata.inode)) {
+        return std::nullopt;
     }
 
-    m_progress.bytesProcessed.fetch_add(fileSize);
-    m_progress.filesScanned.fetch_add(1);
+    return m_options.sizeMetric == FileSizeMetric::Allocated ? metadata.allocatedSize
+                                                             : metadata.size;
+}
+
+std::uintmax_t ScanningWorker::TallyExcludedDirectory(const std::filesystem::path& path) noexcept
+{
+    std::uintmax_t totalSize = 0;
+
+    std::vector<Scanner::DirectoryEntry> entries;
+    Scanner::SystemCallTally tally;
+
+    // The walk happens on the thread that came across the excluded directory, which keeps it out
+    // of the scheduler, and therefore out of the tree, altogether.
+    std::vector<std::filesystem::path> pendingDirectories = { path };
+    while (!pendingDirectories.empty() && !m_cancellationToken.load()) {
+        const auto directory = std::move(pendingDirectories.back());
+        pendingDirectories.pop_back();
+
+        entries.clear();
+        m_backend->ReadDirectory(directory, entries, tally);
+
+        Throttle(1 + entries.size());
+
+        for (const auto& entry : entries) {
+            if (entry.type == FileType::Regular) {
+                totalSize +=
+                    MeasureFile(entry.metadata.value_or(Scanner::FileMetadata{})).value_or(0);
+            } else if (entry.type == FileType::Directory) {
+                auto subdirectory = directory / entry.name;
+
+                // Whatever the mount point rules keep out of the scan stays out of the tally too.
+                if (m_excludedMountPoints.empty() || !IsExcluded(subdirectory)) {
+                    pendingDirectories.emplace_back(std::move(subdirectory));
+                }
+            }
+        }
+    }
 
-    FileInfo fileInfo{ path, fileSize, FileType::Regular };
+    m_progress.bytesProcessed.Add(totalSize);
+    m_progress.syscallsIssued.Add(tally.issued);
+    m_progress.syscallsAvoided.Add(tally.avoided);
 
-    std::unique_lock<decltype(m_mutex)> lock{ m_mutex };
-    treeNode.AppendChild(VizBlock{ std::move(fileInfo) });
+    return totalSize;
 }
 
-void ScanningWorker::ProcessPath(
-    const std::filesystem::path& path, Tree<VizBlock>::Node& node) noexcept
+ScanningWorker::OverviewTreatment ScanningWorker::DetermineOverviewTreatment(
+    const std::string& path, const Tree<VizBlock>::Node* previous) const
 {
-    if (ContainsProblematicPathElements(path) || m_cancellationToken.load()) {
+    constexpr auto separator = static_cast<char>(std::filesystem::path::preferred_separator);
+
+    for (const auto& exactSubtree : m_exactSubtrees) {
+        if (exactSubtree == path) {
+            return OverviewTreatment::ReadInFull;
+        }
+
+        // The directories leading up to an exact subtree have to be read in order to reach it.
+        if (exactSubtree.size() > path.size() && exactSubtree[path.size()] == separator &&
+            exactSubtree.compare(0, path.size(), path) == 0) {
+            return OverviewTreatment::Read;
+        }
+    }
+
+    // Whatever the previous scan did read, rather than estimate, is read again, so that refining
+    // an overview, or expanding a directory, doesn't have to be repeated with every rescan.
+    if (previous && !previous->GetData().file.isUnexpanded) {
+        return OverviewTreatment::Read;
+    }
+
+    return OverviewTreatment::Estimate;
+}
+
+void ScanningWorker::EstimateDirectory(
+    const std::filesystem::path& path, const Tree<VizBlock>::Node* previous,
+    FileInfo& file) noexcept
+{
+    // There's no telling whether an estimated subtree has changed without sampling it again, which
+    // would defeat the purpose of an incremental rescan.
+    if (previous && previous->GetData().file.isUnexpanded) {
+        const auto& previousFile = previous->GetData().file;
+
+        file.size = previousFile.size;
+        file.confidence = previousFile.confidence;
+        file.isUnexpanded = true;
+
+        m_progress.bytesProcessed.Add(file.size);
         return;
     }
 
-    auto isRegularFile = false;
+    const auto isExcluded = [&](const std::filesystem::path& parent, const std::string& name) {
+        if (!m_excludedMountPoints.empty() && IsExcluded(parent / name)) {
+            return true;
+        }
+
+        return !m_exclusionMatcher.IsEmpty() && m_exclusionMatcher.IsExcluded(parent, name);
+    };
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const auto estimate = Scanner::EstimateSubtree(
+        *m_backend, path, m_options.sizeMetric, m_options.samplingLimits, isExcluded);
+
+    const auto elapsedTime = ToNanoseconds(std::chrono::steady_clock::now() - startTime);
+
+    file.size = estimate.size;
+    file.confidence = estimate.confidence;
+    file.isUnexpanded = true;
+
+    m_progress.bytesProcessed.Add(estimate.size);
+    m_progress.filesEstimated.Add(estimate.fileCount);
+    m_progress.directoriesEstimated.Add(estimate.directoryCount + 1);
+    m_progress.syscallsIssued.Add(estimate.tally.issued);
+    m_progress.syscallsAvoided.Add(estimate.tally.avoided);
+    m_progress.filesystemNanoseconds.Add(elapsedTime);
+    m_progress.enumerationNanoseconds.Add(elapsedTime);
+
+    m_busyNanoseconds.Add(elapsedTime);
+    m_entriesRead.Add(estimate.directoriesRead);
+}
+
+std::size_t ScanningWorker::ReadDirectory(
+    Scanner::DirectoryHandle& directory, std::vector<VizBlock>& children,
+    bool& wasInterrupted) noexcept
+{
+    // Even if we fail to read the entire directory, whatever we did manage to read is still useful.
+    std::vector<Scanner::DirectoryEntry> entries;
+    Scanner::SystemCallTally tally;
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto wasReadEntirely = directory.ReadEntries(entries, tally, m_cancellationToken);
+    const auto filesystemTime = std::chrono::steady_clock::now() - startTime;
+
+    // Any file that the backend didn't get around to sizing is left out below, just like a file
+    // that couldn't be stat-ed.
+    wasInterrupted = !wasReadEntirely && m_cancellationToken.load();
+
+    // The progress counters are only updated once per directory, rather than once per file.
+    std::uintmax_t fileCount = 0;
+    std::uintmax_t byteCount = 0;
+    std::uintmax_t duplicateCount = 0;
+
+    for (auto& entry : entries) {
+        switch (entry.type) {
+            case FileType::Regular: {
+                const auto measuredSize =
+                    MeasureFile(entry.metadata.value_or(Scanner::FileMetadata{}));
+
+                if (!measuredSize) {
+                    ++duplicateCount;
+                    break;
+                }
+
+                const auto fileSize = *measuredSize;
+                if (fileSize == 0u) {
+                    break;
+                }
+
+                byteCount += fileSize;
+                ++fileCount;
+
+                FileInfo fileInfo{ Scanner::StoreFileName(entry.name, *m_nameArena), fileSize,
+                                   FileType::Regular };
+
+                children.emplace_back(std::move(fileInfo));
+                break;
+            }
+            case FileType::Directory: {
+                FileInfo directoryInfo{ m_nameArena->Store(entry.name), Scanner::Extension{},
+                                        ScanningWorker::UndefinedFileSize, FileType::Directory };
+
+                children.emplace_back(std::move(directoryInfo));
+                break;
+            }
+            case FileType::Symlink: {
+                break;
+            }
+        }
+    }
+
+    m_progress.filesScanned.Add(fileCount);
+    m_progress.bytesProcessed.Add(byteCount);
+    m_progress.syscallsIssued.Add(tally.issued);
+    m_progress.syscallsAvoided.Add(tally.avoided);
+    m_progress.filesystemNanoseconds.Add(ToNanoseconds(filesystemTime));
+
+    if (duplicateCount > 0) {
+        m_progress.duplicateHardLinksSkipped.Add(duplicateCount);
+    }
+
+    return entries.size();
+}
+
+std::size_t ScanningWorker::ReuseDirectory(
+    const Tree<VizBlock>::Node& previous, std::vector<VizBlock>& children,
+    std::vector<const Tree<VizBlock>::Node*>& matches) noexcept
+{
+    std::uintmax_t fileCount = 0;
+    std::uintmax_t byteCount = 0;
+
+    for (const auto* child = previous.GetFirstChild(); child; child = child->GetNextSibling()) {
+        const auto& file = child->GetData().file;
+
+        // The previous tree is let go of once the scan completes, taking its names along with it,
+        // so every name has to be copied into this scan's arena.
+        const auto name = m_nameArena->Store(file.name);
+
+        if (file.type == FileType::Directory) {
+            FileInfo directoryInfo{ name, file.extension, ScanningWorker::UndefinedFileSize,
+                                    FileType::Directory };
+
+            children.emplace_back(std::move(directoryInfo));
+            matches.emplace_back(child);
+        } else {
+            byteCount += file.size;
+            ++fileCount;
+
+            children.emplace_back(FileInfo{ name, file.extension, file.size, file.type });
+        }
+    }
+
+    m_progress.filesScanned.Add(fileCount);
+    m_progress.bytesProcessed.Add(byteCount);
+
+    m_progress.directoriesReused.Add(1);
+
+    return children.size();
+}
+
+void ScanningWorker::MatchPreviousSubdirectories(
+    const Tree<VizBlock>::Node& previous, const std::vector<VizBlock>& children,
+    std::vector<const Tree<VizBlock>::Node*>& matches)
+{
+    std::unordered_map<std::string_view, const Tree<VizBlock>::Node*> previousSubdirectories;
+
+    for (const auto* child = previous.GetFirstChild(); child; child = child->GetNextSibling()) {
+        const auto& file = child->GetData().file;
+        if (file.type == FileType::Directory) {
+            previousSubdirectories.emplace(file.name, child);
+        }
+    }
+
+    for (const auto& child : children) {
+        if (child.file.type != FileType::Directory) {
+            continue;
+        }
+
+        const auto match = previousSubdirectories.find(child.file.name);
+        matches.emplace_back(match != std::end(previousSubdirectories) ? match->second : nullptr);
+    }
+}
+
+std::filesystem::path ScanningWorker::ResolvePath(const PendingDirectory& directory)
+{
+    std::vector<const PendingDirectory*> lineage;
+    for (const auto* ancestor = &directory; ancestor->parent; ancestor = ancestor->parent) {
+        lineage.emplace_back(ancestor);
+    }
+
+    // The root node is named after the path as it was given, which needn't match the scan root.
+    auto path = m_scanRoot;
+    std::for_each(std::rbegin(lineage), std::rend(lineage), [&](const auto* ancestor) {
+        const auto& file = ancestor->node->GetData().file;
+        path /= file.GetFullName();
+    });
+
+    m_resolvedPathCount.Add(1);
+    return path;
+}
+
+std::shared_ptr<const Scanner::DirectoryHandle> ScanningWorker::ShareDirectoryHandle(
+    std::unique_ptr<Scanner::DirectoryHandle> handle, std::size_t subdirectoryCount) noexcept
+{
+    if (!handle || subdirectoryCount == 0) {
+        return nullptr;
+    }
+
+    if (m_retainedDirectoryCount.fetch_add(1) >= m_openDirectoryLimit) {
+        m_retainedDirectoryCount.fetch_sub(1);
+        return nullptr;
+    }
+
     try {
-        // In certain cases, this function can, apparently, raise exceptions, although it isn't
-        // entirely clear to me what circumstances need to exist for this to occur:
-        isRegularFile = std::filesystem::is_regular_file(path);
+        return std::shared_ptr<const Scanner::DirectoryHandle>{
+            handle.release(), [&](const Scanner::DirectoryHandle* retainedHandle) noexcept {
+                delete retainedHandle;
+                m_retainedDirectoryCount.fetch_sub(1);
+            }
+        };
     } catch (...) {
+        // Should the control block fail to allocate, the handle will already have been deleted.
+        m_retainedDirectoryCount.fetch_sub(1);
+        return nullptr;
+    }
+}
+
+void ScanningWorker::ProcessDirectory(DirectoryTask& task) noexcept
+{
+    auto* const directory = task.directory;
+
+    // The full path is only pieced together if there's no way around it, since opening the
+    // directory relative to its parent spares the kernel from resolving every component again.
+    std::filesystem::path path;
+    const auto resolvePath = [&]() -> const std::filesystem::path& {
+        if (path.empty()) {
+            path = ResolvePath(*directory);
+        }
+
+        return path;
+    };
+
+    std::unique_ptr<Scanner::DirectoryHandle> handle;
+
+    std::vector<VizBlock> children;
+
+    // Only filled in when rescanning, in which case it holds the previous incarnation of every
+    // subdirectory, in the order in which the subdirectories appear among the children.
+    std::vector<const Tree<VizBlock>::Node*> previousSubdirectories;
+
+    auto wasRead = false;
+    auto wasReused = false;
+    auto wasInterrupted = false;
+
+    // Opening the directory counts as one operation, and every entry read from it as another.
+    std::uint64_t operationCount = 0;
+
+    if (!m_cancellationToken.load()) {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const auto& file = directory->node->GetData().file;
+        handle = m_backend->OpenDirectory(
+            task.parentHandle.get(), file.GetFullName(), [&] { return resolvePath(); });
+
+        // Once every subdirectory has been opened, the parent no longer needs to be held open.
+        task.parentHandle.reset();
+
+        m_progress.filesystemNanoseconds.Add(
+            ToNanoseconds(std::chrono::steady_clock::now() - startTime));
+
+        // The stamp is taken before the directory is read, so that any change made while the
+        // directory is being read will be caught by the next scan.
+        const auto changeStamp = handle ? handle->ComputeChangeStamp() : 0;
+        const auto* const previous = task.previous;
+
+        // The contents of the directory are first gathered into a buffer that is local to this
+        // task, so that the directory can be read without touching the shared tree at all. If the
+        // directory hasn't changed since the previous scan, it need not be read at all.
+        std::size_t entryCount = 0;
+        if (previous && changeStamp != 0 && changeStamp == previous->GetData().file.changeStamp) {
+            entryCount = ReuseDirectory(*previous, children, previousSubdirectories);
+            wasReused = true;
+        } else {
+            entryCount = handle ? ReadDirectory(*handle, children, wasInterrupted) : 0;
+
+            if (previous) {
+                MatchPreviousSubdirectories(*previous, children, previousSubdirectories);
+            }
+        }
+
+        operationCount = 1 + (wasReused ? 0 : entryCount);
+
+        // A directory that was only partly read must be read again by the next scan, and has
+        // nothing worth journaling either, just like a directory that couldn't be opened.
+        directory->node->GetData().file.changeStamp = wasInterrupted ? 0 : changeStamp;
+        wasRead = changeStamp != 0 && !wasInterrupted;
+
+        const auto elapsedTime = ToNanoseconds(std::chrono::steady_clock::now() - startTime);
+        m_busyNanoseconds.Add(elapsedTime);
+        m_progress.enumerationNanoseconds.Add(elapsedTime);
+        m_entriesRead.Add(entryCount);
+
+        if (m_options.entryBudget > 0) {
+            m_budgetedEntryCount.fetch_add(entryCount);
+        }
+
+        if (entryCount > 0 && directory->parent) {
+            m_progress.directoriesScanned.Add(1);
+        }
+    } else {
+        wasInterrupted = true;
+    }
+
+    // Once the scan has been cancelled, nothing further is read, so any subdirectories found so
+    // far end up pruned as empty. Marking the directory keeps the gap from going unnoticed.
+    if (wasInterrupted) {
+        directory->isIncomplete.store(true);
+        m_unreadDirectoryCount.Add(1);
+
+        AbandonQueuedDirectories();
+    }
+
+    // Since every directory is scanned by exactly one task, that task is also the only one that
+    // will ever append children to the corresponding node. As such, the finished batch can be
+    // published into the tree without taking a lock. The subdirectories aren't queued up until
+    // after the entire batch has been published.
+    std::vector<std::tuple<Tree<VizBlock>::Node*, const Tree<VizBlock>::Node*, bool>>
+        subdirectories;
+    std::uintmax_t bytesInFiles = 0;
+    std::size_t subdirectoryIndex = 0;
+
+    // Subdirectories that lie beyond the overview depth, or that turn up once the entry budget has
+    // run out, are left unexpanded, unless they have to be read in order to honour the options.
+    const auto isBeyondOverviewDepth =
+        m_options.overviewDepth > 0 && task.depth >= m_options.overviewDepth;
+    const auto isOverBudget =
+        m_options.entryBudget > 0 && m_budgetedEntryCount.load() >= m_options.entryBudget;
+
+    for (auto& child : children) {
+        if (child.file.type != FileType::Directory) {
+            bytesInFiles += child.file.size;
+            directory->node->AppendChild(std::move(child));
+            continue;
+        }
+
+        const Tree<VizBlock>::Node* previousSubdirectory = nullptr;
+        if (!previousSubdirectories.empty()) {
+            previousSubdirectory = previousSubdirectories[subdirectoryIndex];
+        }
+
+        ++subdirectoryIndex;
+
+        // A mount point can only be excluded if its name gives it away.
+        if (!m_excludedMountPointNames.empty() &&
+            m_excludedMountPointNames.count(child.file.name.ToString()) > 0 &&
+            IsExcluded(resolvePath() / child.file.name.View())) {
+            continue;
+        }
+
+        // Excluded directories are ruled out before they are ever read, so that none of their
+        // contents cost anything more than what it takes to tally them, if even that.
+        if (!m_exclusionMatcher.IsEmpty() &&
+            m_exclusionMatcher.IsExcludedLazily(child.file.name.ToString(), resolvePath)) {
+            if (!m_options.exclusionRules.shouldTallyExcludedDirectories) {
+                continue;
+            }
+
+            child.file.size = TallyExcludedDirectory(resolvePath() / child.file.name.View());
+            child.file.isExcluded = true;
+
+            // The tally stops short as soon as the scan is cancelled.
+            if (m_cancellationToken.load()) {
+                directory->isIncomplete.store(true);
+            }
+
+            // Since the directory is kept as a leaf, it counts towards its parent like a file.
+            if (child.file.size > 0) {
+                bytesInFiles += child.file.size;
+                directory->node->AppendChild(std::move(child));
+            }
+
+            continue;
+        }
+
+        auto isWithinExactSubtree = task.isWithinExactSubtree;
+
+        // Once the scan has been cancelled, there's no point in sampling anything either, so the
+        // subdirectory is left to its task, which will find it unread.
+        if ((isBeyondOverviewDepth || isOverBudget) && !isWithinExactSubtree &&
+            !m_cancellationToken.load()) {
+            const auto subdirectoryPath = resolvePath() / child.file.name.View();
+
+            const auto treatment =
+                DetermineOverviewTreatment(subdirectoryPath.string(), previousSubdirectory);
+
+            if (treatment == OverviewTreatment::Estimate) {
+                EstimateDirectory(subdirectoryPath, previousSubdirectory, child.file);
+
+                // Like an excluded directory, an estimated one is kept as a leaf.
+                if (child.file.size > 0) {
+                    bytesInFiles += child.file.size;
+                    directory->node->AppendChild(std::move(child));
+                }
+
+                continue;
+            }
+
+            isWithinExactSubtree = treatment == OverviewTreatment::ReadInFull;
+        }
+
+        auto* const childNode = directory->node->AppendChild(std::move(child));
+        subdirectories.emplace_back(childNode, previousSubdirectory, isWithinExactSubtree);
+    }
+
+    directory->size.fetch_add(bytesInFiles);
+
+    if (ShouldPublishPartialResults()) {
+        const auto parentId =
+            directory->parent ? directory->parent->id : Scanner::PartialTreeBuilder::NoParent;
+
+        m_partialTreeBuilder.RecordDirectory(
+            directory->id, parentId, directory->node->GetData().file.name, bytesInFiles);
+    }
+
+    if (m_isKeepingJournal && wasRead) {
+        const auto parentId =
+            directory->parent ? directory->parent->id : Scanner::CheckpointJournal::NoParent;
+
+        if (wasReused && m_isResumingFromJournal) {
+            m_checkpointJournal.RecordReuse(
+                directory->id, parentId, directory->node->GetData().file);
+        } else {
+            m_checkpointJournal.RecordListing(directory->id, parentId, *directory->node);
+        }
+    }
+
+    // The directory is held open until all of its subdirectories have been opened relative to it,
+    // unless too many directories are being held open already, in which case the subdirectories
+    // will have to be opened by their full paths instead.
+    const auto sharedHandle = ShareDirectoryHandle(std::move(handle), subdirectories.size());
+
+    // The extra count acts as a guard that keeps the directory from being finalized while its
+    // subdirectories are still being submitted, since some of those may run to completion inline.
+    directory->pendingCount.store(subdirectories.size() + 1);
+
+    for (const auto& [subdirectory, previousSubdirectory, isWithinExactSubtree] : subdirectories) {
+        // Ownership of the bookkeeping passes to the subdirectory, which will release it once it
+        // has been finalized.
+        auto* const pendingSubdirectory =
+            new PendingDirectory{ subdirectory, directory, m_partialTreeBuilder.ReserveId() };
+        m_scheduler.Submit(DirectoryTask{ pendingSubdirectory, sharedHandle, previousSubdirectory,
+                                          task.depth + 1, isWithinExactSubtree });
+    }
+
+    CompleteDirectory(directory);
+
+    // The operations are paid for once the subdirectories have been handed out, so that a thread
+    // that is held up doesn't hold up any of the others.
+    Throttle(operationCount);
+}
+
+void ScanningWorker::Throttle(std::uint64_t operationCount) noexcept
+{
+    if (m_operationBudget.IsUnlimited() || operationCount == 0) {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const auto delay = m_operationBudget.Consume(operationCount, startTime);
+    if (delay.count() == 0) {
         return;
     }
 
-    if (isRegularFile) {
-        ProcessFile(path, node);
-    } else if (std::filesystem::is_directory(path) && IsScannable(path)) {
-        try {
-            // In some edge-cases, the Windows operating system doesn't allow anyone to access
-            // certain directories, and attempts to do so will result in exceptional behaviour---pun
-            // intended. In order to deal with these rare cases, we'll need to rely on a try-catch
-            // to keep going. One example of a problematic directory in Windows 7 is: "C:\System
-            // Volume Information".
-            if (std::filesystem::is_empty(path)) {
-                return;
+    // The wait is served in installments, so that a cancelled scan doesn't have to sit it out.
+    const auto endTime = startTime + delay;
+    for (auto now = startTime; now < endTime && !m_cancellationToken.load();
+         now = std::chrono::steady_clock::now()) {
+        std::this_thread::sleep_for(
+            std::min<std::chrono::nanoseconds>(endTime - now, ThrottlingSleepInterval));
+    }
+
+    m_progress.throttledNanoseconds.Add(
+        ToNanoseconds(std::chrono::steady_clock::now() - startTime));
+}
+
+void ScanningWorker::CompleteDirectory(PendingDirectory* directory) noexcept
+{
+    // Finalizing a directory may complete its parent, which may in turn complete its own parent,
+    // and so on. Walking up iteratively avoids recursing as deep as the tree itself.
+    while (directory && directory->pendingCount.fetch_sub(1) == 1) {
+        auto& node = *directory->node;
+        auto startTime = std::chrono::steady_clock::now();
+
+        // Every child of this directory has already been finalized at this point, so nothing else
+        // can be touching these nodes anymore.
+        if (directory->hasEmptySubdirectories.load()) {
+            // An empty subdirectory leaves no trace in the tree, so a later rescan would have no
+            // way of noticing that it has since been filled. Clearing the stamp ensures that this
+            // directory, and therefore the empty subdirectory, will be read again.
+            node->file.changeStamp = 0;
+
+            auto* child = node.GetFirstChild();
+            while (child) {
+                auto* const nextChild = child->GetNextSibling();
+
+                if (child->GetData().file.size == 0) {
+                    child->DeleteFromTree();
+                    m_prunedDirectoryCount.fetch_add(1);
+                }
+
+                child = nextChild;
             }
-        } catch (...) {
-            return;
+
+            const auto pruningEndTime = std::chrono::steady_clock::now();
+            m_progress.pruningNanoseconds.Add(ToNanoseconds(pruningEndTime - startTime));
+            startTime = pruningEndTime;
+        }
+
+        const auto size = directory->size.load();
+        node->file.size = size;
+
+        // An incomplete directory that turns out empty is pruned like any other, but whatever it
+        // held is missing from its parent all the same.
+        const auto isIncomplete = directory->isIncomplete.load();
+        node->file.isIncomplete = isIncomplete;
+
+        auto* const parent = directory->parent;
+        if (parent) {
+            if (isIncomplete) {
+                parent->isIncomplete.store(true);
+            }
+
+            if (size == 0) {
+                parent->hasEmptySubdirectories.store(true);
+            } else {
+                parent->size.fetch_add(size);
+            }
+        }
+
+        delete directory;
+        directory = parent;
+
+        m_progress.propagationNanoseconds.Add(
+            ToNanoseconds(std::chrono::steady_clock::now() - startTime));
+    }
+}
+
+void ScanningWorker::AbandonQueuedDirectories() noexcept
+{
+    // Rather than have every queued directory find out about the cancellation one task at a time,
+    // the queues are emptied in one go. A dropped directory hasn't been read, so completing it
+    // only settles the bookkeeping that its parent is waiting on.
+    for (auto& task : m_scheduler.Cancel()) {
+        auto* const directory = task.directory;
+        directory->isIncomplete.store(true);
+        directory->pendingCount.store(1);
+        m_unreadDirectoryCount.Add(1);
+
+        CompleteDirectory(directory);
+    }
+}
+
+void ScanningWorker::RegulateConcurrency() noexcept
+{
+    const auto threadCeiling = static_cast<unsigned int>(m_scheduler.GetThreadCount());
+
+    constexpr auto minimumThreadCount = 1u;
+    Scanner::ConcurrencyController controller{ minimumThreadCount, threadCeiling,
+                                               Constants::Concurrency::InitialThreadCount };
+
+    m_scheduler.SetActiveThreadLimit(controller.GetThreadCount());
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+    log->info(
+        "Scanning with {} of at most {} threads.", controller.GetThreadCount(), threadCeiling);
+
+    auto lastSampleTime = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock{ m_completionMutex };
+    while (!m_scanCompletionSignal.wait_for(
+        lock, ThroughputSamplingInterval, [&] { return m_isScanComplete; })) {
+        const auto now = std::chrono::steady_clock::now();
+        const auto elapsedTime = now - lastSampleTime;
+        lastSampleTime = now;
+
+        m_progress.queueDepth.store(m_scheduler.GetOutstandingTaskCount());
+
+        const auto previousThreadCount = controller.GetThreadCount();
+        const auto threadCount = controller.Update(
+            m_entriesRead.Load(), std::chrono::nanoseconds{ m_busyNanoseconds.Load() },
+            elapsedTime);
+
+        if (threadCount != previousThreadCount) {
+            log->info(
+                "Adjusting scanning concurrency from {} to {} threads.", previousThreadCount,
+                threadCount);
+
+            m_scheduler.SetActiveThreadLimit(threadCount);
+        }
+    }
+
+    m_progress.queueDepth.store(0);
+
+    log->info("Finished scanning with {} active threads.", controller.GetThreadCount());
+    LogThroughputCurve(controller.GetSamples());
+}
+
+bool ScanningWorker::ShouldPublishPartialResults() const noexcept
+{
+    return m_options.partialResultsInterval.count() > 0 &&
+           static_cast<bool>(m_options.onPartialResultsCallback);
+}
+
+void ScanningWorker::PublishPartialResults() noexcept
+{
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+    std::unique_lock<std::mutex> lock{ m_completionMutex };
+    while (!m_scanCompletionSignal.wait_for(
+        lock, m_options.partialResultsInterval, [&] { return m_isScanComplete; })) {
+        // The snapshot is assembled from the summaries that the scanning threads leave behind, so
+        // there's no need to hold on to the lock, or to hold up the scanning threads, meanwhile.
+        lock.unlock();
+
+        std::shared_ptr<Tree<VizBlock>> snapshot;
+        const auto stopwatch = Stopwatch<std::chrono::milliseconds>(
+            [&] { snapshot = m_partialTreeBuilder.BuildSnapshot(); });
+
+        if (snapshot && !m_cancellationToken.load()) {
+            log->info(
+                "Built a snapshot of {:L} directories in: {:L} {}", snapshot->Size(),
+                stopwatch.GetElapsedTime().count(), stopwatch.GetUnitsAsString());
+
+            emit PartialResults(snapshot);
+        }
+
+        lock.lock();
+    }
+}
+
+void ScanningWorker::OpenCheckpointJournal()
+{
+    const auto& path = m_options.checkpointPath;
+    if (path.empty()) {
+        return;
+    }
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+    // The new session is appended right after the last intact record, if there is a journal to
+    // resume from at all.
+    std::uintmax_t intactSize = 0;
+
+    if (!m_options.previousTree) {
+        auto restoredTree = Scanner::CheckpointJournal::Restore(
+            path, m_options.path, m_options.sizeMetric, &intactSize);
+
+        if (restoredTree) {
+            log->info("Resuming the unfinished scan journaled at \"{}\".", path.string());
+
+            m_options.previousTree = std::move(restoredTree);
+            m_isResumingFromJournal = true;
+        } else {
+            intactSize = 0;
         }
+    }
+
+    m_isKeepingJournal =
+        m_checkpointJournal.Open(path, m_options.path, m_options.sizeMetric, intactSize);
+
+    if (!m_isKeepingJournal) {
+        log->warn("Could not open the scan journal at \"{}\".", path.string());
+    }
+}
 
-        constexpr auto emptyExtension = "";
-        FileInfo directoryInfo{ path.filename().string(), emptyExtension,
-                                ScanningWorker::UndefinedFileSize, FileType::Directory };
+void ScanningWorker::WriteCheckpoints() noexcept
+{
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+    auto hasFailed = false;
 
-        std::unique_lock<decltype(m_mutex)> lock{ m_mutex };
-        auto* const lastChild = node.AppendChild(VizBlock{ std::move(directoryInfo) });
+    std::unique_lock<std::mutex> lock{ m_completionMutex };
+    while (!m_scanCompletionSignal.wait_for(
+        lock, m_options.checkpointInterval, [&] { return m_isScanComplete; })) {
         lock.unlock();
 
-        m_progress.directoriesScanned.fetch_add(1);
+        // A failure to write to the journal shouldn't stop the scan, but it's worth a mention.
+        if (!m_checkpointJournal.Flush() && !hasFailed) {
+            log->warn("Could not write to the scan journal; the scan may not be resumable.");
+            hasFailed = true;
+        }
 
-        AddSubDirectoriesToQueue(path, *lastChild);
+        lock.lock();
     }
 }
 
-void ScanningWorker::AddSubDirectoriesToQueue(
-    const std::filesystem::path& path, Tree<VizBlock>::Node& node) noexcept
+void ScanningWorker::CloseCheckpointJournal()
 {
-    auto itr = std::filesystem::directory_iterator{ path };
-    const auto end = std::filesystem::directory_iterator{};
+    if (!m_isKeepingJournal) {
+        return;
+    }
 
-    while (itr != end) {
-        boost::asio::post(
-            m_threadPool, [&, path = itr->path() ]() noexcept { ProcessPath(path, node); });
+    // A scan that ran to completion has nothing left to resume.
+    const auto wasCancelled = m_cancellationToken.load();
+    m_checkpointJournal.Close(wasCancelled);
 
-        ++itr;
+    if (wasCancelled) {
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+        log->info(
+            "Kept the scan journal at \"{}\", from which the next scan will resume.",
+            m_options.checkpointPath.string());
     }
 }
 
+void ScanningWorker::IdentifyExcludedMountPoints()
+{
+#if defined(Q_OS_LINUX)
+    auto& exclusionRules = m_options.exclusionRules;
+
+    if (!m_options.shouldStayOnFilesystem && !m_options.shouldSkipPseudoFilesystems &&
+        exclusionRules.filesystemTypes.empty()) {
+        return;
+    }
+
+    // The mount table only describes the actual filesystem.
+    if (m_options.backend) {
+        return;
+    }
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+    const auto mountTable = Scanner::MountTable::LoadFromSystem();
+    if (mountTable.IsEmpty()) {
+        log->warn("Could not read the mount table; filesystem boundaries will not be respected.");
+        return;
+    }
+
+    // The mount table only ever contains absolute, normalized paths.
+    std::error_code errorCode;
+    auto scanRoot = std::filesystem::weakly_canonical(m_options.path, errorCode);
+    if (errorCode) {
+        return;
+    }
+
+    const auto* const rootMountPoint = mountTable.FindContaining(scanRoot);
+
+    const auto& excludedTypes = exclusionRules.filesystemTypes;
+    auto hasExcludedTypes = false;
+
+    for (auto& mountPoint : mountTable.FindBelow(scanRoot)) {
+        const auto isExcludedType =
+            std::find(
+                std::begin(excludedTypes), std::end(excludedTypes), mountPoint.filesystemType) !=
+            std::end(excludedTypes);
+
+        if (isExcludedType) {
+            log->info(
+                "Excluding \"{}\", since it's a {} filesystem.", mountPoint.path,
+                mountPoint.filesystemType);
+
+            // Handing the mount point over to the exclusion rules allows it to be tallied, if so
+            // desired, just like any other excluded directory.
+            exclusionRules.paths.emplace_back(std::move(mountPoint.path));
+            hasExcludedTypes = true;
+        } else if (
+            m_options.shouldSkipPseudoFilesystems &&
+            Scanner::MountTable::IsPseudoFilesystem(mountPoint.filesystemType)) {
+            log->info(
+                "Skipping \"{}\", since it's a {} filesystem.", mountPoint.path,
+                mountPoint.filesystemType);
+
+            m_excludedMountPointNames.emplace(std::filesystem::path{ mountPoint.path }.filename());
+            m_excludedMountPoints.emplace(std::move(mountPoint.path));
+        } else if (
+            m_options.shouldStayOnFilesystem && rootMountPoint &&
+            mountPoint.device != rootMountPoint->device) {
+            log->info("Skipping \"{}\", since it's on another filesystem.", mountPoint.path);
+
+            m_excludedMountPointNames.emplace(std::filesystem::path{ mountPoint.path }.filename());
+            m_excludedMountPoints.emplace(std::move(mountPoint.path));
+        }
+    }
+
+    if (!m_excludedMountPoints.empty() || hasExcludedTypes) {
+        m_scanRoot = std::move(scanRoot);
+    }
+#endif // Q_OS_LINUX
+}
+
+bool ScanningWorker::IsExcluded(const std::filesystem::path& path) const
+{
+    return m_excludedMountPoints.count(path.string()) > 0;
+}
+
+const Tree<VizBlock>::Node* ScanningWorker::SelectPreviousRoot() const noexcept
+{
+    const auto& previousTree = m_options.previousTree;
+    if (!previousTree || !previousTree->GetRoot()) {
+        return nullptr;
+    }
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+
+    const auto* const previousRoot = previousTree->GetRoot();
+    if (previousRoot->GetData().file.name != m_options.path.string()) {
+        log->info("The previous scan has a different root; scanning everything again.");
+        return nullptr;
+    }
+
+    // Carrying files over means never seeing their links, so there'd be no telling whether a file
+    // that was just read shares its data with one that was carried over.
+    if (m_options.shouldCountHardLinksOnce) {
+        log->info("Hard links are to be counted once; scanning everything again.");
+        return nullptr;
+    }
+
+    log->info("Rescanning only the directories that changed since the previous scan.");
+    return previousRoot;
+}
+
 void ScanningWorker::Start()
 {
     emit ProgressUpdate();
 
+    IdentifyExcludedMountPoints();
+
+    m_exclusionMatcher = Scanner::ExclusionMatcher{ m_options.exclusionRules, m_scanRoot };
+
+    for (const auto& exactSubtree : m_options.exactSubtrees) {
+        if (const auto resolvedPath = Scanner::ResolveBelowScanRoot(exactSubtree, m_scanRoot)) {
+            m_exactSubtrees.emplace_back(resolvedPath->string());
+        }
+    }
+
+    // Restoring a journal yields the previous tree, so this has to happen before the scan starts.
+    OpenCheckpointJournal();
+
+    std::thread regulator{ [&]() noexcept { RegulateConcurrency(); } };
+
+    std::thread publisher;
+    if (ShouldPublishPartialResults()) {
+        publisher = std::thread{ [&]() noexcept { PublishPartialResults(); } };
+    }
+
+    std::thread checkpointer;
+    if (m_isKeepingJournal) {
+        checkpointer = std::thread{ [&]() noexcept { WriteCheckpoints(); } };
+    }
+
+    // Priorities belong to individual threads, so every scanning thread has to lower its own.
+    std::atomic<bool> hasLoweredPriority{ true };
+    std::function<void()> threadInitializer;
+    if (m_options.shouldRunInBackground) {
+        threadInitializer = [&]() noexcept {
+            if (!Scanner::LowerThreadPriority()) {
+                hasLoweredPriority.store(false);
+            }
+        };
+    }
+
     const auto stopwatch = Stopwatch<std::chrono::seconds>([&]() noexcept {
-        boost::asio::post(m_threadPool, [&]() noexcept {
-            AddSubDirectoriesToQueue(m_options.path, *m_fileTree->GetRoot());
-        });
+        const auto rootId = m_partialTreeBuilder.ReserveId();
+        auto* const root = new PendingDirectory{ m_fileTree->GetRoot(), nullptr, rootId };
 
-        m_threadPool.join();
+        m_scheduler.Run(
+            DirectoryTask{ root, nullptr, SelectPreviousRoot() },
+            [&](DirectoryTask& task) noexcept { ProcessDirectory(task); }, threadInitializer);
     });
 
+    // Nothing refers to the previous results anymore, and they may well be sizeable.
+    m_options.previousTree.reset();
+
+    {
+        std::lock_guard<std::mutex> lock{ m_completionMutex };
+        m_isScanComplete = true;
+    }
+
+    m_scanCompletionSignal.notify_all();
+    regulator.join();
+
+    // Any snapshot still in flight is sure to be delivered before the final results are.
+    if (publisher.joinable()) {
+        publisher.join();
+    }
+
+    if (checkpointer.joinable()) {
+        checkpointer.join();
+    }
+
+    CloseCheckpointJournal();
+
     const auto& log = spdlog::get(Constants::Logging::DefaultLog);
     log->info(
         "Scanned Drive in: {:L} {}", stopwatch.GetElapsedTime().count(),
         stopwatch.GetUnitsAsString());
 
-    Scanner::ComputeDirectorySizes(*m_fileTree);
-    PruneEmptyFilesAndDirectories(*m_fileTree);
+    log->info(
+        "Scheduler stole {:L} directories and ran {:L} directories inline.",
+        m_scheduler.GetStolenTaskCount(), m_scheduler.GetInlinedTaskCount());
+
+    // Since every directory is sized and pruned as soon as its last subdirectory completes, the
+    // tree is ready to go as soon as the scheduler runs dry.
+    log->info("Number of Empty Directories Removed: {:L}", m_prunedDirectoryCount.load());
+    log->info("Number of Unchanged Directories Reused: {:L}", m_progress.directoriesReused.Load());
+
+    if (m_fileTree->GetRoot()->GetData().file.isIncomplete) {
+        log->info(
+            "The scan was cancelled, leaving {:L} directories that were found unread, or only "
+            "partly read.",
+            m_unreadDirectoryCount.Load());
+    }
+
+    log->info(
+        "Opened directories relative to their parents, except for {:L} that needed a full path.",
+        m_resolvedPathCount.Load());
+
+    if (m_options.overviewDepth > 0 || m_options.entryBudget > 0) {
+        log->info(
+            "Estimated a further {:L} files in {:L} directories that were left unexpanded.",
+            m_progress.filesEstimated.Load(), m_progress.directoriesEstimated.Load());
+    }
+
+    if (m_options.shouldRunInBackground) {
+        if (hasLoweredPriority.load()) {
+            log->info("Scanned in the background, at the lowest CPU and I/O priority.");
+        } else {
+            log->warn("Could not lower the priority of every scanning thread.");
+        }
+    }
+
+    if (!m_operationBudget.IsUnlimited()) {
+        constexpr auto nanosecondsPerMillisecond = 1'000'000u;
+        const auto throttledTime = m_progress.throttledNanoseconds.Load();
+        const auto activeTime = static_cast<std::uintmax_t>(m_progress.GetActiveTime().count());
+
+        log->info(
+            "Held back for {:L} ms by the limit of {:L} operations per second, against {:L} ms of "
+            "active scanning.",
+            throttledTime / nanosecondsPerMillisecond, m_options.operationLimit,
+            activeTime / nanosecondsPerMillisecond);
+    }
 
     emit Finished(m_fileTree);
 }
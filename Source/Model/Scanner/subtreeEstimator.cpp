@@ -0,0 +1,207 @@
+#include "Model/Scanner/subtreeEstimator.h"
+#include "Model/Scanner/scanningOptions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief The contents of a single directory, boiled down to what the estimate needs.
+     */
+    struct Listing
+    {
+        std::uintmax_t size = 0;
+        std::uintmax_t fileCount = 0;
+        std::vector<std::string> subdirectories;
+    };
+
+    /**
+     * @brief A small, fast, and above all reproducible source of randomness.
+     */
+    class SplitMix64
+    {
+      public:
+        explicit SplitMix64(std::uint64_t seed) noexcept : m_state{ seed }
+        {
+        }
+
+        /**
+         * @returns A number in the range [0, bound).
+         */
+        std::size_t NextBelow(std::size_t bound) noexcept
+        {
+            m_state += 0x9E3779B97F4A7C15ull;
+
+            auto value = m_state;
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+            value = value ^ (value >> 31);
+
+            return static_cast<std::size_t>(value % bound);
+        }
+
+      private:
+        std::uint64_t m_state;
+    };
+
+    /**
+     * @brief Maps a confidence interval onto a percentage, such that an estimate whose standard
+     * error amounts to a tenth of the estimate itself comes out at 90%.
+     *
+     * @param[in] samples         The estimate yielded by each probe.
+     */
+    std::uint8_t DetermineConfidence(const std::vector<double>& samples) noexcept
+    {
+        // Anything short of reading the whole subtree leaves room for error.
+        constexpr auto maximumConfidence = 99.0;
+
+        const auto sampleCount = static_cast<double>(samples.size());
+        if (samples.size() < 2) {
+            return 0;
+        }
+
+        double mean = 0;
+        for (const auto sample : samples) {
+            mean += sample / sampleCount;
+        }
+
+        if (mean <= 0) {
+            return static_cast<std::uint8_t>(maximumConfidence);
+        }
+
+        double variance = 0;
+        for (const auto sample : samples) {
+            variance += (sample - mean) * (sample - mean) / (sampleCount - 1);
+        }
+
+        const auto relativeError = std::sqrt(variance / sampleCount) / mean;
+        const auto confidence = std::clamp(100.0 * (1.0 - relativeError), 0.0, maximumConfidence);
+
+        return static_cast<std::uint8_t>(std::lround(confidence));
+    }
+
+    std::uintmax_t ToCount(double value) noexcept
+    {
+        // Extrapolating from a wildly unrepresentative path can produce absurd figures, which
+        // must at least not overflow.
+        constexpr auto largestCount = 9.0e18;
+        return static_cast<std::uintmax_t>(std::llround(std::clamp(value, 0.0, largestCount)));
+    }
+} // namespace
+
+namespace Scanner
+{
+    SubtreeEstimate EstimateSubtree(
+        const FileSystemBackend& backend, const std::filesystem::path& root,
+        FileSizeMetric sizeMetric, const SamplingLimits& limits,
+        const ExclusionPredicate& isExcluded)
+    {
+        SubtreeEstimate estimate;
+
+        std::unordered_map<std::string, Listing> listings;
+        std::vector<DirectoryEntry> entries;
+
+        const auto readListing = [&](const std::filesystem::path& path) -> const Listing& {
+            const auto [position, isNew] = listings.try_emplace(path.string());
+            auto& listing = position->second;
+
+            if (!isNew) {
+                return listing;
+            }
+
+            entries.clear();
+            backend.ReadDirectory(path, entries, estimate.tally);
+            ++estimate.directoriesRead;
+
+            for (auto& entry : entries) {
+                if (entry.type == FileType::Directory) {
+                    if (!isExcluded || !isExcluded(path, entry.name)) {
+                        listing.subdirectories.emplace_back(std::move(entry.name));
+                    }
+                } else if (entry.type == FileType::Regular && entry.metadata) {
+                    listing.size += sizeMetric == FileSizeMetric::Allocated
+                                        ? entry.metadata->allocatedSize
+                                        : entry.metadata->size;
+                    ++listing.fileCount;
+                }
+            }
+
+            return listing;
+        };
+
+        std::vector<std::filesystem::path> pendingDirectories = { root };
+        std::size_t nextDirectory = 0;
+
+        while (nextDirectory < pendingDirectories.size() &&
+               estimate.directoriesRead < limits.directoryBudget) {
+            const auto path = pendingDirectories[nextDirectory++];
+            for (const auto& subdirectory : readListing(path).subdirectories) {
+                pendingDirectories.emplace_back(path / subdirectory);
+            }
+        }
+
+        if (nextDirectory == pendingDirectories.size()) {
+            for (const auto& [path, listing] : listings) {
+                estimate.size += listing.size;
+                estimate.fileCount += listing.fileCount;
+                estimate.directoryCount += listing.subdirectories.size();
+            }
+
+            return estimate;
+        }
+
+        SplitMix64 random{ std::hash<std::string>{}(root.string()) };
+
+        const auto probeCount = std::max<std::size_t>(limits.probeCount, 2);
+        const auto probeWeight = 1.0 / static_cast<double>(probeCount);
+
+        std::vector<double> sizeSamples;
+        sizeSamples.reserve(probeCount);
+
+        double fileCount = 0;
+        double directoryCount = 0;
+
+        for (std::size_t probe = 0; probe < probeCount; ++probe) {
+            // Each directory on the path stands in for itself and all of its siblings, as well as
+            // for all of the siblings of its ancestors, and is weighted accordingly.
+            auto path = root;
+            double weight = 1;
+            double size = 0;
+
+            while (true) {
+                const auto& listing = readListing(path);
+                const auto subdirectoryCount = listing.subdirectories.size();
+
+                size += weight * static_cast<double>(listing.size);
+                fileCount += probeWeight * weight * static_cast<double>(listing.fileCount);
+                directoryCount += probeWeight * weight * static_cast<double>(subdirectoryCount);
+
+                if (subdirectoryCount == 0) {
+                    break;
+                }
+
+                path /= listing.subdirectories[random.NextBelow(subdirectoryCount)];
+                weight *= static_cast<double>(subdirectoryCount);
+            }
+
+            sizeSamples.emplace_back(size);
+        }
+
+        double size = 0;
+        for (const auto sample : sizeSamples) {
+            size += probeWeight * sample;
+        }
+
+        estimate.size = ToCount(size);
+        estimate.fileCount = ToCount(fileCount);
+        estimate.directoryCount = ToCount(directoryCount);
+        estimate.confidence = DetermineConfidence(sizeSamples);
+
+        return estimate;
+    }
+} // namespace Scanner
@@ -0,0 +1,188 @@
+#include "Model/Scanner/syntheticFileSystemBackend.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+    // Directories are named after their breadth-first index, files after their position within
+    // their directory.
+    constexpr std::string_view DirectoryPrefix = "dir";
+    constexpr std::string_view FilePrefix = "file";
+
+    constexpr std::array<const char*, 8> Extensions = { ".txt", ".cpp", ".h",   ".png",
+                                                        ".jpg", ".mp4", ".bin", "" };
+
+    // The granularity with which the allocated size of a file is rounded up.
+    constexpr std::uintmax_t BlockSize = 4096;
+
+    /**
+     * @brief Scrambles the bits of the given value, so that consecutive inputs produce unrelated
+     * outputs. This is the finalizer of the SplitMix64 generator.
+     */
+    constexpr std::uint64_t Mix(std::uint64_t value) noexcept
+    {
+        value += 0x9E3779B97F4A7C15;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+        return value ^ (value >> 31);
+    }
+} // namespace
+
+namespace Scanner
+{
+    SyntheticFileSystemBackend::SyntheticFileSystemBackend(
+        SyntheticFileSystemOptions options) noexcept
+        : m_options{ std::move(options) }
+    {
+        const auto entriesPerDirectory = std::uint64_t{ 1 } + m_options.filesPerDirectory;
+
+        if (m_options.subdirectoriesPerDirectory > 0) {
+            const auto directoryCount = m_options.entryCount / entriesPerDirectory;
+            m_directoryCount = std::max<std::uint64_t>(1, directoryCount);
+        }
+
+        m_options.maximumFileSize = std::max<std::uintmax_t>(1, m_options.maximumFileSize);
+    }
+
+    std::uint64_t SyntheticFileSystemBackend::GetDirectoryCount() const noexcept
+    {
+        return m_directoryCount;
+    }
+
+    std::uint64_t SyntheticFileSystemBackend::GetEntryCount() const noexcept
+    {
+        return m_directoryCount * (std::uint64_t{ 1 } + m_options.filesPerDirectory);
+    }
+
+    bool SyntheticFileSystemBackend::IsDirectory(const std::filesystem::path& path) const noexcept
+    {
+        return FindDirectory(path).has_value();
+    }
+
+    bool SyntheticFileSystemBackend::ReadDirectory(
+        const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+        SystemCallTally& tally) const noexcept
+    {
+        const auto index = FindDirectory(path);
+        if (!index) {
+            ++tally.issued;
+            SimulateLatency(1);
+
+            return false;
+        }
+
+        const std::uint64_t fanout = m_options.subdirectoriesPerDirectory;
+        const auto firstChild = *index * fanout + 1;
+        const auto lastChild = std::min(firstChild + fanout, m_directoryCount);
+
+        for (auto child = firstChild; child < lastChild; ++child) {
+            DirectoryEntry entry;
+            entry.name = std::string{ DirectoryPrefix } + std::to_string(child);
+            entry.inode = child + 1;
+            entry.type = FileType::Directory;
+
+            entries.emplace_back(std::move(entry));
+        }
+
+        const std::uint64_t fileCount = m_options.filesPerDirectory;
+
+        for (std::uint64_t file = 0; file < fileCount; ++file) {
+            // Directories take up the first inode numbers, and files take up the rest.
+            const auto inode = m_directoryCount + *index * fileCount + file + 1;
+            const auto hash = Mix(m_options.seed ^ inode);
+
+            FileMetadata metadata;
+            metadata.size = 1 + hash % m_options.maximumFileSize;
+            metadata.allocatedSize = (metadata.size + BlockSize - 1) / BlockSize * BlockSize;
+            metadata.inode = inode;
+
+            DirectoryEntry entry;
+            entry.name = std::string{ FilePrefix } + std::to_string(file) +
+                         Extensions[(hash >> 32) % Extensions.size()];
+            entry.inode = inode;
+            entry.type = FileType::Regular;
+            entry.metadata = metadata;
+
+            entries.emplace_back(std::move(entry));
+        }
+
+        const auto callCount = 1 + fileCount;
+        tally.issued += callCount;
+        SimulateLatency(callCount);
+
+        return true;
+    }
+
+    std::uint64_t
+    SyntheticFileSystemBackend::ComputeChangeStamp(const std::filesystem::path& path) const noexcept
+    {
+        SimulateLatency(1);
+
+        const auto index = FindDirectory(path);
+        if (!index) {
+            return 0;
+        }
+
+        // Nothing ever changes, so the stamps only need to differ from one directory to the next.
+        return Mix(m_options.seed ^ ~*index) | 1;
+    }
+
+    std::optional<std::uint64_t>
+    SyntheticFileSystemBackend::FindDirectory(const std::filesystem::path& path) const
+    {
+        if (path == m_options.root) {
+            return 0;
+        }
+
+        // Since the tree is only ever reached by walking down from the root, the name alone is
+        // enough to identify a directory.
+        const auto name = path.filename().string();
+        if (name.size() <= DirectoryPrefix.size() ||
+            name.compare(0, DirectoryPrefix.size(), DirectoryPrefix) != 0) {
+            return std::nullopt;
+        }
+
+        const auto* const first = name.data() + DirectoryPrefix.size();
+        const auto* const last = name.data() + name.size();
+
+        std::uint64_t index = 0;
+        const auto [end, error] = std::from_chars(first, last, index);
+
+        if (error != std::errc{} || end != last || index == 0 || index >= m_directoryCount) {
+            return std::nullopt;
+        }
+
+        return index;
+    }
+
+    void SyntheticFileSystemBackend::SimulateLatency(std::uintmax_t callCount) const noexcept
+    {
+        if (m_options.latency.count() == 0 && m_options.jitter.count() == 0) {
+            return;
+        }
+
+        thread_local std::mt19937_64 generator{ std::hash<std::thread::id>{}(
+            std::this_thread::get_id()) };
+
+        const auto jitter = m_options.jitter.count();
+        std::uniform_int_distribution<std::chrono::microseconds::rep> distribution{ -jitter,
+                                                                                    jitter };
+
+        // The calls are simulated back-to-back, so a single sleep covers all of them.
+        std::chrono::microseconds delay{ 0 };
+        for (std::uintmax_t call = 0; call < callCount; ++call) {
+            const auto callLatency = m_options.latency.count() + distribution(generator);
+            delay += std::chrono::microseconds{ std::max<decltype(callLatency)>(0, callLatency) };
+        }
+
+        std::this_thread::sleep_for(delay);
+    }
+} // namespace Scanner
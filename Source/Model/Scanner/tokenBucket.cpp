@@ -0,0 +1,58 @@
+#include "Model/Scanner/tokenBucket.h"
+
+#include <algorithm>
+
+namespace
+{
+    /**
+     * @returns The time that it takes to replenish a single token, or zero if there's no limit.
+     */
+    std::int64_t ComputeNanosecondsPerToken(std::uint64_t tokensPerSecond) noexcept
+    {
+        if (tokensPerSecond == 0) {
+            return 0;
+        }
+
+        constexpr std::uint64_t nanosecondsPerSecond = 1'000'000'000;
+        return static_cast<std::int64_t>(
+            std::max<std::uint64_t>(1, nanosecondsPerSecond / tokensPerSecond));
+    }
+} // namespace
+
+namespace Scanner
+{
+    TokenBucket::TokenBucket(std::uint64_t tokensPerSecond, std::uint64_t capacity) noexcept
+        : m_nanosecondsPerToken{ ComputeNanosecondsPerToken(tokensPerSecond) },
+          m_burstNanoseconds{ m_nanosecondsPerToken * static_cast<std::int64_t>(capacity) }
+    {
+    }
+
+    std::chrono::nanoseconds TokenBucket::Consume(
+        std::uint64_t tokenCount, std::chrono::steady_clock::time_point now) noexcept
+    {
+        if (IsUnlimited()) {
+            return std::chrono::nanoseconds{ 0 };
+        }
+
+        const auto currentTime =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+
+        const auto cost = m_nanosecondsPerToken * static_cast<std::int64_t>(tokenCount);
+
+        // A bucket that has been left alone for long enough is full, but never more than full.
+        auto replenishedTime = m_replenishedTime.load();
+        auto updatedTime = std::int64_t{ 0 };
+        do {
+            updatedTime = std::max(replenishedTime, currentTime) + cost;
+        } while (!m_replenishedTime.compare_exchange_weak(replenishedTime, updatedTime));
+
+        // Whatever the full capacity of the bucket can't cover has to be waited out.
+        const auto delay = updatedTime - currentTime - m_burstNanoseconds;
+        return std::chrono::nanoseconds{ std::max<std::int64_t>(delay, 0) };
+    }
+
+    bool TokenBucket::IsUnlimited() const noexcept
+    {
+        return m_nanosecondsPerToken == 0;
+    }
+} // namespace Scanner
@@ -0,0 +1,99 @@
+#include "Model/Scanner/windowsFileSystemBackend.h"
+
+#ifdef Q_OS_WIN
+
+#include "Model/Scanner/scanningUtilities.h"
+
+namespace
+{
+    /**
+     * @brief Detects path elements that will cause infinite looping.
+     *
+     * During testing, I ran across a directory containing files whose path contained either
+     * a single dot (representing the current directory), or two dots (representing the parent
+     * directory). The presense of these path elements caused the scanning logic to loop
+     * indefinitely.
+     *
+     * @param[in] path              The path to test.
+     *
+     * @returns True if a problematic element is detected.
+     */
+    bool ContainsProblematicPathElements(const std::filesystem::path& path) noexcept
+    {
+        for (const auto& entry : path) {
+            const auto& data = entry.native();
+            if (data == L".." || data == L".") {
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace
+
+namespace Scanner
+{
+    bool WindowsFileSystemBackend::IsDirectory(const std::filesystem::path& path) const noexcept
+    {
+        std::error_code errorCode;
+        return std::filesystem::is_directory(path, errorCode);
+    }
+
+    bool WindowsFileSystemBackend::ReadDirectory(
+        const std::filesystem::path& path, std::vector<DirectoryEntry>& entries,
+        SystemCallTally& /*tally*/) const noexcept
+    {
+        // In some edge-cases, the Windows operating system doesn't allow anyone to access certain
+        // directories. One example of a problematic directory in Windows 7 is: "C:\System Volume
+        // Information". Since exceptions are of little use to us here, we'll stick to the
+        // overloads that report errors through an error code.
+        std::error_code iteratorError;
+        auto itr = std::filesystem::directory_iterator{ path, iteratorError };
+        const auto end = std::filesystem::directory_iterator{};
+
+        for (; !iteratorError && itr != end; itr.increment(iteratorError)) {
+            const auto& entry = *itr;
+            if (ContainsProblematicPathElements(entry.path())) {
+                continue;
+            }
+
+            DirectoryEntry directoryEntry;
+            directoryEntry.name = entry.path().filename().string();
+
+            // The directory iterator caches the attributes and size that the OS reports alongside
+            // each entry, so neither of these calls should need to go back to the filesystem.
+            std::error_code entryError;
+
+            if (entry.is_regular_file(entryError)) {
+                auto fileSize = entry.file_size(entryError);
+                if (entryError) {
+                    fileSize = Scanner::ComputeFileSize(entry.path());
+                }
+
+                FileMetadata metadata;
+                metadata.size = fileSize;
+                metadata.allocatedSize = fileSize;
+
+                directoryEntry.type = FileType::Regular;
+                directoryEntry.metadata = metadata;
+            } else if (entry.is_directory(entryError)) {
+                directoryEntry.type = Scanner::IsReparsePoint(entry.path()) ? FileType::Symlink
+                                                                             : FileType::Directory;
+            } else {
+                continue;
+            }
+
+            entries.emplace_back(std::move(directoryEntry));
+        }
+
+        return !iteratorError;
+    }
+
+    std::uint64_t
+    WindowsFileSystemBackend::ComputeChangeStamp(const std::filesystem::path& path) const noexcept
+    {
+        return Scanner::ComputeChangeStamp(path);
+    }
+} // namespace Scanner
+
+#endif // Q_OS_WIN
@@ -1,6 +1,7 @@
 #include "Model/baseModel.h"
 
 #include "Model/Monitor/fileChangeNotification.h"
+#include "Model/Scanner/nameArena.h"
 #include "Model/Scanner/scanningUtilities.h"
 #include "Model/ray.h"
 #include "Utilities/utilities.h"
@@ -18,6 +19,8 @@
 #include <optional>
 #include <regex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <QColor>
 #include <QRectF>
@@ -314,6 +317,75 @@ BaseModel::~BaseModel() noexcept
     StopMonitoringFileSystem();
 }
 
+void BaseModel::Adopt(const std::shared_ptr<Tree<VizBlock>>& theTree)
+{
+    Expects(theTree && theTree->GetRoot());
+
+    m_fileTree = theTree;
+    m_hasDataBeenParsed = true;
+
+    FlattenTree();
+}
+
+void BaseModel::ExpandNode(Tree<VizBlock>::Node& node, const Tree<VizBlock>& subtree)
+{
+    Expects(m_fileTree != nullptr);
+    Expects(node->file.isUnexpanded);
+    Expects(subtree.GetRoot() != nullptr);
+
+    const auto& subtreeRoot = *subtree.GetRoot();
+
+    const auto previousSize = node->file.size;
+    const auto expandedSize = subtreeRoot->file.size;
+
+    // The scanned size already includes the estimate, so passing on the difference keeps the sizes
+    // of the ancestors consistent without having to add up all of their children again.
+    for (auto* ancestor = node.GetParent(); ancestor; ancestor = ancestor->GetParent()) {
+        auto& size = ancestor->GetData().file.size;
+        size = size - previousSize + expandedSize;
+    }
+
+    if (expandedSize == 0) {
+        ClearSelectedNode();
+        ClearHighlightedNodes();
+
+        node.DeleteFromTree();
+    } else {
+        auto& file = node->file;
+        file.size = expandedSize;
+        file.confidence = subtreeRoot->file.confidence;
+        file.changeStamp = subtreeRoot->file.changeStamp;
+        file.isUnexpanded = false;
+
+        // Nodes can't be moved from one tree to another, so the scanned subtree is copied instead.
+        // The names go along with it, since they'd otherwise go away with the scanned subtree.
+        auto& nameArena = *Scanner::GetNameArena(m_fileTree);
+
+        std::vector<std::pair<const Tree<VizBlock>::Node*, Tree<VizBlock>::Node*>> pendingNodes = {
+            { &subtreeRoot, &node }
+        };
+
+        while (!pendingNodes.empty()) {
+            const auto [source, destination] = pendingNodes.back();
+            pendingNodes.pop_back();
+
+            for (const auto* child = source->GetFirstChild(); child;
+                 child = child->GetNextSibling()) {
+                auto childFile = child->GetData().file;
+                childFile.name = nameArena.Store(childFile.name);
+
+                auto* const copy = destination->AppendChild(VizBlock{ childFile });
+
+                if (child->HasChildren()) {
+                    pendingNodes.emplace_back(child, copy);
+                }
+            }
+        }
+    }
+
+    Parse(m_fileTree);
+}
+
 void BaseModel::UpdateBoundingBoxes()
 {
     Expects(m_hasDataBeenParsed == true);
@@ -323,27 +395,28 @@ void BaseModel::UpdateBoundingBoxes()
         return;
     }
 
-    for (auto& node : *m_fileTree) {
-        if (!node.HasChildren()) {
-            node->boundingBox = node->block;
-            continue;
-        }
+    // Since every node comes after its parent, sweeping over the flat tree from back to front
+    // finishes off each bounding box before it's needed by the parent's bounding box.
+    std::vector<double> tallestDescendants(m_flatTree.GetSize(), 0.0);
 
-        auto tallestDescendant = 0.0;
-
-        auto* currentChild = node.GetFirstChild();
-        while (currentChild) {
-            if (currentChild->GetData().boundingBox.GetHeight() > tallestDescendant) {
-                tallestDescendant = currentChild->GetData().boundingBox.GetHeight();
-            }
+    for (auto index = m_flatTree.GetSize(); index-- > 0;) {
+        auto& node = m_flatTree.GetNode(index);
 
-            currentChild = currentChild->GetNextSibling();
+        if (!m_flatTree.HasChildren(index)) {
+            node->boundingBox = node->block;
+        } else {
+            node->boundingBox =
+                Block{ /* origin = */ node->block.GetOrigin(),
+                       /* width = */ node->block.GetWidth(),
+                       /* height = */ node->block.GetHeight() + tallestDescendants[index],
+                       /* depth = */ node->block.GetDepth() };
         }
 
-        node->boundingBox = Block{ /* origin = */ node->block.GetOrigin(),
-                                   /* width = */ node->block.GetWidth(),
-                                   /* height = */ node->block.GetHeight() + tallestDescendant,
-                                   /* depth = */ node->block.GetDepth() };
+        const auto parent = m_flatTree.GetParent(index);
+        if (parent != FlatTree::NoIndex) {
+            tallestDescendants[parent] =
+                std::max(tallestDescendants[parent], node->boundingBox.GetHeight());
+        }
     }
 }
 
@@ -396,6 +469,16 @@ const Tree<VizBlock>& BaseModel::GetTree() const
     return *m_fileTree;
 }
 
+const FlatTree& BaseModel::GetFlatTree() const
+{
+    return m_flatTree;
+}
+
+std::shared_ptr<const Tree<VizBlock>> BaseModel::ShareTree() const
+{
+    return m_fileTree;
+}
+
 const std::vector<const Tree<VizBlock>::Node*>& BaseModel::GetHighlightedNodes() const
 {
     return m_highlightedNodes;
@@ -452,31 +535,51 @@ void BaseModel::HighlightAncestors(const Tree<VizBlock>::Node& node)
 void BaseModel::HighlightDescendants(
     const Tree<VizBlock>::Node& root, const Settings::VisualizationOptions& options)
 {
-    std::for_each(
-        Tree<VizBlock>::LeafIterator{ &root }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) {
-            if ((options.onlyShowDirectories && node->file.type != FileType::Directory) ||
-                node->file.size < options.minimumFileSize) {
-                return;
-            }
+    const auto rootIndex = m_flatTree.IndexOf(root);
+    if (rootIndex == FlatTree::NoIndex) {
+        return;
+    }
 
-            HighlightNode(&node);
-        });
+    const auto& sizes = m_flatTree.GetSizes();
+    const auto& types = m_flatTree.GetTypes();
+
+    // The descendants of the root are exactly the nodes up to the end of its subtree.
+    for (auto index = rootIndex; index < m_flatTree.GetSubtreeEnd(rootIndex); ++index) {
+        if (m_flatTree.HasChildren(index) ||
+            (options.onlyShowDirectories && types[index] != FileType::Directory) ||
+            sizes[index] < options.minimumFileSize) {
+            continue;
+        }
+
+        HighlightNode(&m_flatTree.GetNode(index));
+    }
 }
 
 void BaseModel::HighlightMatchingFileExtensions(
     const std::string& extension, const Settings::VisualizationOptions& options)
 {
-    std::for_each(
-        Tree<VizBlock>::LeafIterator{ GetTree().GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) {
-            if ((options.onlyShowDirectories && node->file.type != FileType::Directory) ||
-                node->file.size < options.minimumFileSize || node->file.extension != extension) {
-                return;
-            }
+    // Interned extensions can be told apart by their identifiers alone, which saves looking up
+    // the extension of every single file. Should the extension not fit in the table, then no file
+    // could have been given that extension either.
+    const auto internedExtension =
+        Scanner::Extension::Intern(extension, *Scanner::GetNameArena(m_fileTree));
+    if (internedExtension.empty() && !extension.empty()) {
+        return;
+    }
 
-            HighlightNode(&node);
-        });
+    const auto& sizes = m_flatTree.GetSizes();
+    const auto& types = m_flatTree.GetTypes();
+    const auto& extensions = m_flatTree.GetExtensions();
+
+    for (FlatTree::Index index = 0; index < m_flatTree.GetSize(); ++index) {
+        if (m_flatTree.HasChildren(index) ||
+            (options.onlyShowDirectories && types[index] != FileType::Directory) ||
+            sizes[index] < options.minimumFileSize || extensions[index] != internedExtension) {
+            continue;
+        }
+
+        HighlightNode(&m_flatTree.GetNode(index));
+    }
 }
 
 void BaseModel::PerformRegexSearch(
@@ -491,20 +594,23 @@ void BaseModel::PerformRegexSearch(
     const auto shouldSearchFiles = flags & SearchFlags::SearchFiles;
     const auto shouldSearchDirectories = flags & SearchFlags::SearchDirectories;
 
-    for (const auto& node : GetTree()) {
-        const auto& file = node->file;
+    const auto& sizes = m_flatTree.GetSizes();
+    const auto& types = m_flatTree.GetTypes();
+    const auto& names = m_flatTree.GetNames();
+    const auto& extensions = m_flatTree.GetExtensions();
 
-        if (file.size < options.minimumFileSize ||
-            (!shouldSearchDirectories && file.type == FileType::Directory) ||
-            (!shouldSearchFiles && file.type == FileType::Regular)) {
+    for (FlatTree::Index index = 0; index < m_flatTree.GetSize(); ++index) {
+        if (sizes[index] < options.minimumFileSize ||
+            (!shouldSearchDirectories && types[index] == FileType::Directory) ||
+            (!shouldSearchFiles && types[index] == FileType::Regular)) {
             continue;
         }
 
-        fileAndExtension = file.name;
-        fileAndExtension.append(file.extension);
+        fileAndExtension = names[index].View();
+        fileAndExtension.append(extensions[index].View());
 
         if (std::regex_match(fileAndExtension, expression)) {
-            HighlightNode(&node);
+            HighlightNode(&m_flatTree.GetNode(index));
         }
     }
 }
@@ -521,24 +627,27 @@ void BaseModel::PerformNormalSearch(
     const auto shouldSearchFiles = flags & SearchFlags::SearchFiles;
     const auto shouldSearchDirectories = flags & SearchFlags::SearchDirectories;
 
-    for (const auto& node : GetTree()) {
-        const auto& file = node->file;
+    const auto& sizes = m_flatTree.GetSizes();
+    const auto& types = m_flatTree.GetTypes();
+    const auto& names = m_flatTree.GetNames();
+    const auto& extensions = m_flatTree.GetExtensions();
 
-        if (file.size < options.minimumFileSize ||
-            (!shouldSearchDirectories && file.type == FileType::Directory) ||
-            (!shouldSearchFiles && file.type == FileType::Regular)) {
+    for (FlatTree::Index index = 0; index < m_flatTree.GetSize(); ++index) {
+        if (sizes[index] < options.minimumFileSize ||
+            (!shouldSearchDirectories && types[index] == FileType::Directory) ||
+            (!shouldSearchFiles && types[index] == FileType::Regular)) {
             continue;
         }
 
-        fileAndExtension = file.name;
-        fileAndExtension.append(file.extension);
+        fileAndExtension = names[index].View();
+        fileAndExtension.append(extensions[index].View());
 
         // We're converting everything to lowercase beforehand (instead of using
         // `boost::icontains(...)`), since doing so is significantly faster.
         boost::algorithm::to_lower(fileAndExtension);
 
         if (boost::contains(fileAndExtension, lowercaseQuery)) {
-            HighlightNode(&node);
+            HighlightNode(&m_flatTree.GetNode(index));
         }
     }
 }
@@ -633,6 +742,23 @@ void BaseModel::RefreshTreemap()
 
     // @todo Sort the tree.
     // @todo Update all sizes.
+
+    if (m_hasDataBeenParsed) {
+        FlattenTree();
+    }
+}
+
+void BaseModel::FlattenTree()
+{
+    Expects(m_fileTree != nullptr);
+
+    const auto stopwatch =
+        Stopwatch<std::chrono::milliseconds>([&] { m_flatTree = FlatTree{ *m_fileTree }; });
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+    log->info(
+        "Flattened tree in: {:L} {}", stopwatch.GetElapsedTime().count(),
+        stopwatch.GetUnitsAsString());
 }
 
 void BaseModel::UpdateAffectedNodes(const FileEvent& event)
@@ -669,7 +795,10 @@ void BaseModel::OnFileCreation(const FileEvent& event)
         return;
     }
 
-    auto fileInfo = FileInfo{ event.path, event.fileSize, FileType::Regular };
+    const auto fileName =
+        Scanner::StoreFileName(event.path.filename().string(), *Scanner::GetNameArena(m_fileTree));
+
+    auto fileInfo = FileInfo{ fileName, event.fileSize, FileType::Regular };
     node->AppendChild(VizBlock{ std::move(fileInfo) });
 }
 
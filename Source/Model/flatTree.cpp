@@ -0,0 +1,59 @@
+#include "Model/flatTree.h"
+
+#include <gsl/assert>
+
+FlatTree::FlatTree(Tree<VizBlock>& tree)
+{
+    auto* const root = tree.GetRoot();
+    if (!root) {
+        return;
+    }
+
+    // The directories whose subtrees are still being flattened, from the root on down.
+    std::vector<Index> openDirectories;
+
+    auto* node = root;
+    while (node) {
+        Expects(m_nodes.size() < NoIndex);
+
+        const auto index = static_cast<Index>(m_nodes.size());
+        const auto& file = node->GetData().file;
+
+        m_parents.emplace_back(openDirectories.empty() ? NoIndex : openDirectories.back());
+        m_subtreeEnds.emplace_back(index + 1);
+        m_sizes.emplace_back(file.size);
+        m_types.emplace_back(file.type);
+        m_names.emplace_back(file.name);
+        m_extensions.emplace_back(file.extension);
+        m_nodes.emplace_back(node);
+
+        node->GetData().indexInFlatTree = index;
+
+        if (node->GetFirstChild()) {
+            openDirectories.emplace_back(index);
+            node = node->GetFirstChild();
+            continue;
+        }
+
+        // Each step back up the tree closes off the subtree of the directory being returned to.
+        while (node != root && !node->GetNextSibling()) {
+            node = node->GetParent();
+
+            m_subtreeEnds[openDirectories.back()] = static_cast<Index>(m_nodes.size());
+            openDirectories.pop_back();
+        }
+
+        node = node == root ? nullptr : node->GetNextSibling();
+    }
+}
+
+FlatTree::Index FlatTree::IndexOf(const Tree<VizBlock>::Node& node) const noexcept
+{
+    // The index recorded in the node may have been left behind by an older flat tree.
+    const auto index = node.GetData().indexInFlatTree;
+    if (index >= m_nodes.size() || m_nodes[index] != &node) {
+        return NoIndex;
+    }
+
+    return index;
+}
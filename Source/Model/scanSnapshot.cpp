@@ -0,0 +1,469 @@
+#include "Model/scanSnapshot.h"
+
+#include "constants.h"
+
+#include <QFile>
+
+#include <boost/crc.hpp>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr std::array<char, 8> Magic = { 'D', '-', 'V', 'i', 'z', 'S', 'c', 'n' };
+
+    // Written in the byte order of the writing machine, so that a reader of the opposite byte order
+    // will see it scrambled.
+    constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+    // Set in the header if the snapshot includes the treemap layout.
+    constexpr std::uint32_t HasLayoutFlag = 1;
+
+    // The bits of a node record's flags. Files written before incomplete nodes were flagged only
+    // ever set the first bit.
+    constexpr std::uint8_t IsUnexpandedFlag = 1;
+    constexpr std::uint8_t IsIncompleteFlag = 2;
+    constexpr std::uint8_t KnownNodeFlags = IsUnexpandedFlag | IsIncompleteFlag;
+
+    struct Header
+    {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrderMark;
+        std::uint32_t flags;
+        std::uint32_t checksum; ///< CRC-32 of everything that follows the header.
+        std::uint64_t extensionCount;
+        std::uint64_t nodeCount;
+        std::uint64_t stringTableSize;
+        std::uint64_t fileCount;
+        std::uint64_t directoryCount;
+        std::uint64_t totalBytes;
+    };
+
+    struct ExtensionRecord
+    {
+        std::uint64_t offset; ///< Offset into the string table.
+        std::uint32_t length;
+        std::uint32_t reserved;
+    };
+
+    struct NodeRecord
+    {
+        std::uint64_t size;
+        std::uint64_t changeStamp;
+        std::uint64_t nameOffset; ///< Offset into the string table.
+        std::uint32_t nameLength;
+        std::uint32_t extensionIndex;
+        std::uint32_t childCount;
+        std::uint8_t type;
+        std::uint8_t isExcluded; ///< Was zero in files written before it was introduced.
+        std::uint8_t uncertainty; ///< The complement of the confidence, so that zero is exact.
+        std::uint8_t flags;
+    };
+
+    struct LayoutRecord
+    {
+        double x;
+        double y;
+        double z;
+        double width;
+        double height;
+        double depth;
+    };
+
+    // The records are copied to and from disk as-is, so their layout must not change silently.
+    static_assert(sizeof(Header) == 72, "Changing the header requires a new format version.");
+    static_assert(sizeof(ExtensionRecord) == 16, "Changing records requires a new format version.");
+    static_assert(sizeof(NodeRecord) == 40, "Changing records requires a new format version.");
+    static_assert(sizeof(LayoutRecord) == 48, "Changing records requires a new format version.");
+
+    static_assert(std::is_trivially_copyable<Header>::value, "Must be trivially copyable.");
+    static_assert(std::is_trivially_copyable<NodeRecord>::value, "Must be trivially copyable.");
+
+    /**
+     * @brief Visits every node in the tree in pre-order, which is the order in which the nodes are
+     * stored in the snapshot. Walking the tree iteratively keeps deep trees from exhausting the
+     * stack.
+     */
+    template <typename VisitorType>
+    void VisitInPreOrder(const Tree<VizBlock>::Node& root, VisitorType&& visitor)
+    {
+        const auto* node = &root;
+
+        while (node) {
+            visitor(*node);
+
+            if (node->GetFirstChild()) {
+                node = node->GetFirstChild();
+                continue;
+            }
+
+            while (node != &root && !node->GetNextSibling()) {
+                node = node->GetParent();
+            }
+
+            node = node == &root ? nullptr : node->GetNextSibling();
+        }
+    }
+
+    /**
+     * @brief Buffers up the snapshot as it's written out, while computing the checksum along the
+     * way.
+     */
+    class SnapshotWriter
+    {
+      public:
+        explicit SnapshotWriter(const std::filesystem::path& path)
+            : m_stream{ path, std::ios::binary | std::ios::trunc }
+        {
+            if (!m_stream) {
+                throw std::runtime_error{ "Could not create \"" + path.string() + "\"." };
+            }
+
+            // Reserve room for the header, which can only be written once the checksum is known.
+            const Header placeholder{};
+            m_stream.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+        }
+
+        template <typename RecordType> void Write(const RecordType& record)
+        {
+            Write(reinterpret_cast<const char*>(&record), sizeof(record));
+        }
+
+        void Write(const char* data, std::size_t size)
+        {
+            m_checksum.process_bytes(data, size);
+            m_stream.write(data, static_cast<std::streamsize>(size));
+        }
+
+        void Finalize(Header& header)
+        {
+            header.checksum = m_checksum.checksum();
+
+            m_stream.seekp(0);
+            m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            m_stream.flush();
+
+            if (!m_stream) {
+                throw std::runtime_error{ "Could not write the snapshot to disk." };
+            }
+        }
+
+      private:
+        std::ofstream m_stream;
+        boost::crc_32_type m_checksum;
+    };
+
+    /**
+     * @brief Copies a record out of the mapped file. Copying, rather than casting, sidesteps any
+     * alignment concerns, and compiles down to little more than a load.
+     */
+    template <typename RecordType> RecordType ReadRecord(const uchar* source) noexcept
+    {
+        RecordType record;
+        std::memcpy(&record, source, sizeof(record));
+
+        return record;
+    }
+
+    void ThrowCorruptionError(const std::filesystem::path& path)
+    {
+        throw std::runtime_error{ "The snapshot at \"" + path.string() + "\" is damaged." };
+    }
+} // namespace
+
+namespace Snapshot
+{
+    void Save(
+        const std::filesystem::path& path, const Tree<VizBlock>& tree,
+        const TreemapMetadata& metadata, bool shouldIncludeLayout)
+    {
+        const auto* const root = tree.GetRoot();
+        if (!root) {
+            throw std::runtime_error{ "There is nothing to save." };
+        }
+
+        // The first pass gathers up the unique extensions, and works out where the names will end
+        // up in the string table, which follows directly after the extensions.
+        std::vector<std::string_view> extensions;
+        std::unordered_map<std::string_view, std::uint32_t> extensionIndices;
+
+        std::uint64_t extensionBytes = 0;
+        std::uint64_t nameBytes = 0;
+        std::uint64_t nodeCount = 0;
+
+        VisitInPreOrder(*root, [&](const Tree<VizBlock>::Node& node) {
+            const auto& file = node->file;
+            const auto [entry, wasInserted] = extensionIndices.emplace(
+                file.extension.View(), static_cast<std::uint32_t>(extensions.size()));
+
+            if (wasInserted) {
+                extensions.emplace_back(file.extension.View());
+                extensionBytes += file.extension.size();
+            }
+
+            nameBytes += file.name.size();
+            ++nodeCount;
+        });
+
+        auto temporaryPath = path;
+        temporaryPath += ".tmp";
+
+        {
+            SnapshotWriter writer{ temporaryPath };
+
+            std::uint64_t offset = 0;
+            for (const auto& extension : extensions) {
+                ExtensionRecord record{};
+                record.offset = offset;
+                record.length = static_cast<std::uint32_t>(extension.size());
+
+                writer.Write(record);
+                offset += extension.size();
+            }
+
+            VisitInPreOrder(*root, [&](const Tree<VizBlock>::Node& node) {
+                const auto& file = node->file;
+
+                NodeRecord record{};
+                record.size = file.size;
+                record.changeStamp = file.changeStamp;
+                record.nameOffset = offset;
+                record.nameLength = static_cast<std::uint32_t>(file.name.size());
+                record.extensionIndex = extensionIndices[file.extension.View()];
+                record.childCount = static_cast<std::uint32_t>(node.GetChildCount());
+                record.type = static_cast<std::uint8_t>(file.type);
+                record.isExcluded = file.isExcluded ? 1 : 0;
+                record.uncertainty = static_cast<std::uint8_t>(100 - file.confidence);
+                record.flags = (file.isUnexpanded ? IsUnexpandedFlag : 0) |
+                               (file.isIncomplete ? IsIncompleteFlag : 0);
+
+                writer.Write(record);
+                offset += file.name.size();
+            });
+
+            if (shouldIncludeLayout) {
+                VisitInPreOrder(*root, [&](const Tree<VizBlock>::Node& node) {
+                    const auto& block = node->block;
+                    const auto origin = block.GetOrigin();
+
+                    const LayoutRecord record{ origin.x(),        origin.y(),
+                                               origin.z(),        block.GetWidth(),
+                                               block.GetHeight(), block.GetDepth() };
+
+                    writer.Write(record);
+                });
+            }
+
+            for (const auto& extension : extensions) {
+                writer.Write(extension.data(), extension.size());
+            }
+
+            VisitInPreOrder(*root, [&](const Tree<VizBlock>::Node& node) {
+                const auto name = node->file.name.View();
+                writer.Write(name.data(), name.size());
+            });
+
+            Header header{};
+            header.magic = Magic;
+            header.version = FormatVersion;
+            header.byteOrderMark = ByteOrderMark;
+            header.flags = shouldIncludeLayout ? HasLayoutFlag : 0;
+            header.extensionCount = extensions.size();
+            header.nodeCount = nodeCount;
+            header.stringTableSize = extensionBytes + nameBytes;
+            header.fileCount = metadata.FileCount;
+            header.directoryCount = metadata.DirectoryCount;
+            header.totalBytes = metadata.TotalBytes;
+
+            writer.Finalize(header);
+        }
+
+        std::error_code errorCode;
+        std::filesystem::rename(temporaryPath, path, errorCode);
+
+        if (errorCode) {
+            std::filesystem::remove(temporaryPath, errorCode);
+            throw std::runtime_error{ "Could not save the snapshot to \"" + path.string() + "\"." };
+        }
+
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+        log->info("Saved a snapshot of {:L} nodes to \"{}\".", nodeCount, path.string());
+    }
+
+    Contents Load(const std::filesystem::path& path)
+    {
+        QFile file{ QString::fromStdWString(path.wstring()) };
+        if (!file.open(QIODevice::ReadOnly)) {
+            throw std::runtime_error{ "Could not open \"" + path.string() + "\"." };
+        }
+
+        const auto fileSize = static_cast<std::uint64_t>(file.size());
+        if (fileSize < sizeof(Header)) {
+            ThrowCorruptionError(path);
+        }
+
+        // The mapping is released as soon as the file is closed, which happens when the file goes
+        // out of scope; by then, the tree will have been rebuilt.
+        const auto* const data = file.map(0, file.size());
+        if (!data) {
+            throw std::runtime_error{ "Could not map \"" + path.string() + "\" into memory." };
+        }
+
+        const auto header = ReadRecord<Header>(data);
+
+        if (header.magic != Magic) {
+            throw std::runtime_error{ "\"" + path.string() + "\" is not a D-Viz snapshot." };
+        }
+
+        if (header.byteOrderMark != ByteOrderMark) {
+            throw std::runtime_error{ "The snapshot was saved on an incompatible machine." };
+        }
+
+        if (header.version != FormatVersion) {
+            throw std::runtime_error{ "The snapshot was saved by an incompatible version of D-Viz "
+                                      "(format version " +
+                                      std::to_string(header.version) + ")." };
+        }
+
+        const auto hasLayout = (header.flags & HasLayoutFlag) != 0;
+
+        // Bound the counts by the file size first, so that the section sizes can't overflow.
+        if (header.extensionCount > fileSize || header.nodeCount > fileSize ||
+            header.stringTableSize > fileSize || header.nodeCount == 0) {
+            ThrowCorruptionError(path);
+        }
+
+        const auto extensionOffset = sizeof(Header);
+        const auto nodeOffset = extensionOffset + header.extensionCount * sizeof(ExtensionRecord);
+        const auto layoutOffset = nodeOffset + header.nodeCount * sizeof(NodeRecord);
+        const auto stringOffset =
+            layoutOffset + (hasLayout ? header.nodeCount * sizeof(LayoutRecord) : 0);
+
+        if (stringOffset + header.stringTableSize != fileSize) {
+            ThrowCorruptionError(path);
+        }
+
+        boost::crc_32_type checksum;
+        checksum.process_bytes(data + sizeof(Header), fileSize - sizeof(Header));
+
+        if (checksum.checksum() != header.checksum) {
+            ThrowCorruptionError(path);
+        }
+
+        const auto* const strings = reinterpret_cast<const char*>(data + stringOffset);
+
+        std::vector<std::string_view> extensions;
+        extensions.reserve(header.extensionCount);
+
+        for (std::uint64_t index = 0; index < header.extensionCount; ++index) {
+            const auto record = ReadRecord<ExtensionRecord>(
+                data + extensionOffset + index * sizeof(ExtensionRecord));
+
+            if (record.offset + record.length > header.stringTableSize) {
+                ThrowCorruptionError(path);
+            }
+
+            extensions.emplace_back(strings + record.offset, record.length);
+        }
+
+        // The snapshot's string table is only mapped for as long as it's being read, so the names
+        // are copied into an arena that the new tree holds on to.
+        const auto nameArena = std::make_shared<Scanner::NameArena>();
+
+        const auto readNode = [&](std::uint64_t index) {
+            const auto record =
+                ReadRecord<NodeRecord>(data + nodeOffset + index * sizeof(NodeRecord));
+
+            if (record.nameOffset + record.nameLength > header.stringTableSize ||
+                record.extensionIndex >= extensions.size() ||
+                record.type > static_cast<std::uint8_t>(FileType::Symlink) ||
+                record.uncertainty > 100 || (record.flags & ~KnownNodeFlags) != 0) {
+                ThrowCorruptionError(path);
+            }
+
+            const auto fileName = Scanner::StoreFileName(
+                std::string_view{ strings + record.nameOffset, record.nameLength },
+                extensions[record.extensionIndex], *nameArena);
+
+            VizBlock node{ FileInfo{ fileName, record.size, static_cast<FileType>(record.type) } };
+
+            // Restoring the stamps allows a reopened snapshot to serve as the basis of an
+            // incremental rescan.
+            node.file.changeStamp = record.changeStamp;
+            node.file.isExcluded = record.isExcluded != 0;
+            node.file.confidence = static_cast<std::uint8_t>(100 - record.uncertainty);
+            node.file.isUnexpanded = (record.flags & IsUnexpandedFlag) != 0;
+            node.file.isIncomplete = (record.flags & IsIncompleteFlag) != 0;
+
+            if (hasLayout) {
+                const auto layout = ReadRecord<LayoutRecord>(
+                    data + layoutOffset + index * sizeof(LayoutRecord));
+
+                node.block = Block{ PrecisePoint{ layout.x, layout.y, layout.z }, layout.width,
+                                    layout.height, layout.depth };
+            }
+
+            return std::make_pair(std::move(node), record.childCount);
+        };
+
+        struct PendingParent
+        {
+            Tree<VizBlock>::Node* node;
+            std::uint32_t remainingChildren;
+        };
+
+        auto [rootBlock, rootChildCount] = readNode(0);
+        auto tree = Scanner::CreateTree(std::move(rootBlock), nameArena);
+
+        std::vector<PendingParent> ancestors;
+        if (rootChildCount > 0) {
+            ancestors.push_back(PendingParent{ tree->GetRoot(), rootChildCount });
+        }
+
+        // Since the nodes are stored in pre-order, every node is a child of the nearest ancestor
+        // that is still waiting on children.
+        for (std::uint64_t index = 1; index < header.nodeCount; ++index) {
+            if (ancestors.empty()) {
+                ThrowCorruptionError(path);
+            }
+
+            auto& parent = ancestors.back();
+            auto [block, childCount] = readNode(index);
+
+            auto* const node = parent.node->AppendChild(std::move(block));
+
+            if (--parent.remainingChildren == 0) {
+                ancestors.pop_back();
+            }
+
+            if (childCount > 0) {
+                ancestors.push_back(PendingParent{ node, childCount });
+            }
+        }
+
+        if (!ancestors.empty()) {
+            ThrowCorruptionError(path);
+        }
+
+        Contents contents;
+        contents.tree = std::move(tree);
+        contents.metadata =
+            TreemapMetadata{ header.fileCount, header.directoryCount, header.totalBytes };
+        contents.hasLayout = hasLayout;
+
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+        log->info("Loaded a snapshot of {:L} nodes from \"{}\".", header.nodeCount, path.string());
+
+        return contents;
+    }
+} // namespace Snapshot
@@ -0,0 +1,154 @@
+#include "Model/scanSummary.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    using Node = Tree<VizBlock>::Node;
+
+    /**
+     * @returns The complete path to the given node, given that the root holds the path from which
+     * the scan started.
+     */
+    std::filesystem::path ResolvePath(const Node& node)
+    {
+        std::vector<const Node*> lineage;
+        for (const auto* current = &node; current; current = current->GetParent()) {
+            lineage.emplace_back(current);
+        }
+
+        std::filesystem::path path;
+        for (auto entry = std::rbegin(lineage); entry != std::rend(lineage); ++entry) {
+            const auto& file = (*entry)->GetData().file;
+            path /= file.GetFullName();
+        }
+
+        return path;
+    }
+
+    /**
+     * @brief Keeps track of the largest nodes seen so far, without holding on to any more than
+     * the requested number of them.
+     */
+    class Ranking
+    {
+      public:
+        explicit Ranking(std::size_t limit) noexcept : m_limit{ limit }
+        {
+        }
+
+        void Consider(const Node& node)
+        {
+            if (m_limit == 0) {
+                return;
+            }
+
+            const auto size = node->file.size;
+
+            if (m_candidates.size() < m_limit) {
+                m_candidates.emplace(size, &node);
+            } else if (size > m_candidates.top().first) {
+                m_candidates.pop();
+                m_candidates.emplace(size, &node);
+            }
+        }
+
+        /**
+         * @returns The ranked nodes, from largest to smallest, with their paths resolved. Ties are
+         * broken by path, so that the results don't depend on the order of the scan.
+         */
+        std::vector<Summary::RankedEntry> Resolve()
+        {
+            std::vector<Summary::RankedEntry> entries;
+            entries.reserve(m_candidates.size());
+
+            while (!m_candidates.empty()) {
+                const auto& [size, node] = m_candidates.top();
+                entries.push_back({ ResolvePath(*node), size, node->GetData().file.confidence });
+                m_candidates.pop();
+            }
+
+            std::sort(
+                std::begin(entries), std::end(entries), [](const auto& lhs, const auto& rhs) {
+                    return lhs.size != rhs.size ? lhs.size > rhs.size : lhs.path < rhs.path;
+                });
+
+            return entries;
+        }
+
+      private:
+        using Candidate = std::pair<std::uintmax_t, const Node*>;
+
+        std::size_t m_limit;
+
+        // A min-heap, so that the smallest of the current candidates is the first to be evicted.
+        std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> m_candidates;
+    };
+} // namespace
+
+namespace Summary
+{
+    Report Summarize(const Tree<VizBlock>& tree, std::size_t entryLimit)
+    {
+        Report report;
+
+        const auto* const root = tree.GetRoot();
+        if (!root) {
+            return report;
+        }
+
+        report.root = root->GetData().file.name.View();
+        report.totalSize = root->GetData().file.size;
+        report.isComplete = !root->GetData().file.isIncomplete;
+
+        Ranking directories{ entryLimit };
+        Ranking files{ entryLimit };
+
+        // Interned extensions stay put for as long as the process runs, so they make for stable
+        // keys.
+        std::unordered_map<std::string_view, ExtensionTally> extensions;
+
+        for (const auto& node : tree) {
+            const auto& file = node->file;
+
+            if (file.type == FileType::Directory) {
+                if (&node != root) {
+                    ++report.directoryCount;
+                    directories.Consider(node);
+                }
+
+                continue;
+            }
+
+            ++report.fileCount;
+            files.Consider(node);
+
+            auto& tally = extensions[file.extension.View()];
+            tally.totalSize += file.size;
+            tally.fileCount += 1;
+        }
+
+        report.largestDirectories = directories.Resolve();
+        report.largestFiles = files.Resolve();
+
+        report.extensions.reserve(extensions.size());
+        for (auto& [extension, tally] : extensions) {
+            tally.extension = extension;
+            report.extensions.emplace_back(std::move(tally));
+        }
+
+        std::sort(
+            std::begin(report.extensions), std::end(report.extensions),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.totalSize != rhs.totalSize ? lhs.totalSize > rhs.totalSize
+                                                      : lhs.extension < rhs.extension;
+            });
+
+        return report;
+    }
+} // namespace Summary
@@ -416,4 +416,6 @@ void SquarifiedTreeMap::Parse(const std::shared_ptr<Tree<VizBlock>>& theTree)
         squarificationStopwatch.GetUnitsAsString());
 
     m_hasDataBeenParsed = true;
+
+    FlattenTree();
 }
@@ -199,6 +199,158 @@ namespace Settings
             m_preferencesDocument, Constants::Preferences::UseDarkMode, defaultValue);
     }
 
+    void PersistentSettings::UseAsynchronousScanning(bool isEnabled)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::UseAsynchronousScanning, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldUseAsynchronousScanning() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::UseAsynchronousScanning, defaultValue);
+    }
+
+    int PersistentSettings::GetScanningThreadLimit() const
+    {
+        constexpr auto defaultValue = 0;
+        const auto limit = GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::ScanningThreadLimit, defaultValue);
+
+        return std::clamp(limit, 0, static_cast<int>(Constants::Concurrency::MaximumThreadCount));
+    }
+
+    void PersistentSettings::SetScanningThreadLimit(int limit)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::ScanningThreadLimit,
+            std::clamp(limit, 0, static_cast<int>(Constants::Concurrency::MaximumThreadCount)));
+    }
+
+    void PersistentSettings::CountHardLinksOnce(bool isEnabled)
+    {
+        SaveValue(m_preferencesDocument, Constants::Preferences::CountHardLinksOnce, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldCountHardLinksOnce() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::CountHardLinksOnce, defaultValue);
+    }
+
+    void PersistentSettings::UseAllocatedFileSizes(bool isEnabled)
+    {
+        SaveValue(m_preferencesDocument, Constants::Preferences::UseAllocatedFileSizes, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldUseAllocatedFileSizes() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::UseAllocatedFileSizes, defaultValue);
+    }
+
+    void PersistentSettings::StayOnFilesystem(bool isEnabled)
+    {
+        SaveValue(m_preferencesDocument, Constants::Preferences::StayOnFilesystem, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldStayOnFilesystem() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::StayOnFilesystem, defaultValue);
+    }
+
+    void PersistentSettings::StatInInodeOrder(bool isEnabled)
+    {
+        SaveValue(m_preferencesDocument, Constants::Preferences::StatInInodeOrder, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldStatInInodeOrder() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::StatInInodeOrder, defaultValue);
+    }
+
+    int PersistentSettings::GetPartialResultsInterval() const
+    {
+        constexpr auto defaultValue = Constants::Concurrency::DefaultPartialResultsInterval;
+        const auto interval = GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::PartialResultsInterval, defaultValue);
+
+        return std::clamp(interval, 0, Constants::Concurrency::MaximumPartialResultsInterval);
+    }
+
+    void PersistentSettings::SetPartialResultsInterval(int interval)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::PartialResultsInterval,
+            std::clamp(interval, 0, Constants::Concurrency::MaximumPartialResultsInterval));
+    }
+
+    int PersistentSettings::GetScanningEntryBudget() const
+    {
+        constexpr auto defaultValue = 0;
+        const auto budget = GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::ScanningEntryBudget, defaultValue);
+
+        return std::max(budget, 0);
+    }
+
+    void PersistentSettings::SetScanningEntryBudget(int budget)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::ScanningEntryBudget,
+            std::max(budget, 0));
+    }
+
+    void PersistentSettings::ScanInBackground(bool isEnabled)
+    {
+        SaveValue(m_preferencesDocument, Constants::Preferences::ScanInBackground, isEnabled);
+    }
+
+    bool PersistentSettings::ShouldScanInBackground() const
+    {
+        constexpr auto defaultValue = false;
+        return GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::ScanInBackground, defaultValue);
+    }
+
+    int PersistentSettings::GetScanOperationLimit() const
+    {
+        constexpr auto defaultValue = 0;
+        const auto limit = GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::ScanOperationLimit, defaultValue);
+
+        return std::max(limit, 0);
+    }
+
+    void PersistentSettings::SetScanOperationLimit(int limit)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::ScanOperationLimit, std::max(limit, 0));
+    }
+
+    int PersistentSettings::GetCheckpointInterval() const
+    {
+        constexpr auto defaultValue = Constants::Concurrency::DefaultCheckpointInterval;
+        const auto interval = GetValueOrDefault(
+            m_preferencesDocument, Constants::Preferences::CheckpointInterval, defaultValue);
+
+        return std::clamp(interval, 0, Constants::Concurrency::MaximumCheckpointInterval);
+    }
+
+    void PersistentSettings::SetCheckpointInterval(int interval)
+    {
+        SaveValue(
+            m_preferencesDocument, Constants::Preferences::CheckpointInterval,
+            std::clamp(interval, 0, Constants::Concurrency::MaximumCheckpointInterval));
+    }
+
     bool PersistentSettings::SaveAllPreferencesToDisk()
     {
         return SaveToDisk(m_preferencesDocument, m_preferencesPath);
@@ -226,6 +378,21 @@ namespace Settings
         document.AddMember(Constants::Preferences::ShowDebuggingMenu, false, allocator);
         document.AddMember(Constants::Preferences::MonitorFileSystem, false, allocator);
         document.AddMember(Constants::Preferences::UseDarkMode, false, allocator);
+        document.AddMember(Constants::Preferences::UseAsynchronousScanning, false, allocator);
+        document.AddMember(Constants::Preferences::ScanningThreadLimit, 0, allocator);
+        document.AddMember(Constants::Preferences::CountHardLinksOnce, false, allocator);
+        document.AddMember(Constants::Preferences::UseAllocatedFileSizes, false, allocator);
+        document.AddMember(Constants::Preferences::StayOnFilesystem, false, allocator);
+        document.AddMember(Constants::Preferences::StatInInodeOrder, false, allocator);
+        document.AddMember(
+            Constants::Preferences::PartialResultsInterval,
+            Constants::Concurrency::DefaultPartialResultsInterval, allocator);
+        document.AddMember(Constants::Preferences::ScanningEntryBudget, 0, allocator);
+        document.AddMember(Constants::Preferences::ScanInBackground, false, allocator);
+        document.AddMember(Constants::Preferences::ScanOperationLimit, 0, allocator);
+        document.AddMember(
+            Constants::Preferences::CheckpointInterval,
+            Constants::Concurrency::DefaultCheckpointInterval, allocator);
 
         SaveToDisk(document, m_preferencesPath);
 
@@ -67,27 +67,34 @@ void BreakdownDialog::BuildModel()
     m_graphModel.ClearData();
 
     const auto& controller = m_mainWindow.GetController();
-    const auto& tree = controller.GetTree();
+    const auto& flatTree = controller.GetFlatTree();
 
-    if (tree.GetRoot()->GetChildCount() == 0) {
+    // Unless the root has children, there's nothing to break down.
+    if (flatTree.GetSize() <= 1) {
         return;
     }
 
     const auto& options = controller.GetSessionSettings().GetVisualizationOptions();
 
-    std::for_each(
-        Tree<VizBlock>::LeafIterator{ tree.GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) {
-            if (node->file.type == FileType::Regular) {
-                m_tableModel.Insert(node, options.IsNodeVisible(node.GetData()));
-
-                if (node->file.extension.empty()) {
-                    m_graphModel.AddDatapoint("No Extension", node->file.size);
-                } else {
-                    m_graphModel.AddDatapoint(node->file.extension, node->file.size);
-                }
-            }
-        });
+    const auto& sizes = flatTree.GetSizes();
+    const auto& types = flatTree.GetTypes();
+    const auto& extensions = flatTree.GetExtensions();
+
+    // Regular files never have children, so there's no need to check for leaves separately.
+    for (FlatTree::Index index = 0; index < flatTree.GetSize(); ++index) {
+        if (types[index] != FileType::Regular) {
+            continue;
+        }
+
+        const auto& node = flatTree.GetNode(index);
+        m_tableModel.Insert(node, options.IsNodeVisible(node.GetData()));
+
+        if (extensions[index].empty()) {
+            m_graphModel.AddDatapoint("No Extension", sizes[index]);
+        } else {
+            m_graphModel.AddDatapoint(extensions[index].ToString(), sizes[index]);
+        }
+    }
 
     m_tableModel.BuildModel(controller.GetSessionSettings().GetActiveNumericPrefix());
     m_graphModel.BuildModel();
@@ -97,7 +97,8 @@ void ScanBreakdownModel::Insert(const Tree<VizBlock>::Node& node, bool isVisible
         return;
     }
 
-    const auto key = file.extension.empty() ? std::string{ "No Extension" } : file.extension;
+    const auto key =
+        file.extension.empty() ? std::string{ "No Extension" } : file.extension.ToString();
     auto& entry = m_fileTypeMap[key];
 
     entry.visibleSize += isVisible ? file.size : 0;
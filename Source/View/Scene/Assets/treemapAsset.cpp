@@ -452,7 +452,7 @@ namespace Assets
             ComputeAppropriateBlockColor(node);
         }
 
-        FindLargestDirectory(tree);
+        FindLargestDirectory(m_controller.GetFlatTree());
 
         Expects(m_blockColors.size() == m_blockTransformations.size());
         Expects(m_blockColors.size() == static_cast<int>(m_blockCount));
@@ -473,18 +473,16 @@ namespace Assets
         }
     }
 
-    void Treemap::FindLargestDirectory(const Tree<VizBlock>& tree)
+    void Treemap::FindLargestDirectory(const FlatTree& tree)
     {
         std::uintmax_t largestDirectory = std::numeric_limits<std::uintmax_t>::min();
 
-        for (auto& node : tree) {
-            if (node.GetData().file.type != FileType::Directory) {
-                continue;
-            }
+        const auto& sizes = tree.GetSizes();
+        const auto& types = tree.GetTypes();
 
-            const auto directorySize = node.GetData().file.size;
-            if (directorySize > largestDirectory) {
-                largestDirectory = directorySize;
+        for (FlatTree::Index index = 0; index < tree.GetSize(); ++index) {
+            if (types[index] == FileType::Directory && sizes[index] > largestDirectory) {
+                largestDirectory = sizes[index];
             }
         }
 
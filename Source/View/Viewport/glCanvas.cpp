@@ -79,7 +79,7 @@ namespace
     {
         const auto extension = node.GetData().file.extension.empty()
                                    ? "Extensionless"
-                                   : "\"" + node.GetData().file.extension + "\"";
+                                   : "\"" + node.GetData().file.extension.ToString() + "\"";
 
         return QString::fromStdString("Highlight All " + extension + " Files");
     }
@@ -308,6 +308,29 @@ void GLCanvas::mousePressEvent(QMouseEvent* const event)
     event->accept();
 }
 
+void GLCanvas::mouseDoubleClickEvent(QMouseEvent* const event)
+{
+    Expects(event);
+
+    // The first of the two clicks will already have selected the node under the cursor.
+    const auto* const selectedNode =
+        m_controller.HasModelBeenLoaded() ? m_controller.GetSelectedNode() : nullptr;
+
+    const auto shouldExpandNode = event->button() == Qt::RightButton &&
+                                  !m_keyboardManager.IsKeyDown(Qt::Key_Control) && selectedNode &&
+                                  selectedNode->GetData().file.isUnexpanded;
+
+    if (!shouldExpandNode) {
+        // Just like Qt's default implementation, treat the second click as an ordinary click.
+        mousePressEvent(event);
+        return;
+    }
+
+    m_controller.ExpandNode(*selectedNode);
+
+    event->accept();
+}
+
 void GLCanvas::mouseReleaseEvent(QMouseEvent* const event)
 {
     Expects(event);
@@ -530,6 +553,10 @@ template <typename MenuType> void GLCanvas::PopulateContextMenu(MenuType& menu)
         m_controller.HighlightDescendants(*selection, highlightCallback);
     });
 
+    if (selection->GetData().file.isUnexpanded) {
+        menu.addAction("Expand Directory", [=] { m_controller.ExpandNode(*selection); });
+    }
+
     const auto fileType = selection->GetData().file.type;
     if (fileType == FileType::Regular) {
         const auto message = GetHighlightExtensionLabel(*selection);
@@ -537,7 +564,7 @@ template <typename MenuType> void GLCanvas::PopulateContextMenu(MenuType& menu)
             m_controller.ClearHighlightedNodes(unhighlightCallback);
 
             m_controller.HighlightAllMatchingExtensions(
-                selection->GetData().file.extension, highlightCallback);
+                selection->GetData().file.extension.ToString(), highlightCallback);
 
             m_controller.SelectNode(*selection, selectionCallback);
         });
@@ -1,4 +1,5 @@
 #include "View/mainWindow.h"
+#include "Model/scanSnapshot.h"
 #include "Settings/persistentSettings.h"
 #include "Utilities/logging.h"
 #include "Utilities/operatingSystem.h"
@@ -309,12 +310,34 @@ void MainWindow::SetupFileMenu()
 
     connect(&m_fileMenu.newScan, &QAction::triggered, this, &MainWindow::OnFileMenuNewScan);
 
+    m_fileMenu.rescan.setText("Rescan");
+    m_fileMenu.rescan.setStatusTip("Scan the current directory again, reading only what changed.");
+    m_fileMenu.rescan.setShortcuts(QKeySequence::Refresh);
+    m_fileMenu.rescan.setEnabled(false);
+
+    connect(&m_fileMenu.rescan, &QAction::triggered, this, &MainWindow::OnFileMenuRescan);
+
     m_fileMenu.cancelScan.setText("Cancel Scan");
     m_fileMenu.cancelScan.setStatusTip("Cancel active scan.");
     m_fileMenu.cancelScan.setEnabled(false);
 
     connect(&m_fileMenu.cancelScan, &QAction::triggered, this, &MainWindow::OnCancelScan);
 
+    m_fileMenu.openSnapshot.setText("Open Snapshot...");
+    m_fileMenu.openSnapshot.setStatusTip("Reopen a previously saved scan.");
+    m_fileMenu.openSnapshot.setShortcuts(QKeySequence::Open);
+
+    connect(
+        &m_fileMenu.openSnapshot, &QAction::triggered, this, &MainWindow::OnFileMenuOpenSnapshot);
+
+    m_fileMenu.saveSnapshot.setText("Save Snapshot...");
+    m_fileMenu.saveSnapshot.setStatusTip("Save the current scan, so that it can be reopened.");
+    m_fileMenu.saveSnapshot.setShortcuts(QKeySequence::Save);
+    m_fileMenu.saveSnapshot.setEnabled(false);
+
+    connect(
+        &m_fileMenu.saveSnapshot, &QAction::triggered, this, &MainWindow::OnFileMenuSaveSnapshot);
+
     m_fileMenu.exit.setText("Exit");
     m_fileMenu.exit.setStatusTip("Exit the program.");
     m_fileMenu.exit.setShortcuts(QKeySequence::Quit);
@@ -323,7 +346,12 @@ void MainWindow::SetupFileMenu()
 
     m_fileMenu.setTitle("File");
     m_fileMenu.addAction(&m_fileMenu.newScan);
+    m_fileMenu.addAction(&m_fileMenu.rescan);
     m_fileMenu.addAction(&m_fileMenu.cancelScan);
+    m_fileMenu.addSeparator();
+    m_fileMenu.addAction(&m_fileMenu.openSnapshot);
+    m_fileMenu.addAction(&m_fileMenu.saveSnapshot);
+    m_fileMenu.addSeparator();
     m_fileMenu.addAction(&m_fileMenu.exit);
 
     menuBar()->addMenu(&m_fileMenu);
@@ -595,6 +623,51 @@ void MainWindow::OnFileMenuNewScan()
     m_controller.ScanDrive(savedOptions);
 }
 
+void MainWindow::OnFileMenuRescan()
+{
+    m_controller.RescanDrive();
+}
+
+void MainWindow::OnFileMenuOpenSnapshot()
+{
+    const auto locationList = QStandardPaths::standardLocations(QStandardPaths::DocumentsLocation);
+
+    const auto selectedFile = QFileDialog::getOpenFileName(
+        this, "Select a Snapshot to Open", locationList.front(), "D-Viz Snapshots (*.dviz)");
+
+    if (selectedFile.isEmpty()) {
+        return;
+    }
+
+    const auto fileSizeIndex = static_cast<std::size_t>(m_ui.minimumSizeComboBox->currentIndex());
+
+    Settings::VisualizationOptions options;
+    options.onlyShowDirectories = m_showDirectoriesOnly;
+    options.minimumFileSize = m_fileSizeOptions->at(fileSizeIndex).first;
+
+    m_controller.GetSessionSettings().SetVisualizationOptions(std::move(options));
+    m_controller.LoadSnapshot(selectedFile.toStdWString());
+}
+
+void MainWindow::OnFileMenuSaveSnapshot()
+{
+    const auto locationList = QStandardPaths::standardLocations(QStandardPaths::DocumentsLocation);
+
+    const auto selectedFile = QFileDialog::getSaveFileName(
+        this, "Save Snapshot As", locationList.front(), "D-Viz Snapshots (*.dviz)");
+
+    if (selectedFile.isEmpty()) {
+        return;
+    }
+
+    std::filesystem::path snapshotPath = selectedFile.toStdWString();
+    if (snapshotPath.extension().empty()) {
+        snapshotPath.replace_extension(Snapshot::FileExtension);
+    }
+
+    m_controller.SaveSnapshot(snapshotPath);
+}
+
 bool MainWindow::AskUserToLimitFileSize(std::uintmax_t numberOfFilesScanned)
 {
     using namespace Literals::Numeric::Binary;
@@ -893,7 +966,10 @@ Gamepad& MainWindow::GetGamepad()
 void MainWindow::OnScanStarted()
 {
     m_ui.showBreakdownButton->setEnabled(false);
+    m_fileMenu.rescan.setEnabled(false);
     m_fileMenu.cancelScan.setEnabled(true);
+    m_fileMenu.openSnapshot.setEnabled(false);
+    m_fileMenu.saveSnapshot.setEnabled(false);
 }
 
 void MainWindow::OnScanCompleted()
@@ -901,7 +977,10 @@ void MainWindow::OnScanCompleted()
     ReloadVisualization();
 
     m_ui.showBreakdownButton->setEnabled(true);
+    m_fileMenu.rescan.setEnabled(true);
     m_fileMenu.cancelScan.setEnabled(false);
+    m_fileMenu.openSnapshot.setEnabled(true);
+    m_fileMenu.saveSnapshot.setEnabled(true);
     m_optionsMenu.enableFileSystemMonitoring.setEnabled(true);
 }
 
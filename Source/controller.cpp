@@ -2,10 +2,13 @@
 
 #include "Factories/modelFactory.h"
 #include "Factories/viewFactory.h"
+#include "Model/Scanner/checkpointJournal.h"
+#include "Model/scanSnapshot.h"
 #include "Settings/persistentSettings.h"
 #include "Utilities/ignoreUnused.h"
 #include "Utilities/operatingSystem.h"
 #include "Utilities/scopeExit.h"
+#include "Utilities/utilities.h"
 #include "constants.h"
 
 #include <gsl/assert>
@@ -25,8 +28,31 @@ namespace
 
         log->info(
             "Scanned {:L} directories and {:L} files, representing {:L} bytes.",
-            progress.directoriesScanned.load(), progress.filesScanned.load(),
-            progress.bytesProcessed.load());
+            progress.directoriesScanned.Load(), progress.filesScanned.Load(),
+            progress.bytesProcessed.Load());
+
+        if (progress.syscallsIssued.Load() > 0) {
+            log->info(
+                "Issued {:L} filesystem calls, saving an estimated {:L} calls.",
+                progress.syscallsIssued.Load(), progress.syscallsAvoided.Load());
+        }
+
+        if (progress.throttledNanoseconds.Load() > 0) {
+            using Seconds = std::chrono::duration<double>;
+            const auto throttledTime =
+                std::chrono::nanoseconds{ progress.throttledNanoseconds.Load() };
+
+            log->info(
+                "Held back for {:.2f} seconds by the operation limit, against {:.2f} seconds of "
+                "active scanning, summed across threads.",
+                Seconds{ throttledTime }.count(), Seconds{ progress.GetActiveTime() }.count());
+        }
+
+        if (progress.duplicateHardLinksSkipped.Load() > 0) {
+            log->info(
+                "Skipped {:L} additional links to files that were already counted.",
+                progress.duplicateHardLinksSkipped.Load());
+        }
 
         log->flush();
     }
@@ -64,7 +90,7 @@ void Controller::OnScanComplete(
 
     m_nodeColorMap.clear();
 
-    m_view->AskUserToLimitFileSize(progress.filesScanned.load());
+    m_view->AskUserToLimitFileSize(progress.filesScanned.Load());
     m_view->SetWaitCursor();
 
     const ScopeExit restoreCursor = [&]() noexcept
@@ -77,6 +103,11 @@ void Controller::OnScanComplete(
 
     SaveScanMetadata(progress);
 
+    if (scanningResults->GetRoot()->GetData().file.isIncomplete) {
+        const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+        log->info("The scan was cancelled; showing only what was scanned up to that point.");
+    }
+
     m_view->OnScanCompleted();
 
     try {
@@ -94,6 +125,14 @@ void Controller::OnScanComplete(
     emit FinishedScanning();
 }
 
+void Controller::OnPartialResults(const std::shared_ptr<Tree<VizBlock>>& partialResults)
+{
+    // The final results will replace the snapshot wholesale, so there's no point in computing
+    // bounding boxes for it; the user can't interact with the model until the scan completes.
+    m_model->Parse(partialResults);
+    m_view->ReloadVisualization();
+}
+
 void Controller::MonitorFileSystem(bool shouldEnable)
 {
     if (!HasModelBeenLoaded()) {
@@ -108,6 +147,32 @@ void Controller::MonitorFileSystem(bool shouldEnable)
 }
 
 void Controller::ScanDrive(const Settings::VisualizationOptions& options)
+{
+    constexpr auto noPreviousScan = nullptr;
+    StartScan(options, noPreviousScan);
+}
+
+void Controller::RescanDrive()
+{
+    if (!HasModelBeenLoaded() || m_scanner.IsActive()) {
+        return;
+    }
+
+    // The current tree has to be claimed before the model that owns it is replaced. Note that a
+    // model restored from a snapshot won't have its root directory set in the options.
+    auto previousScan = m_model->ShareTree();
+
+    auto options = GetSessionSettings().GetVisualizationOptions();
+    options.rootDirectory = GetRootPath();
+    options.forceNewScan = true;
+
+    const auto& savedOptions = GetSessionSettings().SetVisualizationOptions(std::move(options));
+    StartScan(savedOptions, std::move(previousScan));
+}
+
+void Controller::StartScan(
+    const Settings::VisualizationOptions& options,
+    std::shared_ptr<const Tree<VizBlock>> previousScan)
 {
     const auto& root = options.rootDirectory;
 
@@ -134,10 +199,205 @@ void Controller::ScanDrive(const Settings::VisualizationOptions& options)
         OnScanComplete(progress, scanningResults);
     };
 
+    const auto partialResultsHandler = [this](const auto& /*progress*/, const auto& snapshot) {
+        OnPartialResults(snapshot);
+    };
+
     const auto& log = spdlog::get(Constants::Logging::DefaultLog);
     log->info("Started a new scan at \"{}\".", m_model->GetRootPath().string());
 
-    m_scanner.StartScanning(ScanningOptions{ root, progressHandler, completionHandler });
+    ScanningOptions scanningOptions{ root, progressHandler, completionHandler };
+    ApplyScanningPreferences(scanningOptions);
+
+    scanningOptions.onPartialResultsCallback = partialResultsHandler;
+    scanningOptions.partialResultsInterval =
+        std::chrono::milliseconds{ GetPersistentSettings().GetPartialResultsInterval() };
+
+    scanningOptions.previousTree = std::move(previousScan);
+
+    const auto checkpointInterval = GetPersistentSettings().GetCheckpointInterval();
+    if (checkpointInterval > 0) {
+        scanningOptions.checkpointPath = Scanner::CheckpointJournal::DeterminePath(
+            std::filesystem::current_path() / "Journals", root);
+        scanningOptions.checkpointInterval = std::chrono::seconds{ checkpointInterval };
+    }
+
+    m_scanner.StartScanning(scanningOptions);
+}
+
+void Controller::ApplyScanningPreferences(ScanningOptions& options) const
+{
+    const auto& settings = GetPersistentSettings();
+
+    options.threadLimit = settings.GetScanningThreadLimit();
+    options.shouldCountHardLinksOnce = settings.ShouldCountHardLinksOnce();
+    options.shouldStayOnFilesystem = settings.ShouldStayOnFilesystem();
+    options.shouldStatInInodeOrder = settings.ShouldStatInInodeOrder();
+
+    // The operation limit is meant to keep a scan in the background from hurting anything else,
+    // whereas a scan in the foreground is expected to finish as soon as possible.
+    if (settings.ShouldScanInBackground()) {
+        options.shouldRunInBackground = true;
+        options.operationLimit = static_cast<std::uint32_t>(settings.GetScanOperationLimit());
+    }
+    options.entryBudget = static_cast<std::uintmax_t>(settings.GetScanningEntryBudget());
+
+    // An unexpanded directory only needs a rough size, since it can always be expanded later on.
+    if (options.entryBudget > 0) {
+        options.samplingLimits = Scanner::SamplingLimits{ 8, 8 };
+    }
+
+    if (settings.ShouldUseAllocatedFileSizes()) {
+        options.sizeMetric = FileSizeMetric::Allocated;
+    }
+
+    if (settings.ShouldUseAsynchronousScanning()) {
+        options.engine = ScanningEngine::IoUring;
+    }
+}
+
+void Controller::ExpandNode(const Tree<VizBlock>::Node& node)
+{
+    if (!HasModelBeenLoaded() || !IsUserAllowedToInteractWithModel() || m_scanner.IsActive()) {
+        return;
+    }
+
+    if (!node->file.isUnexpanded) {
+        return;
+    }
+
+    // The node is looked up again once the scan completes, rather than held on to, in case the
+    // tree changes in the meantime.
+    const auto path = NodeToFilePath(node);
+
+    AllowUserInteractionWithModel(false);
+    m_view->OnScanStarted();
+
+    const auto progressHandler = [this, path](const auto& progress) {
+        m_view->SetStatusBarMessage(fmt::format(
+            "Expanding \"{}\"  |  Files Scanned: {:L}", path.string(),
+            progress.filesScanned.Load()));
+    };
+
+    const auto completionHandler = [this, path](const auto& progress, const auto& subtree) {
+        OnExpansionComplete(path, progress, subtree);
+    };
+
+    const auto& log = spdlog::get(Constants::Logging::DefaultLog);
+    log->info("Started expanding \"{}\".", path.string());
+
+    // The directory is scanned just like the original scan would have, so that a large directory
+    // may itself be expanded in stages.
+    ScanningOptions scanningOptions{ path, progressHandler, completionHandler };
+    ApplyScanningPreferences(scanningOptions);
+
+    m_scanner.StartScanning(scanningOptions);
+}
+
+void Controller::OnExpansionComplete(
+    const std::filesystem::path& path, const ScanningProgress& progress,
+    const std::shared_ptr<Tree<VizBlock>>& subtree)
+{
+    LogScanCompletion(progress);
+
+    m_view->SetWaitCursor();
+
+    const ScopeExit restoreCursor = [&]() noexcept
+    {
+        m_view->RestoreDefaultCursor();
+    };
+
+    auto* const node = Utilities::FindNodeViaAbsolutePath(m_model->GetTree().GetRoot(), path);
+
+    // A cancelled expansion would swap a sound estimate for a fraction of the directory, so the
+    // estimate is kept instead.
+    const auto isComplete = subtree && !subtree->GetRoot()->GetData().file.isIncomplete;
+
+    if (isComplete && node && node->GetData().file.isUnexpanded) {
+        m_nodeColorMap.clear();
+
+        m_model->ExpandNode(*node, *subtree);
+        m_model->UpdateBoundingBoxes();
+
+        auto metadata = m_model->GetTreemapMetadata();
+        metadata.FileCount += progress.filesScanned.Load();
+        metadata.DirectoryCount += progress.directoriesScanned.Load();
+        metadata.TotalBytes = m_model->GetTree().GetRoot()->GetData().file.size;
+
+        m_model->SetTreemapMetadata(std::move(metadata));
+    }
+
+    m_view->OnScanCompleted();
+
+    AllowUserInteractionWithModel(true);
+}
+
+void Controller::LoadSnapshot(const std::filesystem::path& snapshotPath)
+{
+    if (m_scanner.IsActive()) {
+        return;
+    }
+
+    m_view->SetWaitCursor();
+
+    const ScopeExit restoreCursor = [&]() noexcept
+    {
+        m_view->RestoreDefaultCursor();
+    };
+
+    Snapshot::Contents snapshot;
+
+    try {
+        snapshot = Snapshot::Load(snapshotPath);
+    } catch (const std::exception& exception) {
+        m_view->DisplayErrorDialog(exception.what());
+        return;
+    }
+
+    AllowUserInteractionWithModel(false);
+
+    // The root of a snapshot holds the full path that was originally scanned.
+    const std::filesystem::path root = snapshot.tree->GetRoot()->GetData().file.name.View();
+    m_model = m_modelFactory.CreateModel(std::make_unique<FileSystemMonitor>(), root);
+
+    m_nodeColorMap.clear();
+
+    if (snapshot.hasLayout) {
+        m_model->Adopt(snapshot.tree);
+    } else {
+        m_model->Parse(snapshot.tree);
+    }
+
+    m_model->UpdateBoundingBoxes();
+    m_model->SetTreemapMetadata(std::move(snapshot.metadata));
+
+    // Since a snapshot may well be out of date, the filesystem isn't monitored automatically;
+    // doing so would only report changes relative to the live filesystem, not the snapshot.
+    m_view->OnScanCompleted();
+
+    AllowUserInteractionWithModel(true);
+}
+
+void Controller::SaveSnapshot(const std::filesystem::path& snapshotPath)
+{
+    if (!HasModelBeenLoaded() || m_scanner.IsActive()) {
+        return;
+    }
+
+    m_view->SetWaitCursor();
+
+    const ScopeExit restoreCursor = [&]() noexcept
+    {
+        m_view->RestoreDefaultCursor();
+    };
+
+    try {
+        constexpr auto shouldIncludeLayout = true;
+        Snapshot::Save(
+            snapshotPath, m_model->GetTree(), m_model->GetTreemapMetadata(), shouldIncludeLayout);
+    } catch (const std::exception& exception) {
+        m_view->DisplayErrorDialog(exception.what());
+    }
 }
 
 void Controller::StopScanning()
@@ -190,22 +450,31 @@ void Controller::ReportProgressToStatusBar(const ScanningProgress& progress)
 {
     Expects(m_occupiedDiskSpace > 0u);
 
-    const auto filesScanned = progress.filesScanned.load();
-    const auto sizeInBytes = progress.bytesProcessed.load();
+    const auto filesScanned = progress.filesScanned.Load();
+    const auto sizeInBytes = progress.bytesProcessed.Load();
 
     const auto elapsedTime = progress.GetElapsedSeconds().count();
     const auto hours = elapsedTime / 3600;
     const auto minutes = (elapsedTime / 60) % 60;
     const auto seconds = elapsedTime % 60;
 
+    // Gauges of how well the scan is going, rather than of how far along it is.
+    const auto latency = std::chrono::duration<double, std::micro>{
+        progress.GetAverageSyscallLatency()
+    };
+
+    const auto health = fmt::format(
+        "  |  Avg. Filesystem Call: {:.1f} us  |  Directories Queued: {:L}", latency.count(),
+        progress.queueDepth.load());
+
     const auto rootPath = m_model->GetRootPath();
     const auto doesPathRepresentEntireDrive{ rootPath == rootPath.root_path() };
 
     if (doesPathRepresentEntireDrive) {
         const auto fraction = sizeInBytes / static_cast<double>(m_occupiedDiskSpace);
         const auto message = fmt::format(
-            "Time Elapsed: {:02d}:{:02d}:{:02d}  |  Files Scanned: {:L}  |  {:03.2f}% Complete",
-            hours, minutes, seconds, filesScanned, fraction * 100);
+            "Time Elapsed: {:02d}:{:02d}:{:02d}  |  Files Scanned: {:L}  |  {:03.2f}% Complete{}",
+            hours, minutes, seconds, filesScanned, fraction * 100, health);
 
         m_view->SetStatusBarMessage(message);
     } else {
@@ -214,8 +483,8 @@ void Controller::ReportProgressToStatusBar(const ScanningProgress& progress)
 
         const auto message = fmt::format(
             "Time Elapsed: {:02d}:{:02d}:{:02d}  |  Files Scanned: {:L}  |  {:03.2f} {} and "
-            "counting...",
-            hours, minutes, seconds, filesScanned, size, units);
+            "counting...{}",
+            hours, minutes, seconds, filesScanned, size, units, health);
 
         m_view->SetStatusBarMessage(message);
     }
@@ -244,6 +513,12 @@ const Tree<VizBlock>& Controller::GetTree() const
     return m_model->GetTree();
 }
 
+const FlatTree& Controller::GetFlatTree() const
+{
+    Expects(m_model);
+    return m_model->GetFlatTree();
+}
+
 const std::vector<const Tree<VizBlock>::Node*>& Controller::GetHighlightedNodes() const
 {
     Expects(m_model);
@@ -286,8 +561,12 @@ void Controller::SelectNodeAndUpdateStatusBar(
     const auto isSmallFile = units.find(Constants::Units::Bytes) != std::string::npos;
 
     const auto path = Controller::NodeToFilePath(node).string();
-    const auto message = isSmallFile ? fmt::format("{}  |  {:.0f} {}", path, prefixedSize, units)
-                                     : fmt::format("{}  |  {:.2f} {}", path, prefixedSize, units);
+    auto message = isSmallFile ? fmt::format("{}  |  {:.0f} {}", path, prefixedSize, units)
+                               : fmt::format("{}  |  {:.2f} {}", path, prefixedSize, units);
+
+    if (node->file.isUnexpanded) {
+        message += "  |  Estimated; double-click to expand";
+    }
 
     m_view->SetStatusBarMessage(message);
 }
@@ -366,9 +645,9 @@ bool Controller::IsUserAllowedToInteractWithModel() const
 void Controller::SaveScanMetadata(const ScanningProgress& progress)
 {
     Expects(m_model);
-    m_model->SetTreemapMetadata(TreemapMetadata{ progress.filesScanned.load(),
-                                                 progress.directoriesScanned.load(),
-                                                 progress.bytesProcessed.load() });
+    m_model->SetTreemapMetadata(TreemapMetadata{ progress.filesScanned.Load(),
+                                                 progress.directoriesScanned.Load(),
+                                                 progress.bytesProcessed.Load() });
 }
 
 void Controller::ClearSelectedNode()
@@ -474,7 +753,7 @@ void Controller::SearchTreeMap(
 
 std::filesystem::path Controller::NodeToFilePath(const Tree<VizBlock>::Node& node)
 {
-    std::vector<std::reference_wrapper<const std::string>> reversePath;
+    std::vector<std::string_view> reversePath;
     reversePath.reserve(Tree<VizBlock>::Depth(node));
     reversePath.emplace_back(node->file.name);
 
@@ -486,19 +765,20 @@ std::filesystem::path Controller::NodeToFilePath(const Tree<VizBlock>::Node& nod
 
     const auto completePath = std::accumulate(
         std::rbegin(reversePath), std::rend(reversePath), std::string{},
-        [](const std::string& path, const std::string& file) {
+        [](std::string path, std::string_view file) {
             constexpr auto slash = '/';
 
             if (!path.empty() && path.back() != slash) {
-                return path + slash + file;
+                path += slash;
             }
 
-            return path + file;
+            path.append(file);
+            return path;
         });
 
     Expects(completePath.empty() == false);
 
-    auto finalPath = std::filesystem::path{ completePath + node->file.extension };
+    auto finalPath = std::filesystem::path{ completePath + node->file.extension.ToString() };
     finalPath.make_preferred();
 
     return finalPath;
@@ -552,7 +832,7 @@ void Controller::ReportProgressToTaskbar(const ScanningProgress& progress, Butto
     IgnoreUnused(button, progress);
 
 #if defined(Q_OS_WIN)
-    const auto sizeInBytes = progress.bytesProcessed.load();
+    const auto sizeInBytes = progress.bytesProcessed.Load();
 
     const auto rootPath = m_model->GetRootPath();
     const auto doesPathRepresentEntireDrive{ rootPath == rootPath.root_path() };
@@ -19,13 +19,29 @@ LIBS += -L$$DESTDIR -lD-Viz
 HEADERS += \
    Utilities/testUtilities.h \
    cameraTests.h \
+   checkpointJournalTests.h \
+   concurrencyControllerTests.h \
    controllerTests.h \
+   exclusionRulesTests.h \
    fileSizeLiteralTests.h \
    filesystemObserverTests.h \
+   flatTreeTests.h \
    modelTests.h \
+   mountTableTests.h \
+   nameArenaTests.h \
    nodePainterTests.h \
+   partialTreeBuilderTests.h \
    persistentSettingsTests.h \
+   scanSnapshotTests.h \
+   scanSummaryTests.h \
+   scanningWorkerTests.h \
    sessionSettingsTests.h \
+   shardedCounterTests.h \
+   statxRingTests.h \
+   subtreeEstimatorTests.h \
+   syntheticFileSystemBackendTests.h \
+   tokenBucketTests.h \
+   workStealingSchedulerTests.h \
    Mocks/mockView.h \
    Mocks/mockFileMonitor.h \
    Utilities/multiTestHarness.h \
@@ -33,14 +49,30 @@ HEADERS += \
 
 SOURCES += \
    cameraTests.cpp \
+   checkpointJournalTests.cpp \
+   concurrencyControllerTests.cpp \
    controllerTests.cpp \
+   exclusionRulesTests.cpp \
    fileSizeLiteralTests.cpp \
    filesystemObserverTests.cpp \
+   flatTreeTests.cpp \
    modelTests.cpp \
+   mountTableTests.cpp \
+   nameArenaTests.cpp \
    nodePainterTests.cpp \
+   partialTreeBuilderTests.cpp \
    persistentSettingsTests.cpp \
+   scanSnapshotTests.cpp \
+   scanSummaryTests.cpp \
+   scanningWorkerTests.cpp \
    sessionSettingsTests.cpp \
-   testMain.cpp
+   shardedCounterTests.cpp \
+   statxRingTests.cpp \
+   subtreeEstimatorTests.cpp \
+   syntheticFileSystemBackendTests.cpp \
+   testMain.cpp \
+   tokenBucketTests.cpp \
+   workStealingSchedulerTests.cpp
 
 INCLUDEPATH += \
    $$PWD/../ThirdParty/Trompeloeil/include \
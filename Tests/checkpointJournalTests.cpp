@@ -0,0 +1,292 @@
+#include "checkpointJournalTests.h"
+
+#include <Model/Scanner/checkpointJournal.h>
+#include <Model/Scanner/scanningOptions.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr auto NoParent = Scanner::CheckpointJournal::NoParent;
+
+    constexpr auto RootPath = "/home/user";
+
+    /**
+     * @brief Builds a small tree in which every directory has already been read. Directory sizes
+     * are left at zero, since the journal doesn't restore them.
+     */
+    std::shared_ptr<Tree<VizBlock>> CreateSampleTree()
+    {
+        auto tree = std::make_shared<Tree<VizBlock>>(
+            VizBlock{ FileInfo{ RootPath, "", 0, FileType::Directory } });
+
+        auto* const root = tree->GetRoot();
+        root->GetData().file.changeStamp = 0x1111;
+
+        auto* const source = root->AppendChild(
+            VizBlock{ FileInfo{ "source", "", 0, FileType::Directory } });
+
+        source->GetData().file.changeStamp = 0x2222;
+
+        source->AppendChild(VizBlock{ FileInfo{ "main", ".cpp", 1'000, FileType::Regular } });
+        source->AppendChild(VizBlock{ FileInfo{ "utilities", ".cpp", 10, FileType::Regular } });
+
+        root->AppendChild(VizBlock{ FileInfo{ "README", "", 100, FileType::Regular } });
+
+        return tree;
+    }
+
+    /**
+     * @brief Flattens the tree into a list of descriptions, in pre-order.
+     */
+    std::vector<std::string> Describe(const Tree<VizBlock>::Node& root)
+    {
+        std::vector<std::string> descriptions;
+
+        const auto describe = [&](const Tree<VizBlock>::Node& node, auto& recurse) -> void {
+            const auto& file = node->file;
+            descriptions.emplace_back(
+                file.name.ToString() + "|" + file.extension.ToString() + "|" +
+                std::to_string(file.size) + "|" + std::to_string(static_cast<int>(file.type)) +
+                "|" + std::to_string(file.changeStamp) + "|" +
+                std::to_string(node.GetChildCount()));
+
+            for (auto* child = node.GetFirstChild(); child; child = child->GetNextSibling()) {
+                recurse(*child, recurse);
+            }
+        };
+
+        describe(root, describe);
+        return descriptions;
+    }
+
+    /**
+     * @brief Records the listing of every directory in the sample tree, parents first.
+     */
+    void RecordSampleTree(Scanner::CheckpointJournal& journal, const Tree<VizBlock>& tree)
+    {
+        const auto* const root = tree.GetRoot();
+        journal.RecordListing(0, NoParent, *root);
+        journal.RecordListing(1, 0, *root->GetFirstChild());
+    }
+} // namespace
+
+void CheckpointJournalTests::init()
+{
+    std::error_code errorCode;
+    std::filesystem::remove(m_journalPath, errorCode);
+}
+
+void CheckpointJournalTests::RestoresListings() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    RecordSampleTree(journal, *tree);
+    journal.Close(true);
+
+    const auto restoredTree =
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Apparent);
+
+    QVERIFY(restoredTree != nullptr);
+    QVERIFY(Describe(*restoredTree->GetRoot()) == Describe(*tree->GetRoot()));
+}
+
+void CheckpointJournalTests::LeavesUnrecordedDirectoriesEmpty() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    journal.RecordListing(0, NoParent, *tree->GetRoot());
+    journal.Close(true);
+
+    const auto restoredTree =
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Apparent);
+
+    QVERIFY(restoredTree != nullptr);
+    QCOMPARE(static_cast<unsigned long>(restoredTree->GetRoot()->GetChildCount()), 2ul);
+
+    const auto& source = *restoredTree->GetRoot()->GetFirstChild();
+    QCOMPARE(source->file.name.ToString(), std::string{ "source" });
+    QCOMPARE(source->file.changeStamp, std::uint64_t{ 0 });
+    QVERIFY(!source.HasChildren());
+}
+
+void CheckpointJournalTests::ToleratesTruncatedJournal() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    RecordSampleTree(journal, *tree);
+    journal.Close(true);
+
+    // Cutting off the tail of the last record loses that record, but none of those before it.
+    std::filesystem::resize_file(m_journalPath, std::filesystem::file_size(m_journalPath) - 3);
+
+    std::uintmax_t intactSize = 0;
+    const auto restoredTree = Scanner::CheckpointJournal::Restore(
+        m_journalPath, RootPath, FileSizeMetric::Apparent, &intactSize);
+
+    QVERIFY(restoredTree != nullptr);
+    QCOMPARE(static_cast<unsigned long>(restoredTree->GetRoot()->GetChildCount()), 2ul);
+    QVERIFY(!restoredTree->GetRoot()->GetFirstChild()->HasChildren());
+
+    // The resumed scan's session has to be appended in place of the damaged record, or else the
+    // next restore would never get as far as reading it.
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, intactSize));
+
+    journal.RecordReuse(10, NoParent, tree->GetRoot()->GetData().file);
+    journal.RecordListing(11, 10, *tree->GetRoot()->GetFirstChild());
+    journal.Close(true);
+
+    const auto resumedTree =
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Apparent);
+
+    QVERIFY(resumedTree != nullptr);
+    QVERIFY(Describe(*resumedTree->GetRoot()) == Describe(*tree->GetRoot()));
+}
+
+void CheckpointJournalTests::IgnoresJournalOfDifferentScan() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    RecordSampleTree(journal, *tree);
+    journal.Close(true);
+
+    QVERIFY(
+        Scanner::CheckpointJournal::Restore(
+            m_journalPath, "/home/someone", FileSizeMetric::Apparent) == nullptr);
+
+    QVERIFY(
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Allocated) ==
+        nullptr);
+}
+
+void CheckpointJournalTests::LaysLaterSessionsOverEarlierOnes() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    RecordSampleTree(journal, *tree);
+    journal.Close(true);
+
+    // The resumed scan carries the root over, but finds that a file was removed from the source
+    // directory in the meantime. Identifiers start over with every session.
+    auto* const source = tree->GetRoot()->GetFirstChild();
+    source->GetData().file.changeStamp = 0x3333;
+    source->GetFirstChild()->DeleteFromTree();
+
+    std::uintmax_t intactSize = 0;
+    QVERIFY(
+        Scanner::CheckpointJournal::Restore(
+            m_journalPath, RootPath, FileSizeMetric::Apparent, &intactSize) != nullptr);
+
+    QCOMPARE(intactSize, std::filesystem::file_size(m_journalPath));
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, intactSize));
+
+    journal.RecordReuse(10, NoParent, tree->GetRoot()->GetData().file);
+    journal.RecordListing(11, 10, *source);
+    journal.Close(true);
+
+    const auto restoredTree =
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Apparent);
+
+    QVERIFY(restoredTree != nullptr);
+    QVERIFY(Describe(*restoredTree->GetRoot()) == Describe(*tree->GetRoot()));
+}
+
+void CheckpointJournalTests::KeepsSubdirectoriesOfRelistedDirectories() const
+{
+    const auto tree = CreateSampleTree();
+
+    auto* const root = tree->GetRoot();
+    auto* const source = root->GetFirstChild();
+    auto* const documentation =
+        root->AppendChild(VizBlock{ FileInfo{ "docs", "", 0, FileType::Directory } });
+
+    documentation->GetData().file.changeStamp = 0x5555;
+    documentation->AppendChild(VizBlock{ FileInfo{ "guide", ".md", 50, FileType::Regular } });
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+
+    RecordSampleTree(journal, *tree);
+    journal.RecordListing(2, 0, *documentation);
+    journal.Close(true);
+
+    // The second session finds that the root changed, since the documentation and the README
+    // were removed, and a file was added. The source directory is carried over as it was.
+    documentation->DeleteFromTree();
+    source->GetNextSibling()->DeleteFromTree();
+    root->AppendChild(VizBlock{ FileInfo{ "notes", ".txt", 1, FileType::Regular } });
+    root->GetData().file.changeStamp = 0x4444;
+
+    std::uintmax_t intactSize = 0;
+    QVERIFY(
+        Scanner::CheckpointJournal::Restore(
+            m_journalPath, RootPath, FileSizeMetric::Apparent, &intactSize) != nullptr);
+
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, intactSize));
+
+    journal.RecordListing(20, NoParent, *root);
+    journal.RecordReuse(21, 20, source->GetData().file);
+    journal.Close(true);
+
+    // The third session carries everything over, without recording a single listing.
+    QVERIFY(
+        Scanner::CheckpointJournal::Restore(
+            m_journalPath, RootPath, FileSizeMetric::Apparent, &intactSize) != nullptr);
+
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, intactSize));
+
+    journal.RecordReuse(30, NoParent, root->GetData().file);
+    journal.RecordReuse(31, 30, source->GetData().file);
+    journal.Close(true);
+
+    const auto restoredTree =
+        Scanner::CheckpointJournal::Restore(m_journalPath, RootPath, FileSizeMetric::Apparent);
+
+    QVERIFY(restoredTree != nullptr);
+    QVERIFY(Describe(*restoredTree->GetRoot()) == Describe(*tree->GetRoot()));
+}
+
+void CheckpointJournalTests::DeterminesPathPerRoot() const
+{
+    const std::filesystem::path directory = "/tmp/Journals";
+
+    const auto path = Scanner::CheckpointJournal::DeterminePath(directory, RootPath);
+    QVERIFY(path.parent_path() == directory);
+    QVERIFY(path.extension() == Scanner::CheckpointJournal::FileExtension);
+
+    QVERIFY(Scanner::CheckpointJournal::DeterminePath(directory, RootPath) == path);
+    QVERIFY(Scanner::CheckpointJournal::DeterminePath(directory, "/home/someone") != path);
+}
+
+void CheckpointJournalTests::DeletesJournalUnlessKept() const
+{
+    const auto tree = CreateSampleTree();
+
+    Scanner::CheckpointJournal journal;
+    QVERIFY(journal.Open(m_journalPath, RootPath, FileSizeMetric::Apparent, 0));
+    QVERIFY(journal.IsOpen());
+
+    RecordSampleTree(journal, *tree);
+    journal.Close(false);
+
+    QVERIFY(!journal.IsOpen());
+    QVERIFY(!std::filesystem::exists(m_journalPath));
+}
+
+REGISTER_TEST(CheckpointJournalTests)
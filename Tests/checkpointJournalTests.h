@@ -0,0 +1,70 @@
+#ifndef CHECKPOINTJOURNALTESTS_H
+#define CHECKPOINTJOURNALTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+#include <filesystem>
+
+class CheckpointJournalTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Removes any journal left behind by the previous test.
+     */
+    void init();
+
+    /**
+     * @brief Verifies that the recorded listings can be restored into a tree.
+     */
+    void RestoresListings() const;
+
+    /**
+     * @brief Verifies that a subdirectory whose listing wasn't recorded is restored without any
+     * children, and without a change stamp, so that it will be read again.
+     */
+    void LeavesUnrecordedDirectoriesEmpty() const;
+
+    /**
+     * @brief Verifies that the records that made it into a journal that was cut short can still be
+     * restored, and that a session appended to such a journal can be restored as well.
+     */
+    void ToleratesTruncatedJournal() const;
+
+    /**
+     * @brief Verifies that a journal isn't restored for a scan of a different root, or for one
+     * that sizes its files differently.
+     */
+    void IgnoresJournalOfDifferentScan() const;
+
+    /**
+     * @brief Verifies that the listings recorded by a resumed scan replace those recorded before.
+     */
+    void LaysLaterSessionsOverEarlierOnes() const;
+
+    /**
+     * @brief Verifies that a directory that a later session listed again keeps the restored
+     * subtrees of the subdirectories that it still holds, and only drops those that vanished.
+     */
+    void KeepsSubdirectoriesOfRelistedDirectories() const;
+
+    /**
+     * @brief Verifies that every root is journaled to a file of its own, in the given directory.
+     */
+    void DeterminesPathPerRoot() const;
+
+    /**
+     * @brief Verifies that the journal is deleted when closed, unless it should be kept.
+     */
+    void DeletesJournalUnlessKept() const;
+
+  private:
+    std::filesystem::path m_journalPath =
+        std::filesystem::temp_directory_path() / "D-Viz-Test-Journal.dvizjournal";
+};
+
+#endif // CHECKPOINTJOURNALTESTS_H
@@ -0,0 +1,93 @@
+#include "concurrencyControllerTests.h"
+
+#include <Model/Scanner/concurrencyController.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+    constexpr std::chrono::milliseconds SamplingInterval{ 250 };
+
+    /**
+     * @brief Drives the controller with a simulated storage device, whose throughput (in entries
+     * per second) at a given thread count is described by the supplied model.
+     *
+     * @returns The thread count that the controller settled on after the given number of samples.
+     */
+    unsigned int Simulate(
+        Scanner::ConcurrencyController& controller,
+        const std::function<double(unsigned int)>& throughputModel, int sampleCount)
+    {
+        const auto intervalInSeconds = std::chrono::duration<double>(SamplingInterval).count();
+
+        std::uintmax_t entriesProcessed = 0;
+        std::chrono::nanoseconds busyTime{ 0 };
+
+        for (int sample = 0; sample < sampleCount; ++sample) {
+            const auto threadCount = controller.GetThreadCount();
+            const auto throughput = throughputModel(threadCount);
+
+            // Every active thread is assumed to be waiting on the storage for the whole interval.
+            entriesProcessed += static_cast<std::uintmax_t>(throughput * intervalInSeconds);
+            busyTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                SamplingInterval * threadCount);
+
+            controller.Update(entriesProcessed, busyTime, SamplingInterval);
+        }
+
+        return controller.GetThreadCount();
+    }
+} // namespace
+
+void ConcurrencyControllerTests::ScalesUpOnFastStorage() const
+{
+    // Throughput scales linearly until 24 threads, and then plateaus.
+    const auto model = [](unsigned int threads) { return 1000.0 * std::min(threads, 24u); };
+
+    Scanner::ConcurrencyController controller{ 1, 64, 4 };
+    const auto threadCount = Simulate(controller, model, 60);
+
+    QVERIFY(threadCount >= 20);
+    QVERIFY(threadCount <= 36);
+}
+
+void ConcurrencyControllerTests::ScalesDownOnSlowStorage() const
+{
+    // Throughput peaks at two threads, after which additional threads only cause thrashing.
+    const auto model = [](unsigned int threads) {
+        return threads <= 2 ? 500.0 * threads : 1000.0 / (1.0 + 0.1 * (threads - 2));
+    };
+
+    Scanner::ConcurrencyController controller{ 1, 64, 4 };
+    const auto threadCount = Simulate(controller, model, 60);
+
+    QVERIFY(threadCount <= 3);
+}
+
+void ConcurrencyControllerTests::RespectsThreadCeiling() const
+{
+    const auto model = [](unsigned int threads) { return 1000.0 * threads; };
+
+    Scanner::ConcurrencyController controller{ 1, 8, 4 };
+    const auto threadCount = Simulate(controller, model, 60);
+
+    QCOMPARE(threadCount, 8u);
+
+    for (const auto& sample : controller.GetSamples()) {
+        QVERIFY(sample.threadCount <= 8u);
+    }
+}
+
+void ConcurrencyControllerTests::IgnoresIdleIntervals() const
+{
+    Scanner::ConcurrencyController controller{ 1, 64, 4 };
+
+    constexpr std::uintmax_t entriesProcessed = 0;
+    controller.Update(entriesProcessed, std::chrono::seconds{ 1 }, SamplingInterval);
+
+    QCOMPARE(controller.GetThreadCount(), 4u);
+    QVERIFY(controller.GetSamples().empty());
+}
+
+REGISTER_TEST(ConcurrencyControllerTests)
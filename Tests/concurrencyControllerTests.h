@@ -0,0 +1,35 @@
+#ifndef CONCURRENCYCONTROLLERTESTS_H
+#define CONCURRENCYCONTROLLERTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class ConcurrencyControllerTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that the controller adds threads for as long as doing so pays off.
+     */
+    void ScalesUpOnFastStorage() const;
+
+    /**
+     * @brief Verifies that the controller sheds threads when the storage is easily saturated.
+     */
+    void ScalesDownOnSlowStorage() const;
+
+    /**
+     * @brief Verifies that the controller never exceeds the configured ceiling.
+     */
+    void RespectsThreadCeiling() const;
+
+    /**
+     * @brief Verifies that intervals in which no entries completed are ignored.
+     */
+    void IgnoresIdleIntervals() const;
+};
+
+#endif // CONCURRENCYCONTROLLERTESTS_H
@@ -234,10 +234,7 @@ void ControllerTests::VerifyFilesOverLimitAreDisplayed() const
     options.onlyShowDirectories = false;
 
     VizBlock sample;
-    sample.file.name = "Foo";
-    sample.file.extension = ".txt";
-    sample.file.size = 16_KiB;
-    sample.file.type = FileType::Regular;
+    sample.file = FileInfo{ "Foo", ".txt", 16_KiB, FileType::Regular };
 
     QCOMPARE(options.IsNodeVisible(sample), true);
 }
@@ -252,10 +249,7 @@ void ControllerTests::VerifyFilesUnderLimitAreNotDisplayed() const
     options.onlyShowDirectories = false;
 
     VizBlock sample;
-    sample.file.name = "Foo";
-    sample.file.extension = ".txt";
-    sample.file.size = 16_KiB;
-    sample.file.type = FileType::Regular;
+    sample.file = FileInfo{ "Foo", ".txt", 16_KiB, FileType::Regular };
 
     QCOMPARE(options.IsNodeVisible(sample), false);
 }
@@ -270,10 +264,7 @@ void ControllerTests::VerifyFilesAreNotDisplayedWhenOnlyDirectoriesAllowed() con
     options.onlyShowDirectories = true;
 
     VizBlock sample;
-    sample.file.name = "Bar";
-    sample.file.extension = "";
-    sample.file.size = 10_GiB;
-    sample.file.type = FileType::Regular;
+    sample.file = FileInfo{ "Bar", "", 10_GiB, FileType::Regular };
 
     QCOMPARE(options.IsNodeVisible(sample), false);
 }
@@ -288,10 +279,7 @@ void ControllerTests::VerifyDirectoriesUnderLimitAreNotShownWhenNotAllowed() con
     options.onlyShowDirectories = true;
 
     VizBlock sample;
-    sample.file.name = "Bar";
-    sample.file.extension = "";
-    sample.file.size = 10_MiB;
-    sample.file.type = FileType::Directory;
+    sample.file = FileInfo{ "Bar", "", 10_MiB, FileType::Directory };
 
     QCOMPARE(options.IsNodeVisible(sample), true);
 }
@@ -306,10 +294,7 @@ void ControllerTests::VerifyDirectoriesOverLimitAreNotShownWhenNotAllowed() cons
     options.onlyShowDirectories = true;
 
     VizBlock sample;
-    sample.file.name = "Bar";
-    sample.file.extension = "";
-    sample.file.size = 1_MiB;
-    sample.file.type = FileType::Directory;
+    sample.file = FileInfo{ "Bar", "", 1_MiB, FileType::Directory };
 
     QCOMPARE(options.IsNodeVisible(sample), false);
 }
@@ -455,7 +440,7 @@ void ControllerTests::SelectNodeViaRay() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     QVERIFY(targetNode != Tree<VizBlock>::LeafIterator{});
 
@@ -473,8 +458,8 @@ void ControllerTests::SelectNodeViaRay() const
     const auto deselectionCallback = [](const Tree<VizBlock>::Node&) { QVERIFY(false); };
 
     const auto selectionCallback = [&](const Tree<VizBlock>::Node& node) {
-        QCOMPARE(node->file.name, "socket_ops");
-        QCOMPARE(node->file.extension, ".ipp");
+        QCOMPARE(node->file.name.ToString(), "socket_ops");
+        QCOMPARE(node->file.extension.ToString(), ".ipp");
     };
 
     REQUIRE_CALL(*m_view, SetStatusBarMessage(trompeloeil::_, trompeloeil::_)).TIMES(1);
@@ -504,11 +489,11 @@ void ControllerTests::ConsecutiveNodeSelection() const
         const Ray ray{ camera.GetPosition(), camera.Forward() };
 
         const auto deselectionCallback = [&](const Tree<VizBlock>::Node& node) {
-            deselectionsMade.emplace_back(node->file.name + node->file.extension);
+            deselectionsMade.emplace_back(node->file.GetFullName());
         };
 
         const auto selectionCallback = [&](const Tree<VizBlock>::Node& node) {
-            selectionsMade.emplace_back(node->file.name + node->file.extension);
+            selectionsMade.emplace_back(node->file.GetFullName());
         };
 
         m_controller->SelectNodeViaRay(camera, ray, deselectionCallback, selectionCallback);
@@ -561,7 +546,7 @@ void ControllerTests::DetermineDefaultLeafNodeColor() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     const auto& nodeColor = m_controller->DetermineNodeColor(*targetNode);
     QCOMPARE(nodeColor, Constants::Colors::File);
@@ -576,7 +561,7 @@ void ControllerTests::DetermineDefaultDirectoryNodeColor() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::PostOrderIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::PostOrderIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     const auto& nodeColor = m_controller->DetermineNodeColor(*targetNode);
     QCOMPARE(nodeColor, Constants::Colors::Directory);
@@ -591,7 +576,7 @@ void ControllerTests::DetermineNodeColorFromTheme() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     const std::unordered_map<std::string, QVector3D> mapping = {
         { ".hpp", Constants::Colors::White }, { ".cpp", Constants::Colors::White }
@@ -613,7 +598,7 @@ void ControllerTests::DetermineDefaultColorOfHighlightedNode() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     const auto& nodeColor = m_controller->DetermineNodeColor(*targetNode);
     QCOMPARE(nodeColor, Constants::Colors::Highlighted);
@@ -628,7 +613,7 @@ void ControllerTests::DetermineCustomColorOfRegisteredNode() const
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_controller->GetTree().GetRoot() },
         Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     constexpr auto customColor = QVector3D{ 0.1f, 0.2f, 0.3f };
     m_controller->RegisterNodeColor(*targetNode, customColor);
@@ -653,7 +638,7 @@ void ControllerTests::GetRootPath() const
     ScanDrive();
 
     const auto rootPath = m_controller->GetRootPath();
-    const auto rootFileName = m_controller->GetTree().GetRoot()->GetData().file.name;
+    const auto rootFileName = m_controller->GetTree().GetRoot()->GetData().file.name.ToString();
 
     QCOMPARE(rootPath, rootFileName);
 }
@@ -0,0 +1,111 @@
+#include "exclusionRulesTests.h"
+
+#include <Model/Scanner/exclusionRules.h>
+
+void ExclusionRulesTests::MatchesGlobs() const
+{
+    using Scanner::ExclusionMatcher;
+
+    QVERIFY(ExclusionMatcher::MatchesGlob("node_modules", "node_modules"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("node_modules", "node_modules2"));
+
+    QVERIFY(ExclusionMatcher::MatchesGlob("*", ""));
+    QVERIFY(ExclusionMatcher::MatchesGlob("*.cache", ".cache"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("*.cache", "thumbnails.cache"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("*.cache", "thumbnails.cache.old"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("*build*", "cmake-build-debug"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("a*b*c", "aXbYbZc"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("a*b*c", "aXbYcZ"));
+
+    QVERIFY(ExclusionMatcher::MatchesGlob("v?", "v1"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("v?", "v"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("v?", "v10"));
+
+    QVERIFY(ExclusionMatcher::MatchesGlob("log[0-9]", "log7"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("log[0-9]", "logs"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("[Tt]emp", "Temp"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("[!.]*", "visible"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("[!.]*", ".hidden"));
+    QVERIFY(ExclusionMatcher::MatchesGlob("[]]", "]"));
+
+    // An opening bracket without a closing one is just an ordinary character.
+    QVERIFY(ExclusionMatcher::MatchesGlob("[abc", "[abc"));
+    QVERIFY(!ExclusionMatcher::MatchesGlob("[abc", "a"));
+}
+
+void ExclusionRulesTests::ExcludesByName() const
+{
+    Scanner::ExclusionRules rules;
+    rules.names = { ".git", "*.snapshot" };
+
+    const Scanner::ExclusionMatcher matcher{ rules, "/data" };
+
+    QVERIFY(!matcher.IsEmpty());
+    QVERIFY(matcher.IsExcluded("/data", ".git"));
+    QVERIFY(matcher.IsExcluded("/data/project/module", ".git"));
+    QVERIFY(matcher.IsExcluded("/data/volumes", "daily.snapshot"));
+
+    QVERIFY(!matcher.IsExcluded("/data", ".github"));
+    QVERIFY(!matcher.IsExcluded("/data", "snapshots"));
+}
+
+void ExclusionRulesTests::ExcludesByTrailingPath() const
+{
+    Scanner::ExclusionRules rules;
+    rules.names = { ".git/objects", "cmake-build-*/CMakeFiles/*.dir", "var/cache/" };
+
+    const Scanner::ExclusionMatcher matcher{ rules, "/data" };
+
+    QVERIFY(!matcher.IsEmpty());
+    QVERIFY(matcher.IsExcluded("/data/.git", "objects"));
+    QVERIFY(matcher.IsExcluded("/data/project/module/.git", "objects"));
+    QVERIFY(matcher.IsExcluded("/data/cmake-build-debug/CMakeFiles", "viz.dir"));
+    QVERIFY(matcher.IsExcluded("/data/var", "cache"));
+
+    QVERIFY(!matcher.IsExcluded("/data", "objects"));
+    QVERIFY(!matcher.IsExcluded("/data/.git", "refs"));
+    QVERIFY(!matcher.IsExcluded("/data/.github", "objects"));
+    QVERIFY(!matcher.IsExcluded("/data/.git/modules", "objects"));
+    QVERIFY(!matcher.IsExcluded("/data/build/CMakeFiles", "viz.dir"));
+    QVERIFY(!matcher.IsExcluded("/data/cmake-build-debug/CMakeFiles", "viz"));
+    QVERIFY(!matcher.IsExcluded("/data", "cache"));
+
+    // Only the components of a rule are matched, not the rule as a whole.
+    QVERIFY(!matcher.IsExcluded("/data", ".git"));
+    QVERIFY(!matcher.IsExcluded("/data", ".git/objects"));
+}
+
+void ExclusionRulesTests::ExcludesByPath() const
+{
+    Scanner::ExclusionRules rules;
+    rules.paths = { "build/cache", "/data/project/", "/elsewhere/build", "/data" };
+
+    const Scanner::ExclusionMatcher matcher{ rules, "/data" };
+
+    QVERIFY(matcher.IsExcluded("/data/build", "cache"));
+    QVERIFY(matcher.IsExcluded("/data", "project"));
+
+    QVERIFY(!matcher.IsExcluded("/data", "build"));
+    QVERIFY(!matcher.IsExcluded("/data/other", "cache"));
+    QVERIFY(!matcher.IsExcluded("/elsewhere", "build"));
+
+    // The paths are spelled the way that the scanner builds them, starting from the root as given.
+    const Scanner::ExclusionMatcher trailingMatcher{ rules, "/data/" };
+    QVERIFY(trailingMatcher.IsExcluded("/data/build", "cache"));
+    QVERIFY(trailingMatcher.IsExcluded("/data/", "project"));
+}
+
+void ExclusionRulesTests::IsEmptyWithoutRules() const
+{
+    Scanner::ExclusionRules rules;
+    rules.paths = { "/elsewhere" };
+    rules.filesystemTypes = { "nfs" };
+
+    const Scanner::ExclusionMatcher matcher{ rules, "/data" };
+
+    QVERIFY(matcher.IsEmpty());
+    QVERIFY(!matcher.IsExcluded("/", "elsewhere"));
+    QVERIFY(Scanner::ExclusionMatcher{}.IsEmpty());
+}
+
+REGISTER_TEST(ExclusionRulesTests)
@@ -0,0 +1,42 @@
+#ifndef EXCLUSIONRULESTESTS_H
+#define EXCLUSIONRULESTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class ExclusionRulesTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that wildcards, character classes, and ranges match as they would in a shell.
+     */
+    void MatchesGlobs() const;
+
+    /**
+     * @brief Verifies that directories are excluded by name, wherever they appear in the tree.
+     */
+    void ExcludesByName() const;
+
+    /**
+     * @brief Verifies that a name that spans several components only excludes the directories
+     * whose path ends in matching components.
+     */
+    void ExcludesByTrailingPath() const;
+
+    /**
+     * @brief Verifies that relative and absolute paths exclude the same directory, and that paths
+     * outside of the scan root are ignored.
+     */
+    void ExcludesByPath() const;
+
+    /**
+     * @brief Verifies that a matcher without any name or path rules excludes nothing.
+     */
+    void IsEmptyWithoutRules() const;
+};
+
+#endif // EXCLUSIONRULESTESTS_H
@@ -0,0 +1,130 @@
+#include "flatTreeTests.h"
+
+#include <Model/flatTree.h>
+#include <Model/vizBlock.h>
+
+#include <Tree/Tree.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Builds the following tree, whose nodes are listed here in pre-order:
+     *
+     *    root
+     *    ├── src
+     *    │   ├── main.cpp
+     *    │   └── README
+     *    ├── notes.txt
+     *    └── empty
+     */
+    std::shared_ptr<Tree<VizBlock>> CreateSampleTree()
+    {
+        auto tree = std::make_shared<Tree<VizBlock>>(
+            VizBlock{ FileInfo{ "root", "", 100, FileType::Directory } });
+
+        auto* const root = tree->GetRoot();
+        auto* const source =
+            root->AppendChild(VizBlock{ FileInfo{ "src", "", 60, FileType::Directory } });
+        source->AppendChild(VizBlock{ FileInfo{ "main", ".cpp", 40, FileType::Regular } });
+        source->AppendChild(VizBlock{ FileInfo{ "README", "", 20, FileType::Regular } });
+        root->AppendChild(VizBlock{ FileInfo{ "notes", ".txt", 40, FileType::Regular } });
+        root->AppendChild(VizBlock{ FileInfo{ "empty", "", 0, FileType::Directory } });
+
+        return tree;
+    }
+} // namespace
+
+void FlatTreeTests::NumbersNodesInPreOrder() const
+{
+    const auto tree = CreateSampleTree();
+    const FlatTree flatTree{ *tree };
+
+    QCOMPARE(flatTree.GetSize(), FlatTree::Index{ 6 });
+
+    const std::vector<std::string> expectedNames = { "root",   "src",   "main",
+                                                     "README", "notes", "empty" };
+    const std::vector<FlatTree::Index> expectedParents = { FlatTree::NoIndex, 0, 1, 1, 0, 0 };
+    const std::vector<FlatTree::Index> expectedSubtreeEnds = { 6, 4, 3, 4, 5, 6 };
+
+    for (FlatTree::Index index = 0; index < flatTree.GetSize(); ++index) {
+        QCOMPARE(flatTree.GetNames()[index].ToString(), expectedNames[index]);
+        QCOMPARE(flatTree.GetParent(index), expectedParents[index]);
+        QCOMPARE(flatTree.GetSubtreeEnd(index), expectedSubtreeEnds[index]);
+    }
+}
+
+void FlatTreeTests::MatchesOriginalStructure() const
+{
+    const auto tree = CreateSampleTree();
+    const FlatTree flatTree{ *tree };
+
+    const auto toIndex = [&](const Tree<VizBlock>::Node* node) {
+        return node ? flatTree.IndexOf(*node) : FlatTree::NoIndex;
+    };
+
+    for (FlatTree::Index index = 0; index < flatTree.GetSize(); ++index) {
+        const auto& node = flatTree.GetNode(index);
+
+        QCOMPARE(flatTree.HasChildren(index), node.HasChildren());
+        QCOMPARE(flatTree.GetFirstChild(index), toIndex(node.GetFirstChild()));
+        QCOMPARE(flatTree.GetNextSibling(index), toIndex(node.GetNextSibling()));
+        QCOMPARE(flatTree.GetParent(index), toIndex(node.GetParent()));
+    }
+}
+
+void FlatTreeTests::CopiesFileAttributes() const
+{
+    const auto tree = CreateSampleTree();
+    const FlatTree flatTree{ *tree };
+
+    for (FlatTree::Index index = 0; index < flatTree.GetSize(); ++index) {
+        const auto& file = flatTree.GetNode(index)->file;
+
+        QCOMPARE(flatTree.GetSizes()[index], file.size);
+        QVERIFY(flatTree.GetTypes()[index] == file.type);
+        QVERIFY(flatTree.GetNames()[index] == file.name);
+        QVERIFY(flatTree.GetExtensions()[index] == file.extension);
+    }
+
+    QVERIFY(flatTree.GetExtensions()[2] == ".cpp");
+    QVERIFY(flatTree.GetExtensions()[4] == ".txt");
+}
+
+void FlatTreeTests::MapsNodesToIndices() const
+{
+    const auto tree = CreateSampleTree();
+    const FlatTree flatTree{ *tree };
+
+    for (FlatTree::Index index = 0; index < flatTree.GetSize(); ++index) {
+        QCOMPARE(flatTree.IndexOf(flatTree.GetNode(index)), index);
+    }
+
+    const auto otherTree = CreateSampleTree();
+    const auto& otherChild = *otherTree->GetRoot()->GetFirstChild();
+    QCOMPARE(flatTree.IndexOf(otherChild), FlatTree::NoIndex);
+
+    // Flattening the other tree records indices that mustn't be mistaken for this tree's.
+    const FlatTree otherFlatTree{ *otherTree };
+    QCOMPARE(flatTree.IndexOf(otherChild), FlatTree::NoIndex);
+    QCOMPARE(otherFlatTree.IndexOf(otherChild), FlatTree::Index{ 1 });
+}
+
+void FlatTreeTests::HandlesLoneRoot() const
+{
+    auto tree = std::make_shared<Tree<VizBlock>>(
+        VizBlock{ FileInfo{ "root", "", 0, FileType::Directory } });
+    const FlatTree flatTree{ *tree };
+
+    QCOMPARE(flatTree.GetSize(), FlatTree::Index{ 1 });
+    QCOMPARE(flatTree.HasChildren(0), false);
+    QCOMPARE(flatTree.GetFirstChild(0), FlatTree::NoIndex);
+    QCOMPARE(flatTree.GetNextSibling(0), FlatTree::NoIndex);
+
+    QCOMPARE(FlatTree{}.GetSize(), FlatTree::Index{ 0 });
+}
+
+REGISTER_TEST(FlatTreeTests)
@@ -0,0 +1,43 @@
+#ifndef FLATTREETESTS_H
+#define FLATTREETESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class FlatTreeTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that nodes are numbered in pre-order, and that each node's parent and the
+     * end of its subtree are recorded correctly.
+     */
+    void NumbersNodesInPreOrder() const;
+
+    /**
+     * @brief Verifies that first children and next siblings match those of the original tree.
+     */
+    void MatchesOriginalStructure() const;
+
+    /**
+     * @brief Verifies that the columns hold the attributes of the nodes they were built from.
+     */
+    void CopiesFileAttributes() const;
+
+    /**
+     * @brief Verifies that nodes map back onto their indices, and that nodes that aren't part of
+     * the flat tree don't.
+     */
+    void MapsNodesToIndices() const;
+
+    /**
+     * @brief Verifies that a tree consisting of nothing but its root is flattened correctly, and
+     * that a default constructed flat tree is empty.
+     */
+    void HandlesLoneRoot() const;
+};
+
+#endif // FLATTREETESTS_H
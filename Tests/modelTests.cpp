@@ -12,7 +12,7 @@ namespace
 {
     std::filesystem::path PathToNode(const Tree<VizBlock>::Node& node)
     {
-        std::vector<std::reference_wrapper<const std::string>> reversePath;
+        std::vector<std::string_view> reversePath;
         reversePath.reserve(Tree<VizBlock>::Depth(node));
         reversePath.emplace_back(node->file.name);
 
@@ -24,14 +24,15 @@ namespace
 
         const auto pathFromRoot = std::accumulate(
             std::rbegin(reversePath), std::rend(reversePath), std::string{},
-            [](const std::string& path, const std::string& file) {
+            [](std::string path, std::string_view file) {
                 constexpr auto slash = '/';
 
                 if (!path.empty() && path.back() != slash) {
-                    return path + slash + file;
+                    path += slash;
                 }
 
-                return path + file;
+                path.append(file);
+                return path;
             });
 
         auto finalPath = std::filesystem::path{ pathFromRoot };
@@ -55,7 +56,7 @@ namespace
 
                 const auto path = PathToNode(node);
                 allEvents.emplace_back(
-                    FileEvent{ path.string() + node->file.extension, eventType });
+                    FileEvent{ path.string() + node->file.extension.ToString(), eventType });
             });
 
         return allEvents;
@@ -82,9 +83,9 @@ void ModelTests::initTestCase()
                                         std::shared_ptr<Tree<VizBlock>> tree) {
         QVERIFY(tree != nullptr);
 
-        m_bytesScanned = progress.bytesProcessed.load();
-        m_filesScanned = progress.filesScanned.load();
-        m_directoriesScanned = progress.directoriesScanned.load();
+        m_bytesScanned = progress.bytesProcessed.Load();
+        m_filesScanned = progress.filesScanned.Load();
+        m_directoriesScanned = progress.directoriesScanned.Load();
 
         m_tree = std::move(tree);
     };
@@ -215,7 +216,7 @@ void ModelTests::HighlightAncestors()
     const auto target = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_tree->GetRoot() }, Tree<VizBlock>::LeafIterator{},
         [](const auto& node) {
-            return (node->file.name + node->file.extension) == "endpoint.ipp";
+            return node->file.GetFullName() == "endpoint.ipp";
         });
 
     QVERIFY(target != Tree<VizBlock>::SiblingIterator{});
@@ -240,7 +241,9 @@ void ModelTests::HighlightAllMatchingFileNames()
 
     const auto headerCount = std::count_if(
         Tree<VizBlock>::PostOrderIterator{ m_tree->GetRoot() }, Tree<VizBlock>::PostOrderIterator{},
-        [](const auto& node) { return node->file.name.find("socket") != std::string::npos; });
+        [](const auto& node) {
+            return node->file.name.View().find("socket") != std::string_view::npos;
+        });
 
     QCOMPARE(
         static_cast<std::int32_t>(m_model->GetHighlightedNodes().size()),
@@ -264,8 +267,8 @@ void ModelTests::HighlightAllMatchingFileNamesUsingRegex()
     const auto headerCount = std::count_if(
         Tree<VizBlock>::PostOrderIterator{ m_tree->GetRoot() }, Tree<VizBlock>::PostOrderIterator{},
         [](const auto& node) {
-            return node->file.extension.find("hpp") != std::string::npos &&
-                   node->file.name.find("_") != std::string::npos;
+            return node->file.extension.View().find("hpp") != std::string_view::npos &&
+                   node->file.name.View().find("_") != std::string_view::npos;
         });
 
     QCOMPARE(
@@ -368,7 +371,7 @@ void ModelTests::CopyPathToClipboard()
 
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_tree->GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     const auto path = Controller::NodeToFilePath(*targetNode);
     OS::CopyPathToClipboard(path);
@@ -385,7 +388,7 @@ void ModelTests::FindNearestNodeFromFront()
 
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_tree->GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     QVERIFY(targetNode != Tree<VizBlock>::LeafIterator{});
 
@@ -406,7 +409,7 @@ void ModelTests::FindNearestNodeFromFront()
     const auto* node = m_model->FindNearestIntersection(camera, ray, options);
     QVERIFY(node != nullptr);
 
-    const auto fileName = node->GetData().file.name + node->GetData().file.extension;
+    const auto fileName = node->GetData().file.GetFullName();
     QCOMPARE(fileName, targetName);
 }
 
@@ -416,7 +419,7 @@ void ModelTests::FindNearestNodeFromBack()
 
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_tree->GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     QVERIFY(targetNode != Tree<VizBlock>::LeafIterator{});
 
@@ -437,7 +440,7 @@ void ModelTests::FindNearestNodeFromBack()
     const auto* node = m_model->FindNearestIntersection(camera, ray, options);
     QVERIFY(node != nullptr);
 
-    const auto fileName = node->GetData().file.name + node->GetData().file.extension;
+    const auto fileName = node->GetData().file.GetFullName();
     QCOMPARE(fileName, targetName);
 }
 
@@ -447,7 +450,7 @@ void ModelTests::FindNearestNodeWithSizeLimitations()
 
     const auto targetNode = std::find_if(
         Tree<VizBlock>::LeafIterator{ m_tree->GetRoot() }, Tree<VizBlock>::LeafIterator{},
-        [&](const auto& node) { return (node->file.name + node->file.extension) == targetName; });
+        [&](const auto& node) { return node->file.GetFullName() == targetName; });
 
     QVERIFY(targetNode != Tree<VizBlock>::LeafIterator{});
 
@@ -470,8 +473,8 @@ void ModelTests::FindNearestNodeWithSizeLimitations()
     const auto* node = m_model->FindNearestIntersection(camera, ray, options);
     QVERIFY(node != nullptr);
 
-    const auto fileName = node->GetData().file.name + node->GetData().file.extension;
-    QCOMPARE(targetNode->GetParent()->GetData().file.name, fileName);
+    const auto fileName = node->GetData().file.GetFullName();
+    QCOMPARE(targetNode->GetParent()->GetData().file.name.ToString(), fileName);
 }
 
 void ModelTests::ToggleFileMonitoring()
@@ -489,7 +492,8 @@ void ModelTests::TestSingleNotification(FileEventType eventType)
 {
     QVERIFY(m_tree != nullptr);
 
-    std::filesystem::path absolutePathToRoot = m_model->GetTree().GetRoot()->GetData().file.name;
+    std::filesystem::path absolutePathToRoot =
+        m_model->GetTree().GetRoot()->GetData().file.name.View();
     std::filesystem::path targetFile = absolutePathToRoot / "spawn.hpp";
 
     m_sampleNotifications = std::vector<FileEvent>{ { targetFile, eventType } };
@@ -558,7 +562,8 @@ void ModelTests::TrackMultipleDeletions()
 
 void ModelTests::ApplyFileDeletion()
 {
-    std::filesystem::path absolutePathToRoot = m_model->GetTree().GetRoot()->GetData().file.name;
+    std::filesystem::path absolutePathToRoot =
+        m_model->GetTree().GetRoot()->GetData().file.name.View();
     std::filesystem::path targetFile = absolutePathToRoot / "basic_socket.hpp";
 
     m_sampleNotifications =
@@ -586,7 +591,8 @@ void ModelTests::ApplyFileDeletion()
 
 void ModelTests::ApplyFileCreation()
 {
-    std::filesystem::path absolutePathToRoot = m_model->GetTree().GetRoot()->GetData().file.name;
+    std::filesystem::path absolutePathToRoot =
+        m_model->GetTree().GetRoot()->GetData().file.name.View();
     std::filesystem::path targetFile = absolutePathToRoot / "fake_file.hpp";
 
     m_sampleNotifications = std::vector<FileEvent>{ { targetFile, FileEventType::Created } };
@@ -611,4 +617,40 @@ void ModelTests::ApplyFileCreation()
     QVERIFY(nodeWasAdded == true);
 }
 
+void ModelTests::ExpandUnexpandedNode()
+{
+    const auto noNotifications = []() -> std::optional<FileEvent> { return std::nullopt; };
+
+    auto tree = std::make_shared<Tree<VizBlock>>(
+        VizBlock{ FileInfo{ "/root", "", 150, FileType::Directory } });
+
+    auto* const directory =
+        tree->GetRoot()->AppendChild(VizBlock{ FileInfo{ "dir", "", 100, FileType::Directory } });
+    directory->GetData().file.isUnexpanded = true;
+    directory->GetData().file.confidence = 80;
+
+    tree->GetRoot()->AppendChild(VizBlock{ FileInfo{ "file", ".txt", 50, FileType::Regular } });
+
+    SquarifiedTreeMap model{ std::make_unique<MockFileMonitor>(noNotifications), "/root" };
+    model.Parse(tree);
+
+    Tree<VizBlock> subtree{ VizBlock{ FileInfo{ "/root/dir", "", 70, FileType::Directory } } };
+
+    auto* const subdirectory =
+        subtree.GetRoot()->AppendChild(VizBlock{ FileInfo{ "sub", "", 40, FileType::Directory } });
+    subdirectory->AppendChild(VizBlock{ FileInfo{ "nested", ".cpp", 40, FileType::Regular } });
+    subtree.GetRoot()->AppendChild(VizBlock{ FileInfo{ "loose", ".h", 30, FileType::Regular } });
+
+    model.ExpandNode(*directory, subtree);
+
+    const auto& file = directory->GetData().file;
+    QCOMPARE(file.isUnexpanded, false);
+    QCOMPARE(file.confidence, std::uint8_t{ 100 });
+    QCOMPARE(file.size, std::uintmax_t{ 70 });
+    QCOMPARE(static_cast<unsigned long>(directory->GetChildCount()), 2ul);
+
+    QCOMPARE(model.GetTree().GetRoot()->GetData().file.size, std::uintmax_t{ 120 });
+    QCOMPARE(static_cast<unsigned long>(model.GetTree().Size()), 6ul);
+}
+
 REGISTER_TEST(ModelTests)
@@ -165,6 +165,12 @@ class ModelTests : public QObject
      */
     void ApplyFileCreation();
 
+    /**
+     * @brief Verifies that the scan of an unexpanded directory is spliced into the tree in place
+     * of the directory's estimated size.
+     */
+    void ExpandUnexpandedNode();
+
   private:
     void TestSingleNotification(FileEventType eventType);
 
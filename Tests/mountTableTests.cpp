@@ -0,0 +1,127 @@
+#include "mountTableTests.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include <Model/Scanner/linuxMountTable.h>
+
+#include <sstream>
+
+#include <sys/sysmacros.h>
+
+namespace
+{
+    Scanner::MountTable CreateSampleTable()
+    {
+        std::istringstream mountInfo{
+            "23 28 0:22 / /proc rw,relatime - proc proc rw\n"
+            "24 28 0:23 / /sys rw,relatime shared:7 - sysfs sysfs rw\n"
+            "28 1 254:0 / / rw,relatime shared:1 master:2 - ext4 /dev/vda rw\n"
+            "40 28 254:16 / /home rw,relatime - ext4 /dev/vdb rw\n"
+            "41 40 0:45 / /home/user/My\\040Files rw - nfs server:/export rw\n"
+            "42 28 254:0 /srv /mnt/bound rw - ext4 /dev/vda rw\n"
+            "malformed line\n"
+        };
+
+        return Scanner::MountTable{ mountInfo };
+    }
+} // namespace
+
+void MountTableTests::ParsesMountInfo() const
+{
+    const auto table = CreateSampleTable();
+    QVERIFY(!table.IsEmpty());
+
+    const auto* const sys = table.Find("/sys");
+    QVERIFY(sys != nullptr);
+    QCOMPARE(sys->filesystemType, std::string{ "sysfs" });
+    QCOMPARE(sys->device, static_cast<std::uint64_t>(makedev(0, 23)));
+
+    const auto* const home = table.Find("/home");
+    QVERIFY(home != nullptr);
+    QCOMPARE(home->device, static_cast<std::uint64_t>(makedev(254, 16)));
+
+    QVERIFY(table.Find("/home/user") == nullptr);
+}
+
+void MountTableTests::DecodesEscapedPaths() const
+{
+    const auto table = CreateSampleTable();
+
+    const auto* const share = table.Find("/home/user/My Files");
+    QVERIFY(share != nullptr);
+    QCOMPARE(share->filesystemType, std::string{ "nfs" });
+}
+
+void MountTableTests::FindsContainingMountPoint() const
+{
+    const auto table = CreateSampleTable();
+
+    const auto* const root = table.FindContaining("/usr/lib");
+    QVERIFY(root != nullptr);
+    QCOMPARE(root->path, std::string{ "/" });
+
+    const auto* const home = table.FindContaining("/home/user/Documents");
+    QVERIFY(home != nullptr);
+    QCOMPARE(home->path, std::string{ "/home" });
+
+    // A sibling that merely shares a prefix shouldn't be mistaken for a nested path.
+    const auto* const homeless = table.FindContaining("/homeless");
+    QVERIFY(homeless != nullptr);
+    QCOMPARE(homeless->path, std::string{ "/" });
+}
+
+void MountTableTests::FindsMountPointsBelowPath() const
+{
+    const auto table = CreateSampleTable();
+
+    const auto belowHome = table.FindBelow("/home");
+    QCOMPARE(belowHome.size(), std::size_t{ 1 });
+    QCOMPARE(belowHome.front().path, std::string{ "/home/user/My Files" });
+
+    const auto belowRoot = table.FindBelow("/");
+    QCOMPARE(belowRoot.size(), std::size_t{ 5 });
+}
+
+void MountTableTests::RecognizesPseudoFilesystems() const
+{
+    QVERIFY(Scanner::MountTable::IsPseudoFilesystem("proc"));
+    QVERIFY(Scanner::MountTable::IsPseudoFilesystem("sysfs"));
+    QVERIFY(Scanner::MountTable::IsPseudoFilesystem("cgroup2"));
+
+    QVERIFY(!Scanner::MountTable::IsPseudoFilesystem("ext4"));
+    QVERIFY(!Scanner::MountTable::IsPseudoFilesystem("nfs"));
+    QVERIFY(!Scanner::MountTable::IsPseudoFilesystem("tmpfs"));
+}
+
+#else
+
+void MountTableTests::ParsesMountInfo() const
+{
+    QSKIP("The mount table is only used on Linux.");
+}
+
+void MountTableTests::DecodesEscapedPaths() const
+{
+    QSKIP("The mount table is only used on Linux.");
+}
+
+void MountTableTests::FindsContainingMountPoint() const
+{
+    QSKIP("The mount table is only used on Linux.");
+}
+
+void MountTableTests::FindsMountPointsBelowPath() const
+{
+    QSKIP("The mount table is only used on Linux.");
+}
+
+void MountTableTests::RecognizesPseudoFilesystems() const
+{
+    QSKIP("The mount table is only used on Linux.");
+}
+
+#endif // Q_OS_LINUX
+
+REGISTER_TEST(MountTableTests)
@@ -0,0 +1,41 @@
+#ifndef MOUNTTABLETESTS_H
+#define MOUNTTABLETESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class MountTableTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that mount points, filesystem types, and device numbers are parsed, even in
+     * the presence of optional fields.
+     */
+    void ParsesMountInfo() const;
+
+    /**
+     * @brief Verifies that escaped characters in mount paths are decoded.
+     */
+    void DecodesEscapedPaths() const;
+
+    /**
+     * @brief Verifies that the mount point holding a given path is correctly identified.
+     */
+    void FindsContainingMountPoint() const;
+
+    /**
+     * @brief Verifies that only the mount points nested below a given path are returned.
+     */
+    void FindsMountPointsBelowPath() const;
+
+    /**
+     * @brief Verifies that common pseudo-filesystems are recognized as such.
+     */
+    void RecognizesPseudoFilesystems() const;
+};
+
+#endif // MOUNTTABLETESTS_H
@@ -0,0 +1,139 @@
+#include "nameArenaTests.h"
+
+#include <Model/Scanner/nameArena.h>
+#include <Model/vizBlock.h>
+
+#include <Tree/Tree.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+void NameArenaTests::StoresNames() const
+{
+    Scanner::NameArena arena;
+
+    const auto shortName = arena.Store("main");
+    const auto emptyName = arena.Store("");
+
+    const std::string longText(1'000, 'x');
+    const auto longName = arena.Store(longText);
+
+    QCOMPARE(shortName.ToString(), std::string{ "main" });
+    QCOMPARE(emptyName.empty(), true);
+    QCOMPARE(longName.ToString(), longText);
+    QVERIFY(shortName == arena.Store("main"));
+    QVERIFY(shortName != longName);
+
+    QVERIFY(arena.GetByteCount() > 0);
+    QCOMPARE(Scanner::ArenaName{}.ToString(), std::string{});
+}
+
+void NameArenaTests::StoresFromManyThreads() const
+{
+    constexpr auto threadCount = 32;
+    constexpr auto namesPerThread = 10'000;
+
+    Scanner::NameArena arena;
+    std::vector<std::vector<Scanner::ArenaName>> names(threadCount);
+
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&, thread] {
+            for (auto name = 0; name < namesPerThread; ++name) {
+                names[thread].emplace_back(
+                    arena.Store(std::to_string(thread) + "-" + std::to_string(name)));
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto thread = 0; thread < threadCount; ++thread) {
+        for (auto name = 0; name < namesPerThread; ++name) {
+            QCOMPARE(
+                names[thread][name].ToString(),
+                std::to_string(thread) + "-" + std::to_string(name));
+        }
+    }
+}
+
+void NameArenaTests::InternsExtensions() const
+{
+    Scanner::NameArena arena;
+
+    const auto first = Scanner::Extension::Intern(".cpp", arena);
+    const auto second = Scanner::Extension::Intern(std::string{ ".cpp" }, arena);
+    const auto other = Scanner::Extension::Intern(".h", arena);
+
+    QVERIFY(first == second);
+    QVERIFY(first != other);
+    QVERIFY(first == ".cpp");
+    QCOMPARE(first.ToString(), std::string{ ".cpp" });
+
+    QCOMPARE(Scanner::Extension::Intern("", arena).empty(), true);
+    QVERIFY(Scanner::Extension::Intern("", arena) == Scanner::Extension{});
+
+    // Extensions are shared by every live arena, so they can be looked up from any thread.
+    std::string lookedUp;
+    std::thread{ [&] { lookedUp = Scanner::Extension::Intern(".h", arena).ToString(); } }.join();
+    QCOMPARE(lookedUp, std::string{ ".h" });
+}
+
+void NameArenaTests::SharesExtensionsBetweenArenas() const
+{
+    auto arena = std::make_unique<Scanner::NameArena>();
+    const auto extension = Scanner::Extension::Intern(".shared", *arena);
+
+    Scanner::NameArena otherArena;
+    QVERIFY(Scanner::Extension::Intern(".shared", otherArena) == extension);
+
+    // The remaining arena keeps the table, and therefore the extension, alive.
+    arena.reset();
+    QCOMPARE(extension.ToString(), std::string{ ".shared" });
+    QVERIFY(Scanner::Extension::Intern(".shared", otherArena) == extension);
+}
+
+void NameArenaTests::SplitsFileNames() const
+{
+    Scanner::NameArena arena;
+
+    const auto fileNames = { "main.cpp", "archive.tar.gz", ".bashrc", "Makefile", "trailing.",
+                             ".", "..", "..hidden" };
+
+    for (const auto* const fileName : fileNames) {
+        const std::filesystem::path path{ fileName };
+        const auto [stem, extension] = Scanner::StoreFileName(fileName, arena);
+
+        QCOMPARE(stem.ToString(), path.stem().string());
+        QCOMPARE(extension.ToString(), path.extension().string());
+    }
+}
+
+void NameArenaTests::TreeHoldsOnToArena() const
+{
+    auto arena = std::make_shared<Scanner::NameArena>();
+    const std::weak_ptr<Scanner::NameArena> observer = arena;
+
+    const auto name = arena->Store("root");
+    auto tree = Scanner::CreateTree(
+        VizBlock{ FileInfo{ name, Scanner::Extension{}, 0, FileType::Directory } }, arena);
+
+    QVERIFY(Scanner::GetNameArena(tree) == arena);
+
+    arena.reset();
+    QCOMPARE(observer.expired(), false);
+    QCOMPARE(tree->GetRoot()->GetData().file.name.ToString(), std::string{ "root" });
+
+    tree.reset();
+    QCOMPARE(observer.expired(), true);
+
+    const auto otherTree = std::make_shared<Tree<VizBlock>>(VizBlock{});
+    QVERIFY(Scanner::GetNameArena(otherTree) == Scanner::NameArena::GetSharedArena());
+}
+
+REGISTER_TEST(NameArenaTests)
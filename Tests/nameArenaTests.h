@@ -0,0 +1,48 @@
+#ifndef NAMEARENATESTS_H
+#define NAMEARENATESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class NameArenaTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that stored names read back unchanged, including empty names and names too
+     * long for a single-byte length.
+     */
+    void StoresNames() const;
+
+    /**
+     * @brief Verifies that names stored from many threads at once all read back unchanged.
+     */
+    void StoresFromManyThreads() const;
+
+    /**
+     * @brief Verifies that equal extensions are interned only once.
+     */
+    void InternsExtensions() const;
+
+    /**
+     * @brief Verifies that arenas that are alive at the same time intern extensions into the same
+     * table, and that the table outlives all but the last of them.
+     */
+    void SharesExtensionsBetweenArenas() const;
+
+    /**
+     * @brief Verifies that file names are split into stems and extensions in the same way that
+     * `std::filesystem::path` splits them.
+     */
+    void SplitsFileNames() const;
+
+    /**
+     * @brief Verifies that a tree keeps its arena alive, and hands it out again.
+     */
+    void TreeHoldsOnToArena() const;
+};
+
+#endif // NAMEARENATESTS_H
@@ -0,0 +1,144 @@
+#include "partialTreeBuilderTests.h"
+
+#include <Model/Scanner/partialTreeBuilder.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr auto NoParent = Scanner::PartialTreeBuilder::NoParent;
+} // namespace
+
+void PartialTreeBuilderTests::RequiresRoot() const
+{
+    const auto names = std::make_shared<Scanner::NameArena>();
+    Scanner::PartialTreeBuilder builder{ names };
+    QVERIFY(builder.BuildSnapshot() == nullptr);
+
+    const auto rootId = builder.ReserveId();
+    const auto childId = builder.ReserveId();
+
+    builder.RecordDirectory(childId, rootId, names->Store("child"), 10);
+    QVERIFY(builder.BuildSnapshot() == nullptr);
+
+    builder.RecordDirectory(rootId, NoParent, names->Store("/root"), 5);
+
+    const auto snapshot = builder.BuildSnapshot();
+    QVERIFY(snapshot != nullptr);
+    QCOMPARE(static_cast<unsigned long>(snapshot->Size()), 2ul);
+}
+
+void PartialTreeBuilderTests::RollsUpSizes() const
+{
+    const auto names = std::make_shared<Scanner::NameArena>();
+    Scanner::PartialTreeBuilder builder{ names };
+
+    const auto rootId = builder.ReserveId();
+    const auto firstId = builder.ReserveId();
+    const auto secondId = builder.ReserveId();
+    const auto grandchildId = builder.ReserveId();
+
+    builder.RecordDirectory(rootId, NoParent, names->Store("/root"), 1);
+    builder.RecordDirectory(firstId, rootId, names->Store("first"), 10);
+    builder.RecordDirectory(secondId, rootId, names->Store("second"), 100);
+    builder.RecordDirectory(grandchildId, firstId, names->Store("grandchild"), 1000);
+
+    const auto snapshot = builder.BuildSnapshot();
+    QVERIFY(snapshot != nullptr);
+
+    const auto& root = *snapshot->GetRoot();
+    QCOMPARE(root->file.size, std::uintmax_t{ 1111 });
+    QCOMPARE(static_cast<unsigned long>(root.GetChildCount()), 2ul);
+
+    const auto* const first = root.GetFirstChild();
+    QCOMPARE((*first)->file.name.ToString(), std::string{ "first" });
+    QCOMPARE((*first)->file.size, std::uintmax_t{ 1010 });
+    QCOMPARE((*first)->file.type, FileType::Directory);
+
+    const auto* const second = first->GetNextSibling();
+    QCOMPARE((*second)->file.size, std::uintmax_t{ 100 });
+
+    const auto* const grandchild = first->GetFirstChild();
+    QCOMPARE((*grandchild)->file.size, std::uintmax_t{ 1000 });
+}
+
+void PartialTreeBuilderTests::DefersOrphanedDirectories() const
+{
+    const auto names = std::make_shared<Scanner::NameArena>();
+    Scanner::PartialTreeBuilder builder{ names };
+
+    const auto rootId = builder.ReserveId();
+    const auto childId = builder.ReserveId();
+    const auto grandchildId = builder.ReserveId();
+
+    builder.RecordDirectory(rootId, NoParent, names->Store("/root"), 1);
+    builder.RecordDirectory(grandchildId, childId, names->Store("grandchild"), 100);
+
+    const auto firstSnapshot = builder.BuildSnapshot();
+    QCOMPARE(static_cast<unsigned long>(firstSnapshot->Size()), 1ul);
+    QCOMPARE((*firstSnapshot->GetRoot())->file.size, std::uintmax_t{ 1 });
+
+    builder.RecordDirectory(childId, rootId, names->Store("child"), 10);
+
+    const auto secondSnapshot = builder.BuildSnapshot();
+    QCOMPARE(static_cast<unsigned long>(secondSnapshot->Size()), 3ul);
+    QCOMPARE((*secondSnapshot->GetRoot())->file.size, std::uintmax_t{ 111 });
+}
+
+void PartialTreeBuilderTests::OmitsEmptyDirectories() const
+{
+    const auto names = std::make_shared<Scanner::NameArena>();
+    Scanner::PartialTreeBuilder builder{ names };
+
+    const auto rootId = builder.ReserveId();
+    const auto emptyId = builder.ReserveId();
+    const auto fullId = builder.ReserveId();
+
+    builder.RecordDirectory(rootId, NoParent, names->Store("/root"), 0);
+    builder.RecordDirectory(emptyId, rootId, names->Store("empty"), 0);
+    builder.RecordDirectory(fullId, rootId, names->Store("full"), 10);
+
+    const auto snapshot = builder.BuildSnapshot();
+    QCOMPARE(static_cast<unsigned long>(snapshot->Size()), 2ul);
+    QCOMPARE((*snapshot->GetRoot()->GetFirstChild())->file.name.ToString(), std::string{ "full" });
+}
+
+void PartialTreeBuilderTests::RecordsFromManyThreads() const
+{
+    constexpr auto threadCount = 8;
+    constexpr auto directoriesPerThread = 1000;
+
+    const auto names = std::make_shared<Scanner::NameArena>();
+    Scanner::PartialTreeBuilder builder{ names };
+
+    const auto rootId = builder.ReserveId();
+    builder.RecordDirectory(rootId, NoParent, names->Store("/root"), 0);
+
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&] {
+            for (auto directory = 0; directory < directoriesPerThread; ++directory) {
+                builder.RecordDirectory(builder.ReserveId(), rootId, names->Store("directory"), 1);
+            }
+        });
+    }
+
+    // Snapshots may be taken while the threads are still busy recording.
+    const auto partialSnapshot = builder.BuildSnapshot();
+    QVERIFY(partialSnapshot != nullptr);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = builder.BuildSnapshot();
+    QCOMPARE(
+        (*snapshot->GetRoot())->file.size, std::uintmax_t{ threadCount * directoriesPerThread });
+    QCOMPARE(
+        static_cast<unsigned long>(snapshot->Size()),
+        static_cast<unsigned long>(threadCount * directoriesPerThread + 1));
+}
+
+REGISTER_TEST(PartialTreeBuilderTests)
@@ -0,0 +1,42 @@
+#ifndef PARTIALTREEBUILDERTESTS_H
+#define PARTIALTREEBUILDERTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class PartialTreeBuilderTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that no snapshot is produced until the root has been recorded.
+     */
+    void RequiresRoot() const;
+
+    /**
+     * @brief Verifies that directory sizes include the sizes of their subdirectories.
+     */
+    void RollsUpSizes() const;
+
+    /**
+     * @brief Verifies that directories whose parent hasn't been recorded yet are left out, and
+     * that they appear in a later snapshot once the parent has been recorded.
+     */
+    void DefersOrphanedDirectories() const;
+
+    /**
+     * @brief Verifies that directories without any files in them are left out.
+     */
+    void OmitsEmptyDirectories() const;
+
+    /**
+     * @brief Verifies that directories recorded from many threads at once all end up in the
+     * snapshot.
+     */
+    void RecordsFromManyThreads() const;
+};
+
+#endif // PARTIALTREEBUILDERTESTS_H
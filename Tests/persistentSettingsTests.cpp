@@ -135,6 +135,41 @@ void PersistentSettingsTests::ToggleDarkThemeUse() const
         &Settings::PersistentSettings::ShouldUseDarkMode);
 }
 
+void PersistentSettingsTests::ToggleAsynchronousScanning() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::UseAsynchronousScanning,
+        &Settings::PersistentSettings::ShouldUseAsynchronousScanning);
+}
+
+void PersistentSettingsTests::ToggleHardLinkDeduplication() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::CountHardLinksOnce,
+        &Settings::PersistentSettings::ShouldCountHardLinksOnce);
+}
+
+void PersistentSettingsTests::ToggleAllocatedFileSizes() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::UseAllocatedFileSizes,
+        &Settings::PersistentSettings::ShouldUseAllocatedFileSizes);
+}
+
+void PersistentSettingsTests::ToggleStayingOnFilesystem() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::StayOnFilesystem,
+        &Settings::PersistentSettings::ShouldStayOnFilesystem);
+}
+
+void PersistentSettingsTests::ToggleInodeOrder() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::StatInInodeOrder,
+        &Settings::PersistentSettings::ShouldStatInInodeOrder);
+}
+
 void PersistentSettingsTests::ModifyShadowMapCascadeCount() const
 {
     constexpr auto desired = 2;
@@ -177,6 +212,98 @@ void PersistentSettingsTests::ClampShadowMapQuality() const
         [&](auto value) { QCOMPARE(value, max); });
 }
 
+void PersistentSettingsTests::ModifyScanningThreadLimit() const
+{
+    constexpr auto desired = 8;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetScanningThreadLimit,
+        &Settings::PersistentSettings::GetScanningThreadLimit, desired,
+        [&](auto value) { QCOMPARE(value, desired); });
+}
+
+void PersistentSettingsTests::ClampScanningThreadLimit() const
+{
+    constexpr auto desired = 1000;
+    constexpr auto max = 64;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetScanningThreadLimit,
+        &Settings::PersistentSettings::GetScanningThreadLimit, desired,
+        [&](auto value) { QCOMPARE(value, max); });
+}
+
+void PersistentSettingsTests::ModifyPartialResultsInterval() const
+{
+    constexpr auto desired = 500;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetPartialResultsInterval,
+        &Settings::PersistentSettings::GetPartialResultsInterval, desired,
+        [&](auto value) { QCOMPARE(value, desired); });
+}
+
+void PersistentSettingsTests::ClampPartialResultsInterval() const
+{
+    constexpr auto desired = 1'000'000;
+    constexpr auto max = 60'000;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetPartialResultsInterval,
+        &Settings::PersistentSettings::GetPartialResultsInterval, desired,
+        [&](auto value) { QCOMPARE(value, max); });
+}
+
+void PersistentSettingsTests::ModifyScanningEntryBudget() const
+{
+    constexpr auto desired = 250'000;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetScanningEntryBudget,
+        &Settings::PersistentSettings::GetScanningEntryBudget, desired,
+        [&](auto value) { QCOMPARE(value, desired); });
+}
+
+void PersistentSettingsTests::ClampScanningEntryBudget() const
+{
+    constexpr auto desired = -1;
+    constexpr auto min = 0;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetScanningEntryBudget,
+        &Settings::PersistentSettings::GetScanningEntryBudget, desired,
+        [&](auto value) { QCOMPARE(value, min); });
+}
+
+void PersistentSettingsTests::ToggleBackgroundScanning() const
+{
+    ToggleBooleanSetting(
+        &Settings::PersistentSettings::ScanInBackground,
+        &Settings::PersistentSettings::ShouldScanInBackground);
+}
+
+void PersistentSettingsTests::ClampScanOperationLimit() const
+{
+    constexpr auto desired = -1;
+    constexpr auto min = 0;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetScanOperationLimit,
+        &Settings::PersistentSettings::GetScanOperationLimit, desired,
+        [&](auto value) { QCOMPARE(value, min); });
+}
+
+void PersistentSettingsTests::ClampCheckpointInterval() const
+{
+    constexpr auto desired = 1'000'000;
+    constexpr auto max = 3'600;
+
+    ToggleIntegralSetting(
+        &Settings::PersistentSettings::SetCheckpointInterval,
+        &Settings::PersistentSettings::GetCheckpointInterval, desired,
+        [&](auto value) { QCOMPARE(value, max); });
+}
+
 void PersistentSettingsTests::DebugMenuIsOffByDefault() const
 {
     constexpr auto defaultState = false;
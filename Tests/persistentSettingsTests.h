@@ -77,6 +77,31 @@ class PersistentSettingsTests : public QObject
      */
     void ToggleDarkThemeUse() const;
 
+    /**
+     * @brief Verifies that the use of the asynchronous scanning engine can be correctly toggled.
+     */
+    void ToggleAsynchronousScanning() const;
+
+    /**
+     * @brief Verifies that counting hard links only once can be correctly toggled.
+     */
+    void ToggleHardLinkDeduplication() const;
+
+    /**
+     * @brief Verifies that the use of allocated file sizes can be correctly toggled.
+     */
+    void ToggleAllocatedFileSizes() const;
+
+    /**
+     * @brief Verifies that staying on a single filesystem can be correctly toggled.
+     */
+    void ToggleStayingOnFilesystem() const;
+
+    /**
+     * @brief Verifies that stat-ing files in inode order can be correctly toggled.
+     */
+    void ToggleInodeOrder() const;
+
     /**
      * @brief Verifies that the shadow map cascade counts can be correctly modified.
      */
@@ -99,6 +124,51 @@ class PersistentSettingsTests : public QObject
      */
     void ClampShadowMapQuality() const;
 
+    /**
+     * @brief Verifies that the scanning thread limit can be correctly modified.
+     */
+    void ModifyScanningThreadLimit() const;
+
+    /**
+     * @brief Verifies that the scanning thread limit is clamped to the maximum supported value.
+     */
+    void ClampScanningThreadLimit() const;
+
+    /**
+     * @brief Verifies that the interval between partial scan results can be correctly modified.
+     */
+    void ModifyPartialResultsInterval() const;
+
+    /**
+     * @brief Verifies that the interval between partial scan results is clamped to a minute.
+     */
+    void ClampPartialResultsInterval() const;
+
+    /**
+     * @brief Verifies that the scanning entry budget can be correctly modified.
+     */
+    void ModifyScanningEntryBudget() const;
+
+    /**
+     * @brief Verifies that a negative scanning entry budget is treated as no budget at all.
+     */
+    void ClampScanningEntryBudget() const;
+
+    /**
+     * @brief Verifies that background scanning can be correctly turned on and off.
+     */
+    void ToggleBackgroundScanning() const;
+
+    /**
+     * @brief Verifies that a negative operation limit is treated as no limit at all.
+     */
+    void ClampScanOperationLimit() const;
+
+    /**
+     * @brief Verifies that the interval between scan checkpoints is clamped to an hour.
+     */
+    void ClampCheckpointInterval() const;
+
     /**
      * @brief Verifies that the debugging menu can be correctly turned on and off.
      */
@@ -0,0 +1,198 @@
+#include "scanSnapshotTests.h"
+
+#include <Model/scanSnapshot.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Builds a small tree that exercises nested directories, repeated extensions, and files
+     * without an extension.
+     */
+    std::shared_ptr<Tree<VizBlock>> CreateSampleTree()
+    {
+        auto tree = std::make_shared<Tree<VizBlock>>(
+            VizBlock{ FileInfo{ "/home/user", "", 1'111, FileType::Directory } });
+
+        auto* const root = tree->GetRoot();
+        auto* const source = root->AppendChild(
+            VizBlock{ FileInfo{ "source", "", 1'010, FileType::Directory } });
+
+        source->GetData().file.changeStamp = 0x1234'5678'9ABC'DEF0;
+
+        source->AppendChild(VizBlock{ FileInfo{ "main", ".cpp", 1'000, FileType::Regular } });
+        source->AppendChild(VizBlock{ FileInfo{ "utilities", ".cpp", 10, FileType::Regular } });
+
+        root->AppendChild(VizBlock{ FileInfo{ "README", "", 100, FileType::Regular } });
+        root->AppendChild(VizBlock{ FileInfo{ "notes", ".txt", 1, FileType::Regular } });
+
+        return tree;
+    }
+
+    /**
+     * @brief Flattens the tree into a list of descriptions, in pre-order.
+     */
+    std::vector<std::string> Describe(const Tree<VizBlock>::Node& root)
+    {
+        std::vector<std::string> descriptions;
+
+        const auto describe = [&](const Tree<VizBlock>::Node& node, auto& recurse) -> void {
+            const auto& file = node->file;
+            descriptions.emplace_back(
+                file.name.ToString() + "|" + file.extension.ToString() + "|" +
+                std::to_string(file.size) + "|" + std::to_string(static_cast<int>(file.type)) +
+                "|" + std::to_string(file.changeStamp) + "|" +
+                std::to_string(node.GetChildCount()));
+
+            for (auto* child = node.GetFirstChild(); child; child = child->GetNextSibling()) {
+                recurse(*child, recurse);
+            }
+        };
+
+        describe(root, describe);
+        return descriptions;
+    }
+
+    /**
+     * @brief Overwrites a single byte of the file at the given offset.
+     */
+    void OverwriteByte(const std::filesystem::path& path, std::streamoff offset, char value)
+    {
+        std::fstream stream{ path, std::ios::binary | std::ios::in | std::ios::out };
+        stream.seekp(offset);
+        stream.put(value);
+    }
+
+    template <typename CallableType> bool DoesThrow(const CallableType& callable)
+    {
+        try {
+            callable();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+
+        return false;
+    }
+} // namespace
+
+void ScanSnapshotTests::init()
+{
+    std::error_code errorCode;
+    std::filesystem::remove(m_snapshotPath, errorCode);
+}
+
+void ScanSnapshotTests::RoundTripsTree() const
+{
+    const auto tree = CreateSampleTree();
+    const TreemapMetadata metadata{ 4, 2, 1'111 };
+
+    constexpr auto shouldIncludeLayout = false;
+    Snapshot::Save(m_snapshotPath, *tree, metadata, shouldIncludeLayout);
+
+    const auto snapshot = Snapshot::Load(m_snapshotPath);
+
+    QVERIFY(snapshot.tree != nullptr);
+    QVERIFY(!snapshot.hasLayout);
+    QVERIFY(Describe(*snapshot.tree->GetRoot()) == Describe(*tree->GetRoot()));
+
+    QCOMPARE(snapshot.metadata.FileCount, metadata.FileCount);
+    QCOMPARE(snapshot.metadata.DirectoryCount, metadata.DirectoryCount);
+    QCOMPARE(snapshot.metadata.TotalBytes, metadata.TotalBytes);
+}
+
+void ScanSnapshotTests::RoundTripsLayout() const
+{
+    const auto tree = CreateSampleTree();
+
+    auto& rootBlock = tree->GetRoot()->GetData().block;
+    rootBlock = Block{ PrecisePoint{ 1.0, 2.0, 3.0 }, 100.0, 2.0, 50.0 };
+
+    constexpr auto shouldIncludeLayout = true;
+    Snapshot::Save(m_snapshotPath, *tree, TreemapMetadata{}, shouldIncludeLayout);
+
+    const auto snapshot = Snapshot::Load(m_snapshotPath);
+    QVERIFY(snapshot.hasLayout);
+
+    const auto& restoredBlock = snapshot.tree->GetRoot()->GetData().block;
+    QCOMPARE(restoredBlock.GetOrigin().x(), 1.0);
+    QCOMPARE(restoredBlock.GetOrigin().y(), 2.0);
+    QCOMPARE(restoredBlock.GetOrigin().z(), 3.0);
+    QCOMPARE(restoredBlock.GetWidth(), 100.0);
+    QCOMPARE(restoredBlock.GetHeight(), 2.0);
+    QCOMPARE(restoredBlock.GetDepth(), 50.0);
+}
+
+void ScanSnapshotTests::RoundTripsDirectoryFlags() const
+{
+    const auto tree = CreateSampleTree();
+
+    auto* const root = tree->GetRoot();
+    root->GetData().file.isIncomplete = true;
+
+    auto* const source = root->GetFirstChild();
+    source->GetData().file.isIncomplete = true;
+
+    auto* const unexpanded = root->AppendChild(
+        VizBlock{ FileInfo{ "archive", "", 1, FileType::Directory } });
+    unexpanded->GetData().file.isUnexpanded = true;
+
+    Snapshot::Save(m_snapshotPath, *tree, TreemapMetadata{}, false);
+
+    const auto snapshot = Snapshot::Load(m_snapshotPath);
+    const auto* const restoredRoot = snapshot.tree->GetRoot();
+    const auto* const restoredSource = restoredRoot->GetFirstChild();
+
+    // The unexpanded directory was appended last.
+    auto* restoredUnexpanded = restoredSource;
+    while (restoredUnexpanded->GetNextSibling()) {
+        restoredUnexpanded = restoredUnexpanded->GetNextSibling();
+    }
+
+    QVERIFY(restoredRoot->GetData().file.isIncomplete);
+    QVERIFY(!restoredRoot->GetData().file.isUnexpanded);
+
+    QVERIFY(restoredSource->GetData().file.isIncomplete);
+    QVERIFY(!restoredSource->GetData().file.isUnexpanded);
+    QVERIFY(!restoredSource->GetFirstChild()->GetData().file.isIncomplete);
+
+    QVERIFY(restoredUnexpanded->GetData().file.isUnexpanded);
+    QVERIFY(!restoredUnexpanded->GetData().file.isIncomplete);
+}
+
+void ScanSnapshotTests::RejectsDamagedSnapshot() const
+{
+    Snapshot::Save(m_snapshotPath, *CreateSampleTree(), TreemapMetadata{}, false);
+
+    // Flip a byte in the string table, which only the checksum can catch.
+    const auto fileSize = static_cast<std::streamoff>(std::filesystem::file_size(m_snapshotPath));
+    OverwriteByte(m_snapshotPath, fileSize - 1, '?');
+
+    QVERIFY(DoesThrow([&] { Snapshot::Load(m_snapshotPath); }));
+}
+
+void ScanSnapshotTests::RejectsIncompatibleVersion() const
+{
+    Snapshot::Save(m_snapshotPath, *CreateSampleTree(), TreemapMetadata{}, false);
+
+    // The version number immediately follows the eight byte magic number.
+    constexpr auto versionOffset = 8;
+    OverwriteByte(m_snapshotPath, versionOffset, static_cast<char>(Snapshot::FormatVersion + 1));
+
+    QVERIFY(DoesThrow([&] { Snapshot::Load(m_snapshotPath); }));
+}
+
+void ScanSnapshotTests::RejectsTruncatedSnapshot() const
+{
+    Snapshot::Save(m_snapshotPath, *CreateSampleTree(), TreemapMetadata{}, false);
+
+    const auto fileSize = std::filesystem::file_size(m_snapshotPath);
+    std::filesystem::resize_file(m_snapshotPath, fileSize / 2);
+
+    QVERIFY(DoesThrow([&] { Snapshot::Load(m_snapshotPath); }));
+}
+
+REGISTER_TEST(ScanSnapshotTests)
@@ -0,0 +1,57 @@
+#ifndef SCANSNAPSHOTTESTS_H
+#define SCANSNAPSHOTTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+#include <filesystem>
+
+class ScanSnapshotTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Removes any snapshot left behind by the previous test.
+     */
+    void init();
+
+    /**
+     * @brief Verifies that a tree survives a round trip through a snapshot unchanged.
+     */
+    void RoundTripsTree() const;
+
+    /**
+     * @brief Verifies that the treemap layout can be saved and restored along with the tree.
+     */
+    void RoundTripsLayout() const;
+
+    /**
+     * @brief Verifies that the flags that mark unexpanded and incomplete directories survive a
+     * round trip through a snapshot, without bleeding into one another.
+     */
+    void RoundTripsDirectoryFlags() const;
+
+    /**
+     * @brief Verifies that a snapshot with a damaged body is rejected.
+     */
+    void RejectsDamagedSnapshot() const;
+
+    /**
+     * @brief Verifies that a snapshot written by a different version of the format is rejected.
+     */
+    void RejectsIncompatibleVersion() const;
+
+    /**
+     * @brief Verifies that a truncated snapshot is rejected.
+     */
+    void RejectsTruncatedSnapshot() const;
+
+  private:
+    std::filesystem::path m_snapshotPath =
+        std::filesystem::temp_directory_path() / "D-Viz-Test-Snapshot.dviz";
+};
+
+#endif // SCANSNAPSHOTTESTS_H
@@ -0,0 +1,117 @@
+#include "scanSummaryTests.h"
+
+#include <Model/scanSummary.h>
+
+#include <memory>
+#include <string>
+
+namespace
+{
+    /**
+     * @brief Builds a small tree with nested directories, repeated extensions, and files without
+     * an extension.
+     */
+    std::shared_ptr<Tree<VizBlock>> CreateSampleTree()
+    {
+        auto tree = std::make_shared<Tree<VizBlock>>(
+            VizBlock{ FileInfo{ "/home/user", "", 1'611, FileType::Directory } });
+
+        auto* const root = tree->GetRoot();
+        auto* const source = root->AppendChild(
+            VizBlock{ FileInfo{ "source", "", 1'510, FileType::Directory } });
+
+        source->AppendChild(VizBlock{ FileInfo{ "main", ".cpp", 1'000, FileType::Regular } });
+        source->AppendChild(VizBlock{ FileInfo{ "utilities", ".cpp", 10, FileType::Regular } });
+
+        auto* const include = source->AppendChild(
+            VizBlock{ FileInfo{ "include", "", 500, FileType::Directory } });
+
+        include->AppendChild(VizBlock{ FileInfo{ "main", ".h", 500, FileType::Regular } });
+
+        root->AppendChild(VizBlock{ FileInfo{ "README", "", 100, FileType::Regular } });
+        root->AppendChild(VizBlock{ FileInfo{ "notes", ".txt", 1, FileType::Regular } });
+
+        return tree;
+    }
+} // namespace
+
+void ScanSummaryTests::CountsEntries() const
+{
+    const auto tree = CreateSampleTree();
+    const auto report = Summary::Summarize(*tree, 10);
+
+    QCOMPARE(report.root, std::filesystem::path{ "/home/user" });
+    QCOMPARE(report.totalSize, std::uintmax_t{ 1'611 });
+    QCOMPARE(report.fileCount, std::uintmax_t{ 5 });
+    QCOMPARE(report.directoryCount, std::uintmax_t{ 2 });
+}
+
+void ScanSummaryTests::RanksLargestEntries() const
+{
+    const auto tree = CreateSampleTree();
+    const auto report = Summary::Summarize(*tree, 10);
+
+    QCOMPARE(static_cast<unsigned long>(report.largestDirectories.size()), 2ul);
+    QCOMPARE(report.largestDirectories[0].path, std::filesystem::path{ "/home/user/source" });
+    QCOMPARE(report.largestDirectories[0].size, std::uintmax_t{ 1'510 });
+    QCOMPARE(
+        report.largestDirectories[1].path, std::filesystem::path{ "/home/user/source/include" });
+
+    QCOMPARE(static_cast<unsigned long>(report.largestFiles.size()), 5ul);
+    QCOMPARE(report.largestFiles[0].path, std::filesystem::path{ "/home/user/source/main.cpp" });
+    QCOMPARE(
+        report.largestFiles[1].path, std::filesystem::path{ "/home/user/source/include/main.h" });
+    QCOMPARE(report.largestFiles[2].path, std::filesystem::path{ "/home/user/README" });
+    QCOMPARE(report.largestFiles[4].size, std::uintmax_t{ 1 });
+}
+
+void ScanSummaryTests::LimitsRankings() const
+{
+    const auto tree = CreateSampleTree();
+    const auto report = Summary::Summarize(*tree, 2);
+
+    QCOMPARE(static_cast<unsigned long>(report.largestFiles.size()), 2ul);
+    QCOMPARE(report.largestFiles[0].size, std::uintmax_t{ 1'000 });
+    QCOMPARE(report.largestFiles[1].size, std::uintmax_t{ 500 });
+
+    // The totals still cover the entire tree.
+    QCOMPARE(report.fileCount, std::uintmax_t{ 5 });
+
+    const auto emptyReport = Summary::Summarize(*tree, 0);
+    QVERIFY(emptyReport.largestDirectories.empty());
+    QVERIFY(emptyReport.largestFiles.empty());
+}
+
+void ScanSummaryTests::TalliesExtensions() const
+{
+    const auto tree = CreateSampleTree();
+    const auto report = Summary::Summarize(*tree, 10);
+
+    QCOMPARE(static_cast<unsigned long>(report.extensions.size()), 4ul);
+
+    QCOMPARE(report.extensions[0].extension, std::string{ ".cpp" });
+    QCOMPARE(report.extensions[0].totalSize, std::uintmax_t{ 1'010 });
+    QCOMPARE(report.extensions[0].fileCount, std::uintmax_t{ 2 });
+
+    QCOMPARE(report.extensions[1].extension, std::string{ ".h" });
+    QCOMPARE(report.extensions[2].extension, std::string{});
+    QCOMPARE(report.extensions[2].totalSize, std::uintmax_t{ 100 });
+    QCOMPARE(report.extensions[3].extension, std::string{ ".txt" });
+}
+
+void ScanSummaryTests::FlagsIncompleteScans() const
+{
+    const auto tree = CreateSampleTree();
+    QVERIFY(Summary::Summarize(*tree, 10).isComplete);
+
+    tree->GetRoot()->GetData().file.isIncomplete = true;
+
+    const auto report = Summary::Summarize(*tree, 10);
+    QVERIFY(!report.isComplete);
+
+    // Whatever was scanned before the cancellation is still summarized.
+    QCOMPARE(report.totalSize, std::uintmax_t{ 1'611 });
+    QCOMPARE(report.fileCount, std::uintmax_t{ 5 });
+}
+
+REGISTER_TEST(ScanSummaryTests)
@@ -0,0 +1,41 @@
+#ifndef SCANSUMMARYTESTS_H
+#define SCANSUMMARYTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class ScanSummaryTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that the totals cover every file and every directory below the root.
+     */
+    void CountsEntries() const;
+
+    /**
+     * @brief Verifies that directories and files are ranked from largest to smallest, with their
+     * complete paths.
+     */
+    void RanksLargestEntries() const;
+
+    /**
+     * @brief Verifies that no more than the requested number of entries are ranked.
+     */
+    void LimitsRankings() const;
+
+    /**
+     * @brief Verifies that files are tallied by extension, including files without one.
+     */
+    void TalliesExtensions() const;
+
+    /**
+     * @brief Verifies that the summary of a cancelled scan is flagged as incomplete.
+     */
+    void FlagsIncompleteScans() const;
+};
+
+#endif // SCANSUMMARYTESTS_H
@@ -0,0 +1,239 @@
+#include "scanningWorkerTests.h"
+
+#include <Model/Scanner/scanningOptions.h>
+#include <Model/Scanner/scanningProgress.h>
+#include <Model/Scanner/scanningWorker.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef Q_OS_LINUX
+#include <sys/stat.h>
+#endif // Q_OS_LINUX
+
+namespace
+{
+    void CreateFile(const std::filesystem::path& path, std::size_t size)
+    {
+        std::ofstream stream{ path, std::ios::binary };
+        stream << std::string(size, 'x');
+    }
+
+    /**
+     * @brief Scans to completion.
+     *
+     * @param[in] options           The options to scan with, including the directory to scan.
+     * @param[out] progress         The progress of the scan, as reported by the scanner.
+     *
+     * @returns The resulting tree.
+     */
+    std::shared_ptr<Tree<VizBlock>> Scan(const ScanningOptions& options, ScanningProgress& progress)
+    {
+        progress.Reset();
+
+        std::atomic<bool> cancellationToken{ false };
+        std::shared_ptr<Tree<VizBlock>> fileTree;
+
+        ScanningWorker worker{ options, progress, cancellationToken };
+        QObject::connect(
+            &worker, &ScanningWorker::Finished,
+            [&](const std::shared_ptr<Tree<VizBlock>>& result) { fileTree = result; });
+
+        worker.Start();
+        return fileTree;
+    }
+
+    /**
+     * @brief Scans the given directory to completion.
+     *
+     * @param[in] path              The directory to scan.
+     * @param[in] previousTree      The tree of a previous scan of the same directory, if any.
+     * @param[out] progress         The progress of the scan, as reported by the scanner.
+     *
+     * @returns The resulting tree.
+     */
+    std::shared_ptr<Tree<VizBlock>> Scan(
+        const std::filesystem::path& path, std::shared_ptr<Tree<VizBlock>> previousTree,
+        ScanningProgress& progress)
+    {
+        ScanningOptions options;
+        options.path = path;
+        options.previousTree = std::move(previousTree);
+
+        return Scan(options, progress);
+    }
+
+    /**
+     * @brief Flattens the tree into a list of descriptions, in the order in which the tree is
+     * traversed.
+     */
+    std::vector<std::string> Describe(const Tree<VizBlock>& tree)
+    {
+        std::vector<std::string> descriptions;
+        for (const auto& node : tree) {
+            const auto& file = node->file;
+            descriptions.emplace_back(
+                file.name.ToString() + "|" + file.extension.ToString() + "|" +
+                std::to_string(file.size) + "|" + std::to_string(static_cast<int>(file.type)) +
+                "|" + std::to_string(node.GetChildCount()));
+        }
+
+        return descriptions;
+    }
+
+    const Tree<VizBlock>::Node* FindChild(const Tree<VizBlock>::Node& parent, const char* name)
+    {
+        for (auto* child = parent.GetFirstChild(); child; child = child->GetNextSibling()) {
+            if (child->GetData().file.name.ToString() == name) {
+                return child;
+            }
+        }
+
+        return nullptr;
+    }
+} // namespace
+
+void ScanningWorkerTests::init()
+{
+    std::filesystem::remove_all(m_directory);
+    std::filesystem::create_directory(m_directory);
+}
+
+void ScanningWorkerTests::cleanup()
+{
+    std::filesystem::remove_all(m_directory);
+}
+
+void ScanningWorkerTests::RescansIncrementally() const
+{
+    std::filesystem::create_directories(m_directory / "alpha" / "nested");
+    CreateFile(m_directory / "alpha" / "first.txt", 100);
+    CreateFile(m_directory / "alpha" / "second.txt", 200);
+    CreateFile(m_directory / "alpha" / "nested" / "third.txt", 50);
+
+    std::filesystem::create_directories(m_directory / "beta" / "deep");
+    CreateFile(m_directory / "beta" / "fourth.txt", 300);
+    CreateFile(m_directory / "beta" / "deep" / "fifth.txt", 400);
+
+    std::filesystem::create_directories(m_directory / "gamma" / "hollow");
+    CreateFile(m_directory / "gamma" / "sixth.txt", 10);
+
+    ScanningProgress progress;
+    const auto previousTree = Scan(m_directory, nullptr, progress);
+    QVERIFY(previousTree != nullptr);
+
+    // The empty subdirectory is pruned from the tree, so the stamp of its parent has to be cleared
+    // in order for the next scan to notice when the subdirectory gets filled.
+    const auto* const previousGamma = FindChild(*previousTree->GetRoot(), "gamma");
+    QVERIFY(previousGamma != nullptr);
+    QVERIFY(FindChild(*previousGamma, "hollow") == nullptr);
+    QCOMPARE(previousGamma->GetData().file.changeStamp, std::uint64_t{ 0 });
+
+    const auto* const previousAlpha = FindChild(*previousTree->GetRoot(), "alpha");
+    QVERIFY(previousAlpha != nullptr);
+    QVERIFY(previousAlpha->GetData().file.changeStamp != 0);
+
+    // Filling the empty subdirectory leaves its parent untouched, and adding a file to a directory
+    // might not move its modification time past the resolution of the filesystem's clock, unless
+    // the time is moved along explicitly.
+    CreateFile(m_directory / "gamma" / "hollow" / "seventh.txt", 20);
+    CreateFile(m_directory / "beta" / "eighth.txt", 500);
+
+    const auto modificationTime = std::filesystem::last_write_time(m_directory / "beta");
+    std::filesystem::last_write_time(
+        m_directory / "beta", modificationTime + std::chrono::seconds{ 1 });
+
+    const auto incrementalTree = Scan(m_directory, previousTree, progress);
+    QVERIFY(incrementalTree != nullptr);
+
+    // The root and "alpha" are unchanged, and so is "nested". While "beta" has to be read again,
+    // its subdirectory "deep" is matched to its previous incarnation by name, and can be reused.
+    QCOMPARE(progress.directoriesReused.Load(), std::uintmax_t{ 4 });
+
+    const auto fullTree = Scan(m_directory, nullptr, progress);
+    QVERIFY(fullTree != nullptr);
+    QCOMPARE(progress.directoriesReused.Load(), std::uintmax_t{ 0 });
+
+    QCOMPARE(incrementalTree->Size(), fullTree->Size());
+    QCOMPARE(incrementalTree->GetRoot()->GetData().file.size, std::uintmax_t{ 1'580 });
+    QVERIFY(Describe(*incrementalTree) == Describe(*fullTree));
+}
+
+#ifdef Q_OS_LINUX
+
+void ScanningWorkerTests::CountsHardLinksOnce() const
+{
+    std::filesystem::create_directory(m_directory / "first");
+    std::filesystem::create_directory(m_directory / "second");
+
+    CreateFile(m_directory / "first" / "original.bin", 1'000);
+    CreateFile(m_directory / "second" / "unrelated.txt", 10);
+    std::filesystem::create_hard_link(
+        m_directory / "first" / "original.bin", m_directory / "second" / "link.bin");
+
+    for (const auto engine : { ScanningEngine::ThreadPool, ScanningEngine::IoUring }) {
+        ScanningOptions options;
+        options.path = m_directory;
+        options.engine = engine;
+
+        ScanningProgress progress;
+        const auto everyLinkTree = Scan(options, progress);
+        QVERIFY(everyLinkTree != nullptr);
+        QCOMPARE(everyLinkTree->GetRoot()->GetData().file.size, std::uintmax_t{ 2'010 });
+        QCOMPARE(progress.duplicateHardLinksSkipped.Load(), std::uintmax_t{ 0 });
+
+        options.shouldCountHardLinksOnce = true;
+
+        const auto singleLinkTree = Scan(options, progress);
+        QVERIFY(singleLinkTree != nullptr);
+        QCOMPARE(singleLinkTree->GetRoot()->GetData().file.size, std::uintmax_t{ 1'010 });
+        QCOMPARE(progress.duplicateHardLinksSkipped.Load(), std::uintmax_t{ 1 });
+    }
+}
+
+void ScanningWorkerTests::MeasuresAllocatedSize() const
+{
+    // A sparse file occupies far less space than its length would suggest.
+    CreateFile(m_directory / "small.txt", 10);
+    CreateFile(m_directory / "large.bin", 100'000);
+    CreateFile(m_directory / "sparse.bin", 0);
+    std::filesystem::resize_file(m_directory / "sparse.bin", 1'000'000);
+
+    std::uintmax_t allocatedSize = 0;
+    for (const auto* name : { "small.txt", "large.bin", "sparse.bin" }) {
+        struct stat status;
+        QCOMPARE(::stat((m_directory / name).c_str(), &status), 0);
+        allocatedSize += static_cast<std::uintmax_t>(status.st_blocks) * 512u;
+    }
+
+    for (const auto engine : { ScanningEngine::ThreadPool, ScanningEngine::IoUring }) {
+        ScanningOptions options;
+        options.path = m_directory;
+        options.engine = engine;
+        options.sizeMetric = FileSizeMetric::Allocated;
+
+        ScanningProgress progress;
+        const auto fileTree = Scan(options, progress);
+        QVERIFY(fileTree != nullptr);
+        QCOMPARE(fileTree->GetRoot()->GetData().file.size, allocatedSize);
+    }
+}
+
+#else
+
+void ScanningWorkerTests::CountsHardLinksOnce() const
+{
+    QSKIP("Only the Linux backend reports how many links a file has.");
+}
+
+void ScanningWorkerTests::MeasuresAllocatedSize() const
+{
+    QSKIP("Only the Linux backend reports the space that a file occupies on disk.");
+}
+
+#endif // Q_OS_LINUX
+
+REGISTER_TEST(ScanningWorkerTests)
@@ -0,0 +1,43 @@
+#ifndef SCANNINGWORKERTESTS_H
+#define SCANNINGWORKERTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+#include <filesystem>
+
+class ScanningWorkerTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    void init();
+
+    void cleanup();
+
+    /**
+     * @brief Verifies that a rescan that takes the unchanged directories over from the previous
+     * tree arrives at the same tree as a full scan, while only reading the directories that have
+     * changed, or that hold an empty subdirectory that may since have been filled.
+     */
+    void RescansIncrementally() const;
+
+    /**
+     * @brief Verifies that a file with several hard links is only counted once, if so requested,
+     * and that every additional link is tallied as skipped.
+     */
+    void CountsHardLinksOnce() const;
+
+    /**
+     * @brief Verifies that files are sized by the blocks that they occupy on disk, if so requested.
+     */
+    void MeasuresAllocatedSize() const;
+
+  private:
+    const std::filesystem::path m_directory =
+        std::filesystem::temp_directory_path() / "D-Viz-Test-Scanning-Worker";
+};
+
+#endif // SCANNINGWORKERTESTS_H
@@ -0,0 +1,56 @@
+#include "shardedCounterTests.h"
+
+#include <Model/Scanner/shardedCounter.h>
+
+#include <thread>
+#include <vector>
+
+void ShardedCounterTests::AddsFromSingleThread() const
+{
+    Scanner::ShardedCounter counter;
+    QCOMPARE(counter.Load(), std::uintmax_t{ 0 });
+
+    counter.Add(1);
+    counter.Add(41);
+
+    QCOMPARE(counter.Load(), std::uintmax_t{ 42 });
+}
+
+void ShardedCounterTests::AddsFromManyThreads() const
+{
+    constexpr auto threadCount = 100u;
+    constexpr auto additionsPerThread = 10'000u;
+
+    Scanner::ShardedCounter counter;
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+
+    for (auto thread = 0u; thread < threadCount; ++thread) {
+        threads.emplace_back([&counter] {
+            for (auto addition = 0u; addition < additionsPerThread; ++addition) {
+                counter.Add(2);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    QCOMPARE(counter.Load(), std::uintmax_t{ 2 * threadCount * additionsPerThread });
+}
+
+void ShardedCounterTests::Resets() const
+{
+    Scanner::ShardedCounter counter;
+
+    std::thread{ [&counter] { counter.Add(7); } }.join();
+    counter.Add(3);
+    QCOMPARE(counter.Load(), std::uintmax_t{ 10 });
+
+    counter.Reset();
+    QCOMPARE(counter.Load(), std::uintmax_t{ 0 });
+}
+
+REGISTER_TEST(ShardedCounterTests)
@@ -0,0 +1,31 @@
+#ifndef SHARDEDCOUNTERTESTS_H
+#define SHARDEDCOUNTERTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class ShardedCounterTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that additions from a single thread add up.
+     */
+    void AddsFromSingleThread() const;
+
+    /**
+     * @brief Verifies that no addition is lost when many more threads than there are shards all
+     * add to the counter at once.
+     */
+    void AddsFromManyThreads() const;
+
+    /**
+     * @brief Verifies that resetting the counter brings it back to zero.
+     */
+    void Resets() const;
+};
+
+#endif // SHARDEDCOUNTERTESTS_H
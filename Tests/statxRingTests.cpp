@@ -0,0 +1,127 @@
+#include "statxRingTests.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+
+#include <Model/Scanner/linuxDirectoryReader.h>
+#include <Model/Scanner/linuxStatxRing.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void CreateFile(const std::filesystem::path& path, std::size_t size)
+    {
+        std::ofstream stream{ path, std::ios::binary };
+        stream << std::string(size, 'x');
+    }
+
+    const Scanner::DirectoryEntry*
+    FindEntry(const std::vector<Scanner::DirectoryEntry>& entries, const std::string& name)
+    {
+        const auto match = std::find_if(
+            std::begin(entries), std::end(entries),
+            [&](const auto& entry) { return entry.name == name; });
+
+        return match == std::end(entries) ? nullptr : &*match;
+    }
+} // namespace
+
+void StatxRingTests::init()
+{
+    std::filesystem::remove_all(m_directory);
+    std::filesystem::create_directory(m_directory);
+
+    CreateFile(m_directory / "small.txt", 10);
+    CreateFile(m_directory / "large.bin", 10'000);
+    CreateFile(m_directory / "doomed.tmp", 100);
+}
+
+void StatxRingTests::cleanup()
+{
+    std::filesystem::remove_all(m_directory);
+}
+
+void StatxRingTests::SizesFiles() const
+{
+    Scanner::StatxRing ring{ 8 };
+    if (!ring.IsAvailable()) {
+        QSKIP("This kernel doesn't support io_uring.");
+    }
+
+    const std::atomic<bool> cancellationToken{ false };
+
+    Scanner::DirectoryReader reader{ m_directory };
+    std::vector<Scanner::DirectoryEntry> entries;
+    QVERIFY(reader.ReadEntries(entries, cancellationToken));
+
+    ring.ComputeFileSizes(reader.GetDescriptor(), entries, cancellationToken);
+
+    QCOMPARE(entries.size(), std::size_t{ 3 });
+
+    const auto* const small = FindEntry(entries, "small.txt");
+    QVERIFY(small && small->metadata);
+    QCOMPARE(small->metadata->size, std::uintmax_t{ 10 });
+
+    const auto* const large = FindEntry(entries, "large.bin");
+    QVERIFY(large && large->metadata);
+    QCOMPARE(large->metadata->size, std::uintmax_t{ 10'000 });
+}
+
+void StatxRingTests::LeavesFailedFilesUnsized() const
+{
+    Scanner::StatxRing ring{ 8 };
+    if (!ring.IsAvailable()) {
+        QSKIP("This kernel doesn't support io_uring.");
+    }
+
+    const std::atomic<bool> cancellationToken{ false };
+
+    Scanner::DirectoryReader reader{ m_directory };
+    std::vector<Scanner::DirectoryEntry> entries;
+    QVERIFY(reader.ReadEntries(entries, cancellationToken));
+
+    std::filesystem::remove(m_directory / "doomed.tmp");
+
+    ring.ComputeFileSizes(reader.GetDescriptor(), entries, cancellationToken);
+
+    const auto* const doomed = FindEntry(entries, "doomed.tmp");
+    QVERIFY(doomed != nullptr);
+    QVERIFY(!doomed->metadata);
+
+    const auto* const small = FindEntry(entries, "small.txt");
+    QVERIFY(small && small->metadata);
+    QCOMPARE(small->metadata->size, std::uintmax_t{ 10 });
+
+    // The ring must still be usable for the next directory.
+    QVERIFY(ring.IsAvailable());
+}
+
+#else
+
+void StatxRingTests::init()
+{
+}
+
+void StatxRingTests::cleanup()
+{
+}
+
+void StatxRingTests::SizesFiles() const
+{
+    QSKIP("The io_uring ring is only used on Linux.");
+}
+
+void StatxRingTests::LeavesFailedFilesUnsized() const
+{
+    QSKIP("The io_uring ring is only used on Linux.");
+}
+
+#endif // Q_OS_LINUX
+
+REGISTER_TEST(StatxRingTests)
@@ -0,0 +1,36 @@
+#ifndef STATXRINGTESTS_H
+#define STATXRINGTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+#include <filesystem>
+
+class StatxRingTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    void init();
+
+    void cleanup();
+
+    /**
+     * @brief Verifies that the ring retrieves the sizes of the files in a directory.
+     */
+    void SizesFiles() const;
+
+    /**
+     * @brief Verifies that a file that disappears between reading the directory and stat-ing the
+     * file is left unsized, so that the caller knows to fall back on stat-ing it individually.
+     */
+    void LeavesFailedFilesUnsized() const;
+
+  private:
+    const std::filesystem::path m_directory =
+        std::filesystem::temp_directory_path() / "D-Viz-Test-Statx-Ring";
+};
+
+#endif // STATXRINGTESTS_H
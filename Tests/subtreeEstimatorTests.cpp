@@ -0,0 +1,128 @@
+#include "subtreeEstimatorTests.h"
+
+#include <Model/Scanner/scanningOptions.h>
+#include <Model/Scanner/subtreeEstimator.h>
+#include <Model/Scanner/syntheticFileSystemBackend.h>
+
+#include <vector>
+
+namespace
+{
+    Scanner::SyntheticFileSystemOptions CreateOptions(std::uint64_t entryCount)
+    {
+        Scanner::SyntheticFileSystemOptions options;
+        options.root = "/synthetic";
+        options.entryCount = entryCount;
+        options.subdirectoriesPerDirectory = 4;
+        options.filesPerDirectory = 16;
+
+        return options;
+    }
+
+    /**
+     * @returns The combined size of every file in the tree, as found by walking all of it.
+     */
+    std::uintmax_t MeasureTree(
+        const Scanner::FileSystemBackend& backend, const std::filesystem::path& root)
+    {
+        std::uintmax_t size = 0;
+
+        std::vector<std::filesystem::path> pendingDirectories = { root };
+        while (!pendingDirectories.empty()) {
+            const auto path = std::move(pendingDirectories.back());
+            pendingDirectories.pop_back();
+
+            std::vector<Scanner::DirectoryEntry> entries;
+            Scanner::SystemCallTally tally;
+            backend.ReadDirectory(path, entries, tally);
+
+            for (const auto& entry : entries) {
+                if (entry.type == FileType::Directory) {
+                    pendingDirectories.emplace_back(path / entry.name);
+                } else if (entry.metadata) {
+                    size += entry.metadata->size;
+                }
+            }
+        }
+
+        return size;
+    }
+} // namespace
+
+void SubtreeEstimatorTests::MeasuresSmallSubtreesExactly() const
+{
+    const auto options = CreateOptions(1'000);
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    Scanner::SamplingLimits limits;
+    limits.directoryBudget = backend.GetDirectoryCount();
+
+    const auto estimate =
+        Scanner::EstimateSubtree(backend, options.root, FileSizeMetric::Apparent, limits);
+
+    QCOMPARE(estimate.size, MeasureTree(backend, options.root));
+    QCOMPARE(estimate.directoryCount, backend.GetDirectoryCount() - 1);
+    QCOMPARE(estimate.directoriesRead, backend.GetDirectoryCount());
+    QCOMPARE(estimate.confidence, std::uint8_t{ 100 });
+}
+
+void SubtreeEstimatorTests::EstimatesLargeSubtrees() const
+{
+    const auto options = CreateOptions(200'000);
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    Scanner::SamplingLimits limits;
+    limits.directoryBudget = 16;
+    limits.probeCount = 64;
+
+    const auto estimate =
+        Scanner::EstimateSubtree(backend, options.root, FileSizeMetric::Apparent, limits);
+
+    const auto actualSize = static_cast<double>(MeasureTree(backend, options.root));
+    const auto estimatedSize = static_cast<double>(estimate.size);
+
+    QVERIFY(estimatedSize > 0.75 * actualSize);
+    QVERIFY(estimatedSize < 1.25 * actualSize);
+
+    QVERIFY(estimate.confidence < 100);
+    QVERIFY(estimate.directoriesRead < backend.GetDirectoryCount() / 10);
+}
+
+void SubtreeEstimatorTests::IsDeterministic() const
+{
+    const auto options = CreateOptions(50'000);
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    Scanner::SamplingLimits limits;
+    limits.directoryBudget = 8;
+
+    const auto first =
+        Scanner::EstimateSubtree(backend, options.root, FileSizeMetric::Apparent, limits);
+    const auto second =
+        Scanner::EstimateSubtree(backend, options.root, FileSizeMetric::Apparent, limits);
+
+    QCOMPARE(first.size, second.size);
+    QCOMPARE(first.fileCount, second.fileCount);
+    QCOMPARE(first.confidence, second.confidence);
+}
+
+void SubtreeEstimatorTests::LeavesOutExcludedDirectories() const
+{
+    const auto options = CreateOptions(50'000);
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    const auto excludeEverything = [](const std::filesystem::path&, const std::string&) {
+        return true;
+    };
+
+    const auto estimate = Scanner::EstimateSubtree(
+        backend, options.root, FileSizeMetric::Apparent, Scanner::SamplingLimits{},
+        excludeEverything);
+
+    QCOMPARE(estimate.fileCount, std::uintmax_t{ options.filesPerDirectory });
+    QCOMPARE(estimate.directoryCount, std::uintmax_t{ 0 });
+    QCOMPARE(estimate.directoriesRead, std::uintmax_t{ 1 });
+    QCOMPARE(estimate.confidence, std::uint8_t{ 100 });
+}
+
+REGISTER_TEST(SubtreeEstimatorTests)
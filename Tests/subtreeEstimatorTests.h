@@ -0,0 +1,37 @@
+#ifndef SUBTREEESTIMATORTESTS_H
+#define SUBTREEESTIMATORTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class SubtreeEstimatorTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that a subtree that fits within the directory budget is measured exactly,
+     * and with full confidence.
+     */
+    void MeasuresSmallSubtreesExactly() const;
+
+    /**
+     * @brief Verifies that the estimate of a subtree that exceeds the budget comes reasonably close
+     * to the actual size, without reading much of the subtree.
+     */
+    void EstimatesLargeSubtrees() const;
+
+    /**
+     * @brief Verifies that estimating the same subtree twice yields the same estimate.
+     */
+    void IsDeterministic() const;
+
+    /**
+     * @brief Verifies that excluded subdirectories are left out of the estimate.
+     */
+    void LeavesOutExcludedDirectories() const;
+};
+
+#endif // SUBTREEESTIMATORTESTS_H
@@ -0,0 +1,176 @@
+#include "syntheticFileSystemBackendTests.h"
+
+#include <Model/Scanner/syntheticFileSystemBackend.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+    Scanner::SyntheticFileSystemOptions CreateOptions()
+    {
+        Scanner::SyntheticFileSystemOptions options;
+        options.root = "/synthetic";
+        options.entryCount = 10'000;
+        options.subdirectoriesPerDirectory = 3;
+        options.filesPerDirectory = 9;
+
+        return options;
+    }
+
+    std::vector<std::string> ListDirectory(
+        const Scanner::FileSystemBackend& backend, const std::filesystem::path& path)
+    {
+        std::vector<Scanner::DirectoryEntry> entries;
+        Scanner::SystemCallTally tally;
+        backend.ReadDirectory(path, entries, tally);
+
+        std::vector<std::string> listing;
+        for (const auto& entry : entries) {
+            const auto size = entry.metadata ? entry.metadata->size : 0;
+            listing.emplace_back(entry.name + "|" + std::to_string(size));
+        }
+
+        return listing;
+    }
+} // namespace
+
+void SyntheticFileSystemBackendTests::GeneratesRequestedShape() const
+{
+    const auto options = CreateOptions();
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    std::uint64_t entryCount = 1;
+    std::uint64_t directoryCount = 1;
+
+    std::vector<std::filesystem::path> pendingDirectories = { options.root };
+    while (!pendingDirectories.empty()) {
+        const auto path = std::move(pendingDirectories.back());
+        pendingDirectories.pop_back();
+
+        std::vector<Scanner::DirectoryEntry> entries;
+        Scanner::SystemCallTally tally;
+        QVERIFY(backend.ReadDirectory(path, entries, tally));
+
+        std::uint32_t fileCount = 0;
+        std::uint32_t subdirectoryCount = 0;
+
+        for (const auto& entry : entries) {
+            if (entry.type == FileType::Directory) {
+                pendingDirectories.emplace_back(path / entry.name);
+                ++subdirectoryCount;
+            } else {
+                QVERIFY(entry.metadata.has_value());
+                QVERIFY(entry.metadata->size > 0);
+                QVERIFY(entry.metadata->size <= options.maximumFileSize);
+                ++fileCount;
+            }
+        }
+
+        QCOMPARE(fileCount, options.filesPerDirectory);
+        QVERIFY(subdirectoryCount <= options.subdirectoriesPerDirectory);
+
+        entryCount += entries.size();
+        directoryCount += subdirectoryCount;
+    }
+
+    QCOMPARE(directoryCount, backend.GetDirectoryCount());
+    QCOMPARE(entryCount, backend.GetEntryCount());
+    QVERIFY(entryCount <= options.entryCount);
+}
+
+void SyntheticFileSystemBackendTests::IsDeterministic() const
+{
+    const Scanner::SyntheticFileSystemBackend first{ CreateOptions() };
+    const Scanner::SyntheticFileSystemBackend second{ CreateOptions() };
+
+    const std::filesystem::path root = CreateOptions().root;
+    QVERIFY(ListDirectory(first, root) == ListDirectory(second, root));
+    QVERIFY(ListDirectory(first, root / "dir2") == ListDirectory(second, root / "dir2"));
+    QCOMPARE(first.ComputeChangeStamp(root / "dir2"), second.ComputeChangeStamp(root / "dir2"));
+
+    auto options = CreateOptions();
+    options.seed = 1;
+
+    const Scanner::SyntheticFileSystemBackend reseeded{ options };
+    QVERIFY(ListDirectory(first, root) != ListDirectory(reseeded, root));
+}
+
+void SyntheticFileSystemBackendTests::RecognizesOnlyGeneratedDirectories() const
+{
+    const Scanner::SyntheticFileSystemBackend backend{ CreateOptions() };
+
+    const std::filesystem::path root = CreateOptions().root;
+    const auto lastDirectory = "dir" + std::to_string(backend.GetDirectoryCount() - 1);
+    const auto pastLastDirectory = "dir" + std::to_string(backend.GetDirectoryCount());
+
+    QVERIFY(backend.IsDirectory(root));
+    QVERIFY(backend.IsDirectory(root / "dir1"));
+    QVERIFY(backend.IsDirectory(root / lastDirectory));
+
+    QVERIFY(!backend.IsDirectory(root / pastLastDirectory));
+    QVERIFY(!backend.IsDirectory(root / "dir0"));
+    QVERIFY(!backend.IsDirectory(root / "dir1x"));
+    QVERIFY(!backend.IsDirectory(root / "file0.txt"));
+    QVERIFY(!backend.IsDirectory("/elsewhere"));
+
+    QCOMPARE(backend.ComputeChangeStamp("/elsewhere"), std::uint64_t{ 0 });
+}
+
+void SyntheticFileSystemBackendTests::InjectsLatency() const
+{
+    auto options = CreateOptions();
+    options.latency = std::chrono::milliseconds{ 2 };
+    options.jitter = std::chrono::milliseconds{ 1 };
+
+    const Scanner::SyntheticFileSystemBackend backend{ options };
+
+    std::vector<Scanner::DirectoryEntry> entries;
+    Scanner::SystemCallTally tally;
+
+    const auto startTime = std::chrono::steady_clock::now();
+    backend.ReadDirectory(options.root, entries, tally);
+    const auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+    // One call to list the directory, and one for each file.
+    const auto expectedCallCount = 1u + options.filesPerDirectory;
+    QCOMPARE(tally.issued, std::uintmax_t{ expectedCallCount });
+
+    const auto minimumLatency = expectedCallCount * (options.latency - options.jitter);
+    QVERIFY(elapsedTime >= minimumLatency);
+}
+
+void SyntheticFileSystemBackendTests::OpensDirectoriesByPath() const
+{
+    const Scanner::SyntheticFileSystemBackend backend{ CreateOptions() };
+
+    const std::filesystem::path root = CreateOptions().root;
+    std::vector<std::filesystem::path> resolvedPaths;
+
+    const auto parent = backend.OpenDirectory(nullptr, root.string(), [&] {
+        resolvedPaths.emplace_back(root);
+        return root;
+    });
+
+    QVERIFY(parent != nullptr);
+
+    const auto child = backend.OpenDirectory(parent.get(), "dir2", [&] {
+        resolvedPaths.emplace_back(root / "dir2");
+        return root / "dir2";
+    });
+
+    QVERIFY(child != nullptr);
+    QVERIFY(resolvedPaths == std::vector<std::filesystem::path>({ root, root / "dir2" }));
+
+    std::vector<Scanner::DirectoryEntry> entries;
+    Scanner::SystemCallTally tally;
+    const std::atomic<bool> cancellationToken{ false };
+    QVERIFY(child->ReadEntries(entries, tally, cancellationToken));
+
+    QCOMPARE(entries.size(), ListDirectory(backend, root / "dir2").size());
+    QCOMPARE(child->ComputeChangeStamp(), backend.ComputeChangeStamp(root / "dir2"));
+}
+
+REGISTER_TEST(SyntheticFileSystemBackendTests)
@@ -0,0 +1,42 @@
+#ifndef SYNTHETICFILESYSTEMBACKENDTESTS_H
+#define SYNTHETICFILESYSTEMBACKENDTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class SyntheticFileSystemBackendTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that walking the entire tree turns up the advertised number of entries, and
+     * that every directory has the requested shape.
+     */
+    void GeneratesRequestedShape() const;
+
+    /**
+     * @brief Verifies that two backends with the same options generate the same tree.
+     */
+    void IsDeterministic() const;
+
+    /**
+     * @brief Verifies that only paths that name a directory in the tree are treated as such.
+     */
+    void RecognizesOnlyGeneratedDirectories() const;
+
+    /**
+     * @brief Verifies that reading a directory takes at least as long as its simulated calls.
+     */
+    void InjectsLatency() const;
+
+    /**
+     * @brief Verifies that a directory opened relative to its parent is read through its full path,
+     * since the synthetic backend has no notion of open directories.
+     */
+    void OpensDirectoriesByPath() const;
+};
+
+#endif // SYNTHETICFILESYSTEMBACKENDTESTS_H
@@ -0,0 +1,61 @@
+#include "tokenBucketTests.h"
+
+#include <Model/Scanner/tokenBucket.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Any fixed point in time will do, as long as it's well past the clock's epoch.
+    const auto StartTime = std::chrono::steady_clock::time_point{ 1'000s };
+} // namespace
+
+void TokenBucketTests::IsUnlimitedWithoutRate() const
+{
+    Scanner::TokenBucket bucket{ 0, 0 };
+    QVERIFY(bucket.IsUnlimited());
+
+    QCOMPARE(bucket.Consume(1'000'000, StartTime), 0ns);
+    QCOMPARE(bucket.Consume(1'000'000, StartTime), 0ns);
+}
+
+void TokenBucketTests::AllowsBurstUpToCapacity() const
+{
+    Scanner::TokenBucket bucket{ 100, 10 };
+    QVERIFY(!bucket.IsUnlimited());
+
+    QCOMPARE(bucket.Consume(4, StartTime), 0ns);
+    QCOMPARE(bucket.Consume(6, StartTime), 0ns);
+
+    // The bucket is now empty, and each token takes a hundredth of a second to replenish.
+    QCOMPARE(bucket.Consume(1, StartTime), std::chrono::nanoseconds{ 10ms });
+}
+
+void TokenBucketTests::ChargesForDebt() const
+{
+    Scanner::TokenBucket bucket{ 1'000, 100 };
+
+    // Taking three times the capacity leaves a debt of two hundred tokens.
+    QCOMPARE(bucket.Consume(300, StartTime), std::chrono::nanoseconds{ 200ms });
+
+    // Having waited that out, the bucket is empty, rather than full.
+    QCOMPARE(bucket.Consume(50, StartTime + 200ms), std::chrono::nanoseconds{ 50ms });
+}
+
+void TokenBucketTests::RefillsUpToCapacity() const
+{
+    Scanner::TokenBucket bucket{ 1'000, 100 };
+
+    QCOMPARE(bucket.Consume(100, StartTime), 0ns);
+
+    // Half of the bucket has been replenished.
+    QCOMPARE(bucket.Consume(50, StartTime + 50ms), 0ns);
+    QCOMPARE(bucket.Consume(1, StartTime + 50ms), std::chrono::nanoseconds{ 1ms });
+
+    // No matter how long the bucket is left alone, it never holds more than its capacity.
+    const auto laterTime = StartTime + 1h;
+    QCOMPARE(bucket.Consume(100, laterTime), 0ns);
+    QCOMPARE(bucket.Consume(1, laterTime), std::chrono::nanoseconds{ 1ms });
+}
+
+REGISTER_TEST(TokenBucketTests)
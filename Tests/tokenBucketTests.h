@@ -0,0 +1,36 @@
+#ifndef TOKENBUCKETTESTS_H
+#define TOKENBUCKETTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class TokenBucketTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that a bucket without a rate never asks the caller to wait.
+     */
+    void IsUnlimitedWithoutRate() const;
+
+    /**
+     * @brief Verifies that a full bucket covers a burst of up to its capacity without any wait.
+     */
+    void AllowsBurstUpToCapacity() const;
+
+    /**
+     * @brief Verifies that taking more tokens than the bucket holds has to be waited out at the
+     * configured rate, and that the debt carries over to the next caller.
+     */
+    void ChargesForDebt() const;
+
+    /**
+     * @brief Verifies that the bucket refills over time, but never beyond its capacity.
+     */
+    void RefillsUpToCapacity() const;
+};
+
+#endif // TOKENBUCKETTESTS_H
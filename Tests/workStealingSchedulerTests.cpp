@@ -0,0 +1,187 @@
+#include "workStealingSchedulerTests.h"
+
+#include <Model/Scanner/workStealingScheduler.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct TestTask
+    {
+        std::uint32_t depth;
+    };
+
+    constexpr std::uint32_t BranchingFactor = 4;
+    constexpr std::uint32_t MaximumDepth = 6;
+
+    // The number of nodes in a complete tree with the above branching factor and depth.
+    constexpr std::uint32_t ExpectedTaskCount = (4 * 4 * 4 * 4 * 4 * 4 * 4 - 1) / (4 - 1);
+
+    void RunTaskTree(
+        Scanner::WorkStealingScheduler<TestTask>& scheduler, std::atomic<std::uint32_t>& counter)
+    {
+        scheduler.Run(TestTask{ 0 }, [&](TestTask& task) {
+            counter.fetch_add(1);
+
+            if (task.depth == MaximumDepth) {
+                return;
+            }
+
+            for (std::uint32_t index = 0; index < BranchingFactor; ++index) {
+                scheduler.Submit(TestTask{ task.depth + 1 });
+            }
+        });
+    }
+} // namespace
+
+void WorkStealingSchedulerTests::ExecutesAllSubmittedTasks() const
+{
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ 4, 1024 };
+
+    std::atomic<std::uint32_t> counter{ 0 };
+    RunTaskTree(scheduler, counter);
+
+    QCOMPARE(counter.load(), ExpectedTaskCount);
+}
+
+void WorkStealingSchedulerTests::AppliesBackpressureWhenQueueIsFull() const
+{
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ 2, 1 };
+
+    std::atomic<std::uint32_t> counter{ 0 };
+    RunTaskTree(scheduler, counter);
+
+    QCOMPARE(counter.load(), ExpectedTaskCount);
+    QVERIFY(scheduler.GetInlinedTaskCount() > 0);
+}
+
+void WorkStealingSchedulerTests::CanBeRunRepeatedly() const
+{
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ 3, 16 };
+
+    std::atomic<std::uint32_t> counter{ 0 };
+    RunTaskTree(scheduler, counter);
+    RunTaskTree(scheduler, counter);
+
+    QCOMPARE(counter.load(), 2 * ExpectedTaskCount);
+}
+
+void WorkStealingSchedulerTests::InitializesEveryThread() const
+{
+    constexpr std::size_t threadCount = 4;
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ threadCount, 1024 };
+
+    std::mutex mutex;
+    std::set<std::thread::id> initializedThreads;
+    std::atomic<std::uint32_t> uninitializedTaskCount{ 0 };
+
+    const auto initializer = [&] {
+        std::lock_guard<std::mutex> lock{ mutex };
+        initializedThreads.emplace(std::this_thread::get_id());
+    };
+
+    scheduler.Run(
+        TestTask{ 0 },
+        [&](TestTask& task) {
+            {
+                std::lock_guard<std::mutex> lock{ mutex };
+                if (initializedThreads.count(std::this_thread::get_id()) == 0) {
+                    uninitializedTaskCount.fetch_add(1);
+                }
+            }
+
+            if (task.depth == MaximumDepth) {
+                return;
+            }
+
+            for (std::uint32_t index = 0; index < BranchingFactor; ++index) {
+                scheduler.Submit(TestTask{ task.depth + 1 });
+            }
+        },
+        initializer);
+
+    QCOMPARE(initializedThreads.size(), threadCount);
+    QVERIFY(initializedThreads.count(std::this_thread::get_id()) == 1);
+    QCOMPARE(uninitializedTaskCount.load(), std::uint32_t{ 0 });
+}
+
+void WorkStealingSchedulerTests::CancelDropsQueuedTasks() const
+{
+    constexpr std::uint32_t queuedTaskCount = 100;
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ 1, 1024 };
+
+    std::atomic<std::uint32_t> counter{ 0 };
+    std::vector<TestTask> droppedTasks;
+
+    scheduler.Run(TestTask{ 0 }, [&](TestTask& task) {
+        counter.fetch_add(1);
+
+        if (task.depth > 0) {
+            return;
+        }
+
+        for (std::uint32_t index = 0; index < queuedTaskCount; ++index) {
+            scheduler.Submit(TestTask{ 1 });
+        }
+
+        droppedTasks = scheduler.Cancel();
+        QCOMPARE(scheduler.GetOutstandingTaskCount(), std::uintmax_t{ 1 });
+
+        // Nothing is queued up anymore once the run has been cancelled.
+        scheduler.Submit(TestTask{ 1 });
+        QCOMPARE(counter.load(), std::uint32_t{ 2 });
+    });
+
+    QCOMPARE(counter.load(), std::uint32_t{ 2 });
+    QCOMPARE(droppedTasks.size(), std::size_t{ queuedTaskCount });
+    QCOMPARE(scheduler.GetOutstandingTaskCount(), std::uintmax_t{ 0 });
+
+    // The next run mustn't be affected by the cancellation of the previous one.
+    RunTaskTree(scheduler, counter);
+    QCOMPARE(counter.load(), 2 + ExpectedTaskCount);
+}
+
+void WorkStealingSchedulerTests::CancelWindsDownEveryThread() const
+{
+    constexpr std::uint32_t queuedTaskCount = 1000;
+    Scanner::WorkStealingScheduler<TestTask> scheduler{ 4, 1024 };
+
+    std::atomic<std::uint32_t> counter{ 0 };
+    std::atomic<std::size_t> droppedTaskCount{ 0 };
+    std::atomic<bool> isCancelled{ false };
+
+    scheduler.Run(TestTask{ 0 }, [&](TestTask& task) {
+        const auto count = counter.fetch_add(1) + 1;
+
+        if (task.depth == 0) {
+            for (std::uint32_t index = 0; index < queuedTaskCount; ++index) {
+                scheduler.Submit(TestTask{ 1 });
+            }
+
+            return;
+        }
+
+        if (count == 10) {
+            isCancelled.store(true);
+            droppedTaskCount.fetch_add(scheduler.Cancel().size());
+            return;
+        }
+
+        // Without the cancellation, the remaining tasks would keep the threads busy for a while.
+        if (!isCancelled.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        }
+    });
+
+    QVERIFY(droppedTaskCount.load() > 0);
+    QCOMPARE(counter.load() + droppedTaskCount.load(), std::size_t{ queuedTaskCount + 1 });
+    QCOMPARE(scheduler.GetOutstandingTaskCount(), std::uintmax_t{ 0 });
+}
+
+REGISTER_TEST(WorkStealingSchedulerTests)
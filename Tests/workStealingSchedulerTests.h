@@ -0,0 +1,50 @@
+#ifndef WORKSTEALINGSCHEDULERTESTS_H
+#define WORKSTEALINGSCHEDULERTESTS_H
+
+#include <QtTest>
+
+#include "Utilities/multiTestHarness.h"
+
+class WorkStealingSchedulerTests : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+
+    /**
+     * @brief Verifies that every task that is transitively submitted by the initial task is
+     * executed exactly once before `Run(...)` returns.
+     */
+    void ExecutesAllSubmittedTasks() const;
+
+    /**
+     * @brief Verifies that tasks are executed inline once a thread's queue is at capacity, and that
+     * no work is lost as a result.
+     */
+    void AppliesBackpressureWhenQueueIsFull() const;
+
+    /**
+     * @brief Verifies that the same scheduler can be run more than once.
+     */
+    void CanBeRunRepeatedly() const;
+
+    /**
+     * @brief Verifies that every thread, including the calling thread, runs the initializer
+     * before it executes any tasks.
+     */
+    void InitializesEveryThread() const;
+
+    /**
+     * @brief Verifies that cancelling a run hands back every queued task without executing it, and
+     * that any task submitted afterwards is executed inline.
+     */
+    void CancelDropsQueuedTasks() const;
+
+    /**
+     * @brief Verifies that a run that is cancelled while several threads are busy still accounts
+     * for every task, and returns without waiting on the dropped tasks.
+     */
+    void CancelWindsDownEveryThread() const;
+};
+
+#endif // WORKSTEALINGSCHEDULERTESTS_H
@@ -13,15 +13,33 @@ SOURCES += \
     $$PWD/Source/controller.cpp \
     $$PWD/Source/Model/baseModel.cpp \
     $$PWD/Source/Model/block.cpp \
+    $$PWD/Source/Model/flatTree.cpp \
     $$PWD/Source/Model/Monitor/fileSystemObserver.cpp \
     $$PWD/Source/Model/Monitor/linuxFileMonitor.cpp \
     $$PWD/Source/Model/Monitor/windowsFileMonitor.cpp \
     $$PWD/Source/Model/precisePoint.cpp \
     $$PWD/Source/Model/ray.cpp \
+    $$PWD/Source/Model/Scanner/checkpointJournal.cpp \
+    $$PWD/Source/Model/Scanner/concurrencyController.cpp \
+    $$PWD/Source/Model/Scanner/concurrentInodeSet.cpp \
     $$PWD/Source/Model/Scanner/driveScanner.cpp \
+    $$PWD/Source/Model/Scanner/exclusionRules.cpp \
+    $$PWD/Source/Model/Scanner/fileSystemBackend.cpp \
+    $$PWD/Source/Model/Scanner/linuxDirectoryReader.cpp \
+    $$PWD/Source/Model/Scanner/linuxFileSystemBackend.cpp \
+    $$PWD/Source/Model/Scanner/linuxMountTable.cpp \
+    $$PWD/Source/Model/Scanner/linuxStatxRing.cpp \
+    $$PWD/Source/Model/Scanner/nameArena.cpp \
+    $$PWD/Source/Model/Scanner/partialTreeBuilder.cpp \
     $$PWD/Source/Model/Scanner/scanningOptions.cpp \
     $$PWD/Source/Model/Scanner/scanningUtilities.cpp \
     $$PWD/Source/Model/Scanner/scanningWorker.cpp \
+    $$PWD/Source/Model/Scanner/subtreeEstimator.cpp \
+    $$PWD/Source/Model/Scanner/syntheticFileSystemBackend.cpp \
+    $$PWD/Source/Model/Scanner/tokenBucket.cpp \
+    $$PWD/Source/Model/Scanner/windowsFileSystemBackend.cpp \
+    $$PWD/Source/Model/scanSnapshot.cpp \
+    $$PWD/Source/Model/scanSummary.cpp \
     $$PWD/Source/Model/squarifiedTreemap.cpp \
     $$PWD/Source/Model/vizBlock.cpp \
     $$PWD/Source/Settings/nodePainter.cpp \
@@ -62,6 +80,7 @@ HEADERS += \
     $$PWD/Include/literals.h \
     $$PWD/Include/Model/baseModel.h \
     $$PWD/Include/Model/block.h \
+    $$PWD/Include/Model/flatTree.h \
     $$PWD/Include/Model/Monitor/fileChangeNotification.h \
     $$PWD/Include/Model/Monitor/fileMonitorBase.h \
     $$PWD/Include/Model/Monitor/fileSystemObserver.h \
@@ -69,12 +88,31 @@ HEADERS += \
     $$PWD/Include/Model/Monitor/windowsFileMonitor.h \
     $$PWD/Include/Model/precisePoint.h \
     $$PWD/Include/Model/ray.h \
+    $$PWD/Include/Model/Scanner/checkpointJournal.h \
+    $$PWD/Include/Model/Scanner/concurrencyController.h \
+    $$PWD/Include/Model/Scanner/concurrentInodeSet.h \
     $$PWD/Include/Model/Scanner/driveScanner.h \
+    $$PWD/Include/Model/Scanner/exclusionRules.h \
     $$PWD/Include/Model/Scanner/fileInfo.h \
+    $$PWD/Include/Model/Scanner/fileSystemBackend.h \
+    $$PWD/Include/Model/Scanner/linuxDirectoryReader.h \
+    $$PWD/Include/Model/Scanner/linuxFileSystemBackend.h \
+    $$PWD/Include/Model/Scanner/linuxMountTable.h \
+    $$PWD/Include/Model/Scanner/linuxStatxRing.h \
+    $$PWD/Include/Model/Scanner/nameArena.h \
+    $$PWD/Include/Model/Scanner/partialTreeBuilder.h \
     $$PWD/Include/Model/Scanner/scanningOptions.h \
     $$PWD/Include/Model/Scanner/scanningProgress.h \
     $$PWD/Include/Model/Scanner/scanningUtilities.h \
     $$PWD/Include/Model/Scanner/scanningWorker.h \
+    $$PWD/Include/Model/Scanner/shardedCounter.h \
+    $$PWD/Include/Model/Scanner/subtreeEstimator.h \
+    $$PWD/Include/Model/Scanner/syntheticFileSystemBackend.h \
+    $$PWD/Include/Model/Scanner/tokenBucket.h \
+    $$PWD/Include/Model/Scanner/windowsFileSystemBackend.h \
+    $$PWD/Include/Model/Scanner/workStealingScheduler.h \
+    $$PWD/Include/Model/scanSnapshot.h \
+    $$PWD/Include/Model/scanSummary.h \
     $$PWD/Include/Model/squarifiedTreemap.h \
     $$PWD/Include/Model/vizBlock.h \
     $$PWD/Include/Settings/nodePainter.h \